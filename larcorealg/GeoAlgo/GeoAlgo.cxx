@@ -1,6 +1,7 @@
 #include "larcorealg/GeoAlgo/GeoAlgo.h"
 #include "larcorealg/GeoAlgo/GeoAlgoConstants.h" // for kINVALID_DOUBLE
 #include "larcorealg/GeoAlgo/GeoAlgoException.h" // for GeoAlgoException
+#include "larcorealg/GeoAlgo/GeoAlgoImpl.h"      // for the shared algorithms
 
 #include <stddef.h>
 
@@ -297,139 +298,38 @@ namespace geoalgo {
     return dist;
   }
 
-  // Distance between two half-infinite lines
-  // use same function as for infinite lines
-  // but expect return points L1 and L2 to be
-  // "after" start point. Otherwise need
-  // to re-calculate using start point
-  // for one or both of the half-lines
+  // Distance between a half-infinite line and a segment
+  // Ref. RTCD 5.1.8 p. 146, checking whether s & t go out of bounds
   double GeoAlgo::_SqDist_(const HalfLine_t& hline,
                            const LineSegment_t& seg,
                            Point_t& L1,
                            Point_t& L2) const
   {
-
-    //Same as for _SqDist_ with infinite line but check whether s & t go out of bounds (i.e. negative)
-
-    auto const d1 = hline.Dir();
-    auto const d2 = seg.End() - seg.Start();
-    auto const r = hline.Start() - seg.Start();
-
-    double a = d1 * d1;
-    double b = d1 * d2;
-    double c = d1 * r;
-    double e = d2 * d2;
-    double f = d2 * r;
-
-    double d = a * e - b * b;
-
-    // if parallel then d == 0
-    if (d == 0) {
-      // distance is smallest quantity between:
-      // - distance from segment start to line
-      // - distance from segment end to line
-      double sDist = _SqDist_(seg.Start(), hline);
-      double eDist = _SqDist_(seg.End(), hline);
-      if (sDist <= eDist) {
-        // get closest point on line
-        L1 = _ClosestPt_(seg.Start(), hline);
-        L2 = seg.Start();
-        return sDist;
-      }
-      else {
-        L1 = _ClosestPt_(seg.End(), hline);
-        L2 = seg.End();
-        return eDist;
-      }
-    } // if parallel
-
-    double s = (b * f - c * e) / d;
-
-    // now check if parameters are out of bounds
-    if (s < 0) {
-      s = 0; // closest point on half-line is start
-      // re-evaluate closest point on segment using line start point
-      L1 = hline.Start();
-      L2 = _ClosestPt_(L1, seg);
-      return L1._SqDist_(L2);
-    }
-
-    // if closest point is not beyond half-line
-    // it could be due to an intersection between half-line
-    // and segment projection.
-    // check value of t
-    double t = (a * f - b * c) / d;
-    // if t > 0 && < 1 then the two lines intersect. We are good!
-    if ((t < 1) and (t > 0)) {
-      L1 = hline.Start() + hline.Dir() * s;
-      L2 = seg.Start() + (seg.End() - seg.Start()) * t;
-      return L1._SqDist_(L2);
-    }
-    // if out of bounds clamp
-    // then re-evaluate closest point on line
-    t = _Clamp_(t, 0, 1);
-    L2 = seg.Start() + (seg.End() - seg.Start()) * t;
-    L1 = _ClosestPt_(L2, hline);
-    return L1._SqDist_(L2);
+    return details::SqDistHalfLineSegment(hline, seg, L1, L2);
   }
 
   // Ref. RTCD Ch 5.1 p. 130
   double GeoAlgo::_SqDist_(const Point_t& pt, const Point_t& line_s, const Point_t& line_e) const
   {
-    auto const ab = line_e - line_s;
-    auto const ac = pt - line_s;
-    auto const bc = pt - line_e;
-    auto e = ac * ab;
-    if (e <= 0.) return ac.SqLength();
-    auto f = ab.SqLength();
-    if (e >= f) return bc.SqLength();
-    return (ac.SqLength() - e * e / f);
+    return details::SqDist(pt, line_s, line_e);
   }
 
   // Ref. RTCD Ch 5.1 p. 128-129
   Point_t GeoAlgo::_ClosestPt_(const Point_t& pt, const LineSegment_t& line) const
   {
-
-    auto const& ab = line.Dir();
-    // Project pt on line (ab), but deferring divide by ab * ab
-    auto t = ((pt - line.Start()) * ab);
-    // pt projects outside line, on the start side; clamp to start
-    if (t <= 0.)
-      return line.Start();
-    else {
-      auto denom = ab.SqLength();
-      // pt projects outside line, on the end side; clamp to end
-      if (t >= denom) return line.End();
-      // pt projects inside the line. must deferred divide now
-      else
-        return (line.Start() + ab * (t / denom));
-    }
+    return details::ClosestPtOnSegment(pt, line);
   }
 
   // Ref. RTCD Ch 5.1 p. 130
   double GeoAlgo::_SqDist_(const Point_t& pt, const HalfLine_t& line) const
   {
-    auto const& ab = line.Dir();
-    auto const ac = pt - line.Start();
-    auto const bc = ac - ab;
-
-    auto e = ac * ab;
-    if (e <= 0.) return (ac * ac);
-    auto f = ab.SqLength();
-    return (ac.SqLength() - e * e / f);
+    return details::SqDistFromHalfLine(pt, line);
   }
 
   // Ref. RTCD Ch 5.1 p. 128-129
   Point_t GeoAlgo::_ClosestPt_(const Point_t& pt, const HalfLine_t& line) const
   {
-    auto const& ab = line.Dir();
-    auto t = (pt - line.Start()) * ab;
-    if (t <= 0.)
-      return line.Start();
-    else {
-      auto denom = ab.Length();
-      return (line.Start() + ab * (t / denom));
-    }
+    return details::ClosestPtOnHalfLine(pt, line);
   }
 
   // Point & Infinite Line min Distance
@@ -456,64 +356,13 @@ namespace geoalgo {
   // Ref. RTCD Ch 5.1 p. 131-132 ... modified to consider distance to the box's wall
   double GeoAlgo::_SqDist_(const Point_t& pt, const AABox_t& box) const
   {
-    double dist = kINVALID_DOUBLE;
-
-    // If a point is inside the box, simply compute the smallest perpendicular distance
-    if (box.Contain(pt)) {
-
-      auto const& pt_min = box.Min();
-      auto const& pt_max = box.Max();
-      // (1) Compute the distance to the YZ wall
-      double dist_to_yz = pt[0] - pt_min[0];
-      if (dist_to_yz > (pt_max[0] - pt[0])) dist_to_yz = pt_max[0] - pt[0];
-
-      // (2) Compute the distance to the XZ wall
-      double dist_to_zx = pt[1] - pt_min[1];
-      if (dist_to_zx > (pt_max[1] - pt[1])) dist_to_zx = pt_max[1] - pt[1];
-
-      // (3) Compute the distance to the XY wall
-      double dist_to_xy = pt[2] - pt_min[2];
-      if (dist_to_xy > (pt_max[2] - pt[2])) dist_to_xy = pt_max[2] - pt[2];
-
-      // (4) Compute the minimum of (3), (4), and (5)
-      dist = (dist_to_yz < dist_to_zx ? dist_to_yz : dist_to_zx);
-      dist = (dist < dist_to_xy ? dist : dist_to_xy);
-      dist *= dist;
-    }
-
-    else {
-      // This refers to Ref. RTCD 5.1.3.1
-      // re-set distance
-      dist = 0;
-      for (size_t i = 0; i < pt.size(); ++i) {
-
-        auto const& v_pt = pt[i];
-        auto const& v_max = box.Max()[i];
-        auto const& v_min = box.Min()[i];
-
-        if (v_pt < v_min) dist += (v_min - v_pt) * (v_min - v_pt);
-        if (v_pt > v_max) dist += (v_pt - v_max) * (v_pt - v_max);
-      }
-    }
-    return dist;
+    return details::SqDistFromBox(pt, box);
   }
 
   // Ref. RTCD Ch 5.1 p. 130-131 ... modified to consider a point on the surface
   Point_t GeoAlgo::_ClosestPt_(const Point_t& pt, const AABox_t& box) const
   {
-    // Result
-    auto res = pt;
-    // For each coordinate axis, if the point coordinate value is outside box,
-    // clamp it to the box, else keep it as is
-    for (size_t i = 0; i < pt.size(); ++i) {
-      auto const& v_pt = pt[i];
-      auto const& v_min = box.Min()[i];
-      auto const& v_max = box.Max()[i];
-      res[i] = v_pt;
-      if (v_pt < v_min) res[i] = v_min;
-      if (v_pt > v_max) res[i] = v_max;
-    }
-    return res;
+    return details::ClosestPtInBox(pt, box);
   }
 
   // Distance between a Trajectory_t and a Point_t
@@ -529,14 +378,7 @@ namespace geoalgo {
     // Check dimensionality compatibility between point and trajectory
     trj.compat(pt);
 
-    // Now keep track of smallest distance and loop over traj segments
-    double distMin = kINVALID_DOUBLE;
-    for (size_t l = 0; l < trj.size() - 1; l++) {
-      double distTmp = _SqDist_(pt, trj[l], trj[l + 1]);
-      if (distTmp < distMin) { distMin = distTmp; }
-    }
-
-    return distMin;
+    return details::SqDistFromTrajectory(pt, trj);
   }
 
   // Distance between vector of Trajectories and a Point
@@ -578,21 +420,7 @@ namespace geoalgo {
     // Check dimensionality compatibility between point and trajectory
     trj.compat(pt);
 
-    // Now keep track of smallest distance and loop over traj segments
-    double distMin = kINVALID_DOUBLE;
-    // For that smallest distance, keep track of the segment for which it was found
-    for (size_t l = 0; l < trj.size() - 1; l++) {
-      double distTmp = _SqDist_(pt, trj[l], trj[l + 1]);
-      if (distTmp < distMin) {
-        distMin = distTmp;
-        idx = l;
-      }
-    }
-
-    // Now that we have the segment for the closest approach
-    // Use it to find the closest point on that segment
-    LineSegment_t segMin(trj[idx], trj[idx + 1]);
-    return _ClosestPt_(pt, segMin);
+    return details::ClosestPtOnTrajectory<LineSegment_t>(pt, trj, idx);
   }
 
   // Closest point between a vector of trajectories and a point
@@ -642,23 +470,7 @@ namespace geoalgo {
     // Check dimensionality compatibility between point and trajectory
     trj.compat(seg.Start());
 
-    // keep track of c1 & c2
-    Point_t c1min;
-    Point_t c2min;
-    // Now keep track of smallest distance and loop over traj segments
-    double distMin = kMAX_DOUBLE;
-
-    for (size_t l = 0; l < trj.size() - 1; l++) {
-      LineSegment_t segTmp(trj[l], trj[l + 1]);
-      double distTmp = _SqDist_(segTmp, seg, c1min, c2min);
-      if (distTmp < distMin) {
-        c1 = c1min;
-        c2 = c2min;
-        distMin = distTmp;
-      }
-    } //for all segments in the track
-
-    return distMin;
+    return details::SqDistSegmentTrajectory(seg, trj, c1, c2);
   }
 
   // Closest Approach between a Trajectory and a Trajectory
@@ -677,26 +489,7 @@ namespace geoalgo {
     // Check dimensionality compatibility between point and trajectory
     trj1.compat(trj2[0]);
 
-    // keep track of c1 & c2
-    Point_t c1min;
-    Point_t c2min;
-    // Now keep track of smallest distance and loop over traj segments
-    double distMin = kMAX_DOUBLE;
-
-    for (size_t l1 = 0; l1 < trj1.size() - 1; l1++) {
-      for (size_t l2 = 0; l2 < trj2.size() - 1; l2++) {
-        LineSegment_t segTmp1(trj1[l1], trj1[l1 + 1]);
-        LineSegment_t segTmp2(trj2[l2], trj2[l2 + 1]);
-        double distTmp = _SqDist_(segTmp1, segTmp2, c1min, c2min);
-        if (distTmp < distMin) {
-          c1 = c1min;
-          c2 = c2min;
-          distMin = distTmp;
-        }
-      } // for segments in trajectory 2
-    }   //for all segments in trajectory 1
-
-    return distMin;
+    return details::SqDistTrajectories<LineSegment_t>(trj1, trj2, c1, c2);
   }
 
   // Closest Approach between a HalfLine and a Trajectory
@@ -714,23 +507,7 @@ namespace geoalgo {
     // Check dimensionality compatibility between point and trajectory
     trj.compat(hline.Start());
 
-    // keep track of c1 & c2
-    Point_t c1min;
-    Point_t c2min;
-    // Now keep track of smallest distance and loop over traj segments
-    double distMin = kMAX_DOUBLE;
-
-    for (size_t l = 0; l < trj.size() - 1; l++) {
-      LineSegment_t segTmp(trj[l], trj[l + 1]);
-      double distTmp = _SqDist_(hline, segTmp, c1min, c2min);
-      if (distTmp < distMin) {
-        c1 = c1min;
-        c2 = c2min;
-        distMin = distTmp;
-      }
-    } //for all segments in the track
-
-    return distMin;
+    return details::SqDistHalfLineTrajectory<LineSegment_t>(hline, trj, c1, c2);
   }
 
   // Closest Approach between a Segment and a vector of tracks
@@ -778,72 +555,7 @@ namespace geoalgo {
                            Point_t& c1,
                            Point_t& c2) const
   {
-
-    double t1, t2;
-
-    auto const& s1 = seg1.Start();
-    auto const& s2 = seg2.Start();
-    auto const& e1 = seg1.End();
-    auto const& e2 = seg2.End();
-
-    auto d1 = e1 - s1;
-    auto d2 = e2 - s2;
-    auto r = s1 - s2;
-
-    double a = d1.SqLength();
-    double e = d2.SqLength();
-    double f = d2 * r;
-
-    // check if segment is too short
-    if ((a <= 0) and (e <= 0)) {
-      //both segments are too short
-      t1 = t2 = 0.;
-      c1 = s1;
-      c2 = s2;
-      Vector_t distVector = c2 - c1;
-      return distVector.SqLength();
-    }
-    if (a <= 0) {
-      //first segment degenerates into a point
-      t1 = 0.;
-      t2 = f / e;
-      t2 = _Clamp_(t2, 0., 1.);
-    }
-    else {
-      double c = d1 * r;
-      if (e <= 0) {
-        //second segment degenerates into a point
-        t2 = 0.;
-        t1 = _Clamp_(-c / a, 0., 1.);
-      }
-      else {
-        // the general case...no degeneracies
-        double b = d1 * d2;
-        double denom = (a * e) - (b * b);
-
-        if (denom != 0.)
-          t1 = _Clamp_((b * f - c * e) / denom, 0., 1.);
-        else
-          t1 = 0.;
-
-        t2 = (b * t1 + f) / e;
-
-        if (t2 < 0.) {
-          t2 = 0.;
-          t1 = _Clamp_(-c / a, 0., 1.);
-        }
-        else if (t2 > 1.) {
-          t2 = 1.;
-          t1 = _Clamp_((b - c) / a, 0., 1.);
-        }
-      }
-    }
-
-    c1 = s1 + d1 * t1;
-    c2 = s2 + d2 * t2;
-
-    Vector_t distVector = c2 - c1;
-    return distVector.SqLength();
+    return details::SqDistSegments(seg1, seg2, c1, c2);
   }
 
   // Clamp function:
@@ -851,9 +563,7 @@ namespace geoalgo {
   // return the boundary point
   double GeoAlgo::_Clamp_(const double n, const double min, const double max) const
   {
-    if (n < min) { return min; }
-    if (n > max) { return max; }
-    return n;
+    return details::Clamp(n, min, max);
   }
 
   /// Common origin: Half Line & Half Line. Keep track of origin
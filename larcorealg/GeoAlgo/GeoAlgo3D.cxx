@@ -0,0 +1,218 @@
+#include "larcorealg/GeoAlgo/GeoAlgo3D.h"
+#include "larcorealg/GeoAlgo/GeoAlgoConstants.h" // for kINVALID_DOUBLE
+#include "larcorealg/GeoAlgo/GeoAlgoException.h" // for GeoAlgoException
+#include "larcorealg/GeoAlgo/GeoAlgoImpl.h"      // for the shared algorithms
+#include "larcorealg/GeoAlgo/GeoPackedTrajectories.h"
+
+#include <stddef.h>
+#include <vector>
+
+namespace {
+
+  // Squared distance of point (px, py, pz) from each of the nSeg segments joining the packed
+  // points k and k + 1 (k = 0 ... nSeg - 1). Same as details::SqDist(), Ref. RTCD Ch 5.1,
+  // with the branches replaced by selections so that the loop can be vectorized.
+  void PackedSqDist_(double px,
+                     double py,
+                     double pz,
+                     const double* x,
+                     const double* y,
+                     const double* z,
+                     size_t nSeg,
+                     double* dists)
+  {
+    for (size_t k = 0; k < nSeg; ++k) {
+      double const abx = x[k + 1] - x[k], aby = y[k + 1] - y[k], abz = z[k + 1] - z[k];
+      double const acx = px - x[k], acy = py - y[k], acz = pz - z[k];
+      double const bcx = px - x[k + 1], bcy = py - y[k + 1], bcz = pz - z[k + 1];
+      double const e = acx * abx + acy * aby + acz * abz;
+      double const f = abx * abx + aby * aby + abz * abz;
+      double const ac2 = acx * acx + acy * acy + acz * acz;
+      double const bc2 = bcx * bcx + bcy * bcy + bcz * bcz;
+      double const in = ac2 - e * e / f; // not used (maybe NaN) if the segment has no length
+      dists[k] = (e <= 0.) ? ac2 : ((e >= f) ? bc2 : in);
+    }
+  }
+
+  // Index of the first smallest of the n distances (-1 if none), which is stored in minDist
+  int PackedMinIdx_(const double* dists, size_t n, double& minDist)
+  {
+    minDist = geoalgo::kINVALID_DOUBLE;
+    int idx = -1;
+    for (size_t k = 0; k < n; ++k) {
+      if (dists[k] < minDist) {
+        minDist = dists[k];
+        idx = k;
+      }
+    }
+    return idx;
+  }
+
+}
+
+namespace geoalgo {
+
+  Trajectory3D_t ToTrajectory3D(const Trajectory_t& trj)
+  {
+    Trajectory3D_t res;
+    res.reserve(trj.size());
+    for (auto const& pt : trj)
+      res.emplace_back(pt);
+    return res;
+  }
+
+  Point3D_t GeoAlgo3D::ClosestPt(const Point3D_t& pt, const LineSegment3D& seg) const
+  {
+    return details::ClosestPtOnSegment(pt, seg);
+  }
+
+  double GeoAlgo3D::SqDist(const Point3D_t& pt, const HalfLine3D& hline) const
+  {
+    return details::SqDistFromHalfLine(pt, hline);
+  }
+
+  Point3D_t GeoAlgo3D::ClosestPt(const Point3D_t& pt, const HalfLine3D& hline) const
+  {
+    return details::ClosestPtOnHalfLine(pt, hline);
+  }
+
+  double GeoAlgo3D::SqDist(const Point3D_t& pt, const AABox3D& box) const
+  {
+    return details::SqDistFromBox(pt, box);
+  }
+
+  Point3D_t GeoAlgo3D::ClosestPt(const Point3D_t& pt, const AABox3D& box) const
+  {
+    return details::ClosestPtInBox(pt, box);
+  }
+
+  double GeoAlgo3D::SqDist(const LineSegment3D& seg1,
+                           const LineSegment3D& seg2,
+                           Point3D_t& c1,
+                           Point3D_t& c2) const
+  {
+    return details::SqDistSegments(seg1, seg2, c1, c2);
+  }
+
+  double GeoAlgo3D::SqDist(const HalfLine3D& hline,
+                           const LineSegment3D& seg,
+                           Point3D_t& L1,
+                           Point3D_t& L2) const
+  {
+    return details::SqDistHalfLineSegment(hline, seg, L1, L2);
+  }
+
+  double GeoAlgo3D::SqDist(const Point3D_t& pt, const Trajectory3D_t& trj) const
+  {
+    // Make sure trajectory object is properly defined
+    if (!trj.size()) throw GeoAlgoException("Trajectory object not properly set...");
+    return details::SqDistFromTrajectory(pt, trj);
+  }
+
+  Point3D_t GeoAlgo3D::ClosestPt(const Point3D_t& pt, const Trajectory3D_t& trj, int& idx) const
+  {
+    // Make sure trajectory object is properly defined
+    if (!trj.size()) throw GeoAlgoException("Trajectory object not properly set...");
+    return details::ClosestPtOnTrajectory<LineSegment3D>(pt, trj, idx);
+  }
+
+  double GeoAlgo3D::SqDist(const LineSegment3D& seg,
+                           const Trajectory3D_t& trj,
+                           Point3D_t& c1,
+                           Point3D_t& c2) const
+  {
+    // Make sure trajectory object is properly defined
+    if (!trj.size()) throw GeoAlgoException("Trajectory object not properly set...");
+    return details::SqDistSegmentTrajectory(seg, trj, c1, c2);
+  }
+
+  double GeoAlgo3D::SqDist(const Trajectory3D_t& trj1,
+                           const Trajectory3D_t& trj2,
+                           Point3D_t& c1,
+                           Point3D_t& c2) const
+  {
+    // Make sure trajectory object is properly defined
+    if (!trj1.size() or !trj2.size())
+      throw GeoAlgoException("Trajectory object not properly set...");
+    return details::SqDistTrajectories<LineSegment3D>(trj1, trj2, c1, c2);
+  }
+
+  double GeoAlgo3D::SqDist(const HalfLine3D& hline,
+                           const Trajectory3D_t& trj,
+                           Point3D_t& c1,
+                           Point3D_t& c2) const
+  {
+    // Make sure trajectory object is properly defined
+    if (!trj.size()) throw GeoAlgoException("Trajectory object not properly set...");
+    return details::SqDistHalfLineTrajectory<LineSegment3D>(hline, trj, c1, c2);
+  }
+
+  // Distances of each point from all the segments of the trajectory, then the closest segment
+  void GeoAlgo3D::SqDist(const std::vector<Point3D_t>& pts,
+                         const PackedTrajectories& trjs,
+                         size_t iTrj,
+                         std::vector<double>& dists,
+                         std::vector<int>& segIdx,
+                         BatchWorkspace& work) const
+  {
+    size_t const first = trjs.FirstPoint(iTrj);
+    size_t const nSeg = trjs.NSegments(iTrj);
+    double const* x = trjs.X() + first;
+    double const* y = trjs.Y() + first;
+    double const* z = trjs.Z() + first;
+
+    dists.resize(pts.size());
+    segIdx.resize(pts.size());
+    double* segDists = work.SegDists(nSeg);
+    for (size_t i = 0; i < pts.size(); ++i) {
+      PackedSqDist_(pts[i][0], pts[i][1], pts[i][2], x, y, z, nSeg, segDists);
+      segIdx[i] = PackedMinIdx_(segDists, nSeg, dists[i]);
+    }
+  }
+
+  // Distances from all the packed segments at once (including the meaningless ones joining
+  // one trajectory to the next), then the closest segment of each trajectory
+  void GeoAlgo3D::SqDist(const Point3D_t& pt,
+                         const PackedTrajectories& trjs,
+                         std::vector<double>& dists,
+                         std::vector<int>& segIdx,
+                         BatchWorkspace& work) const
+  {
+    dists.resize(trjs.NTrajectories());
+    segIdx.resize(trjs.NTrajectories());
+    size_t const nPts = trjs.NPoints();
+    if (!nPts) return;
+
+    double* segDists = work.SegDists(nPts - 1);
+    PackedSqDist_(pt[0], pt[1], pt[2], trjs.X(), trjs.Y(), trjs.Z(), nPts - 1, segDists);
+    for (size_t t = 0; t < trjs.NTrajectories(); ++t) {
+      segIdx[t] = PackedMinIdx_(segDists + trjs.FirstPoint(t), trjs.NSegments(t), dists[t]);
+    }
+  }
+
+  // Same as above, keeping only the closest segment of the closest trajectory
+  double GeoAlgo3D::SqDist(const Point3D_t& pt,
+                           const PackedTrajectories& trjs,
+                           int& trackIdx,
+                           int& segIdx,
+                           BatchWorkspace& work) const
+  {
+    double minDist = kINVALID_DOUBLE;
+    size_t const nPts = trjs.NPoints();
+    if (!nPts) return minDist;
+
+    double* segDists = work.SegDists(nPts - 1);
+    PackedSqDist_(pt[0], pt[1], pt[2], trjs.X(), trjs.Y(), trjs.Z(), nPts - 1, segDists);
+    for (size_t t = 0; t < trjs.NTrajectories(); ++t) {
+      double dist;
+      int const idx = PackedMinIdx_(segDists + trjs.FirstPoint(t), trjs.NSegments(t), dist);
+      if (dist < minDist) {
+        minDist = dist;
+        trackIdx = t;
+        segIdx = idx;
+      }
+    }
+    return minDist;
+  }
+
+}
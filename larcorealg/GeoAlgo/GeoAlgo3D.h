@@ -0,0 +1,326 @@
+/**
+ * \file GeoAlgo3D.h
+ *
+ * \ingroup GeoAlgo
+ *
+ * \brief Class def header for a class GeoAlgo3D and its fixed-size 3D objects
+ */
+
+/** \addtogroup GeoAlgo
+
+    @{*/
+#ifndef BASICTOOL_GEOALGO3D_H
+#define BASICTOOL_GEOALGO3D_H
+
+#include "larcorealg/GeoAlgo/GeoAABox.h"
+#include "larcorealg/GeoAlgo/GeoAlgoException.h"
+#include "larcorealg/GeoAlgo/GeoAlgoImpl.h"
+#include "larcorealg/GeoAlgo/GeoHalfLine.h"
+#include "larcorealg/GeoAlgo/GeoLineSegment.h"
+#include "larcorealg/GeoAlgo/GeoTrajectory.h"
+#include "larcorealg/GeoAlgo/GeoVectorN.h"
+
+#include <stddef.h>
+#include <vector>
+
+namespace geoalgo {
+
+  /**
+     \class LineSegment3D
+     @brief Fixed-size version of LineSegment: a 3D line segment from start to end point.
+  */
+  class LineSegment3D {
+
+  public:
+    /// Ctor w/ start and end points
+    LineSegment3D(const Point3D_t& start, const Point3D_t& end)
+      : _start(start), _end(end), _dir(end - start)
+    {}
+
+    /// Ctor w/ a dynamic LineSegment
+    explicit LineSegment3D(const LineSegment_t& seg)
+      : LineSegment3D(Point3D_t(seg.Start()), Point3D_t(seg.End()))
+    {}
+
+    const Point3D_t& Start() const { return _start; } ///< Start getter
+    const Point3D_t& End() const { return _end; }     ///< End getter
+    const Vector3D_t& Dir() const { return _dir; }    ///< Direction getter (end - start)
+
+  private:
+    Point3D_t _start; ///< Start position of a line
+    Point3D_t _end;   ///< End position of a line
+    Vector3D_t _dir;  ///< Direction
+  };
+
+  /**
+     \class HalfLine3D
+     @brief Fixed-size version of HalfLine: a 3D semi-infinite line with a unit direction.
+  */
+  class HalfLine3D {
+
+  public:
+    /// Ctor w/ start point and direction (normalized)
+    HalfLine3D(const Point3D_t& start, const Vector3D_t& dir) : _start(start), _dir(dir)
+    {
+      auto l = _dir.Length();
+      if (!l) throw GeoAlgoException("<<Normalize>> cannot normalize 0-length direction vector!");
+      _dir /= l;
+    }
+
+    /// Ctor w/ a dynamic HalfLine
+    explicit HalfLine3D(const HalfLine_t& hline)
+      : _start(hline.Start()), _dir(hline.Dir()) // already normalized
+    {}
+
+    const Point3D_t& Start() const { return _start; } ///< Start getter
+    const Vector3D_t& Dir() const { return _dir; }    ///< Direction getter
+
+  private:
+    Point3D_t _start; ///< Beginning of the half line
+    Vector3D_t _dir;  ///< Direction of the half line from _start
+  };
+
+  /**
+     \class AABox3D
+     @brief Fixed-size version of AABox: a 3D axis-aligned box.
+  */
+  class AABox3D {
+
+  public:
+    /// Ctor w/ the minimum and maximum corners
+    AABox3D(const Point3D_t& min, const Point3D_t& max) : _min(min), _max(max) {}
+
+    /// Ctor w/ a dynamic AABox
+    explicit AABox3D(const AABox_t& box) : _min(box.Min()), _max(box.Max()) {}
+
+    const Point3D_t& Min() const { return _min; } ///< Minimum point getter
+    const Point3D_t& Max() const { return _max; } ///< Maximum point getter
+
+    /// Test if a point is contained within the box
+    bool Contain(const Point3D_t& pt) const
+    {
+      return !((pt[0] < _min[0] || _max[0] < pt[0]) || // point is outside X boundaries OR
+               (pt[1] < _min[1] || _max[1] < pt[1]) || // point is outside Y boundaries OR
+               (pt[2] < _min[2] || _max[2] < pt[2])    // point is outside Z boundaries
+      );
+    }
+
+  private:
+    Point3D_t _min; ///< Minimum point
+    Point3D_t _max; ///< Maximum point
+  };
+
+  /// Fixed-size version of Trajectory: an ordered list of 3D points
+  typedef std::vector<Point3D_t> Trajectory3D_t;
+
+  /// Convert a dynamic Trajectory into a fixed-size one (throws if not 3D)
+  Trajectory3D_t ToTrajectory3D(const Trajectory_t& trj);
+
+  class PackedTrajectories; // see GeoPackedTrajectories.h
+
+  /**
+     \class GeoAlgo3D
+     @brief Fixed-size 3D version of the distance and closest approach algorithms of GeoAlgo.
+     The algorithms are the same as GeoAlgo ones (both are the templates of GeoAlgoImpl.h),
+     and give the same results, but they work on Point3D_t and the other fixed-size objects:
+     no temporary vector is allocated on the heap, and no dimension is checked at run time.
+     Dynamic objects can be converted with the explicit constructors of the fixed-size ones
+     (and with ToTrajectory3D()).
+
+     The batch versions of the point & trajectory distance work on trajectories packed in a
+     PackedTrajectories: the distances from all the segments are computed in one vectorizable
+     loop, then the closest segment is picked. Results are the same as SqDist(pt, trj); for a
+     trajectory with a single point, the distance is kINVALID_DOUBLE and the segment index -1.
+     The segment distances are stored in a BatchWorkspace provided by the caller, and the
+     results in vectors which are resized as needed: reusing both across calls, no memory is
+     allocated.
+
+     Most functions are taken from the reference Real-Time-Collision-Detection (RTCD):
+     Ref: http://realtimecollisiondetection.net
+  */
+  class GeoAlgo3D {
+
+  public:
+    //
+    // Point and line segment
+    //
+    /// Point & LineSegment distance
+    double SqDist(const Point3D_t& pt, const LineSegment3D& seg) const
+    {
+      return details::SqDist(pt, seg.Start(), seg.End());
+    }
+    /// Point & LineSegment distance
+    double SqDist(const LineSegment3D& seg, const Point3D_t& pt) const { return SqDist(pt, seg); }
+    /// Point & LineSegment closest point
+    Point3D_t ClosestPt(const Point3D_t& pt, const LineSegment3D& seg) const;
+    /// Point & LineSegment closest point
+    Point3D_t ClosestPt(const LineSegment3D& seg, const Point3D_t& pt) const
+    {
+      return ClosestPt(pt, seg);
+    }
+
+    //
+    // Point and half line
+    //
+    /// Point & HalfLine distance
+    double SqDist(const Point3D_t& pt, const HalfLine3D& hline) const;
+    /// Point & HalfLine distance
+    double SqDist(const HalfLine3D& hline, const Point3D_t& pt) const { return SqDist(pt, hline); }
+    /// Point & HalfLine closest point
+    Point3D_t ClosestPt(const Point3D_t& pt, const HalfLine3D& hline) const;
+    /// Point & HalfLine closest point
+    Point3D_t ClosestPt(const HalfLine3D& hline, const Point3D_t& pt) const
+    {
+      return ClosestPt(pt, hline);
+    }
+
+    //
+    // Point and box
+    //
+    /// Point & AABox distance (to the closest wall, if the point is inside)
+    double SqDist(const Point3D_t& pt, const AABox3D& box) const;
+    /// Point & AABox distance (to the closest wall, if the point is inside)
+    double SqDist(const AABox3D& box, const Point3D_t& pt) const { return SqDist(pt, box); }
+    /// Point & AABox closest point
+    Point3D_t ClosestPt(const Point3D_t& pt, const AABox3D& box) const;
+    /// Point & AABox closest point
+    Point3D_t ClosestPt(const AABox3D& box, const Point3D_t& pt) const
+    {
+      return ClosestPt(pt, box);
+    }
+
+    //
+    // Two line segments
+    //
+    /// LineSegment & LineSegment distance - keep track of points
+    double SqDist(const LineSegment3D& seg1,
+                  const LineSegment3D& seg2,
+                  Point3D_t& c1,
+                  Point3D_t& c2) const;
+    /// LineSegment & LineSegment distance
+    double SqDist(const LineSegment3D& seg1, const LineSegment3D& seg2) const
+    {
+      Point3D_t c1;
+      Point3D_t c2;
+      return SqDist(seg1, seg2, c1, c2);
+    }
+
+    //
+    // Half line and line segment
+    //
+    /// HalfLine & LineSegment distance - keep track of points
+    double SqDist(const HalfLine3D& hline,
+                  const LineSegment3D& seg,
+                  Point3D_t& L1,
+                  Point3D_t& L2) const;
+    /// HalfLine & LineSegment distance
+    double SqDist(const HalfLine3D& hline, const LineSegment3D& seg) const
+    {
+      Point3D_t L1;
+      Point3D_t L2;
+      return SqDist(hline, seg, L1, L2);
+    }
+
+    //
+    // Trajectories
+    //
+    /// Point & Trajectory distance
+    double SqDist(const Point3D_t& pt, const Trajectory3D_t& trj) const;
+    /// Point & Trajectory distance
+    double SqDist(const Trajectory3D_t& trj, const Point3D_t& pt) const { return SqDist(pt, trj); }
+    /// Point & Trajectory closest point. Keep track of index of segment
+    Point3D_t ClosestPt(const Point3D_t& pt, const Trajectory3D_t& trj, int& idx) const;
+    /// Point & Trajectory closest point
+    Point3D_t ClosestPt(const Point3D_t& pt, const Trajectory3D_t& trj) const
+    {
+      int idx = 0;
+      return ClosestPt(pt, trj, idx);
+    }
+
+    /// LineSegment & Trajectory distance - keep track of points
+    double SqDist(const LineSegment3D& seg,
+                  const Trajectory3D_t& trj,
+                  Point3D_t& c1,
+                  Point3D_t& c2) const;
+    /// LineSegment & Trajectory distance
+    double SqDist(const LineSegment3D& seg, const Trajectory3D_t& trj) const
+    {
+      Point3D_t c1;
+      Point3D_t c2;
+      return SqDist(seg, trj, c1, c2);
+    }
+
+    /// Trajectory & Trajectory distance - keep track of points
+    double SqDist(const Trajectory3D_t& trj1,
+                  const Trajectory3D_t& trj2,
+                  Point3D_t& c1,
+                  Point3D_t& c2) const;
+    /// Trajectory & Trajectory distance
+    double SqDist(const Trajectory3D_t& trj1, const Trajectory3D_t& trj2) const
+    {
+      Point3D_t c1;
+      Point3D_t c2;
+      return SqDist(trj1, trj2, c1, c2);
+    }
+
+    /// HalfLine & Trajectory distance - keep track of points
+    double SqDist(const HalfLine3D& hline,
+                  const Trajectory3D_t& trj,
+                  Point3D_t& c1,
+                  Point3D_t& c2) const;
+    /// HalfLine & Trajectory distance
+    double SqDist(const HalfLine3D& hline, const Trajectory3D_t& trj) const
+    {
+      Point3D_t c1;
+      Point3D_t c2;
+      return SqDist(hline, trj, c1, c2);
+    }
+
+    //
+    // Batch point and packed trajectories
+    //
+    /**
+       @brief Buffers of the batch distance algorithms, to be reused across calls.
+       The buffers only grow, so that once they are large enough no memory is allocated.
+       A workspace must not be used by more than one thread at a time.
+    */
+    class BatchWorkspace {
+      friend class GeoAlgo3D;
+
+    private:
+      /// Returns a buffer for at least n segment distances
+      double* SegDists(size_t n)
+      {
+        if (_segDists.size() < n) _segDists.resize(n);
+        return _segDists.data();
+      }
+
+      std::vector<double> _segDists; ///< Squared distances from each segment
+    };
+
+    /// Many Points & one packed Trajectory (number iTrj) distances and closest segment indices
+    /// (dists and segIdx are resized to the number of points)
+    void SqDist(const std::vector<Point3D_t>& pts,
+                const PackedTrajectories& trjs,
+                size_t iTrj,
+                std::vector<double>& dists,
+                std::vector<int>& segIdx,
+                BatchWorkspace& work) const;
+    /// One Point & each packed Trajectory distance and closest segment index
+    /// (dists and segIdx are resized to the number of trajectories)
+    void SqDist(const Point3D_t& pt,
+                const PackedTrajectories& trjs,
+                std::vector<double>& dists,
+                std::vector<int>& segIdx,
+                BatchWorkspace& work) const;
+    /// Point & closest packed Trajectory distance - keep track of trajectory and segment
+    double SqDist(const Point3D_t& pt,
+                  const PackedTrajectories& trjs,
+                  int& trackIdx,
+                  int& segIdx,
+                  BatchWorkspace& work) const;
+  };
+}
+
+#endif
+/** @} */ // end of doxygen group
@@ -0,0 +1,393 @@
+/**
+ * \file GeoAlgoImpl.h
+ *
+ * \ingroup GeoAlgo
+ *
+ * \brief Distance and closest point algorithms shared by GeoAlgo and GeoAlgo3D
+ */
+
+/** \addtogroup GeoAlgo
+
+    @{*/
+#ifndef BASICTOOL_GEOALGOIMPL_H
+#define BASICTOOL_GEOALGOIMPL_H
+
+#include "larcorealg/GeoAlgo/GeoAlgoConstants.h"
+#include "larcorealg/GeoAlgo/GeoAlgoException.h"
+
+#include <stddef.h>
+
+/**
+   The algorithms of GeoAlgo and GeoAlgo3D, written once as templates on the point and object
+   types. They work with geoalgo::Vector (and the dynamic objects) as well as with
+   geoalgo::VectorN (and the fixed-size objects): the point type must provide size(),
+   operator[], the vector operators and SqLength(); the segments must provide Start(), End()
+   and Dir() (end - start), the half lines Start() and Dir() (normalized), the boxes Min(),
+   Max() and Contain(). No dimension is checked here: GeoAlgo checks them before calling.
+
+   Most functions are taken from the reference Real-Time-Collision-Detection (RTCD):
+   Ref: http://realtimecollisiondetection.net
+*/
+namespace geoalgo::details {
+
+  /// Clamp function: if n is out of bounds w.r.t. min & max, return the boundary
+  inline double Clamp(const double n, const double min, const double max)
+  {
+    if (n < min) { return min; }
+    if (n > max) { return max; }
+    return n;
+  }
+
+  /// Squared distance between two points, w/o temporary vector
+  template <typename Point>
+  double SqDist(const Point& pt1, const Point& pt2)
+  {
+    double dist = 0.;
+    for (size_t i = 0; i < pt1.size(); ++i)
+      dist += (pt1[i] - pt2[i]) * (pt1[i] - pt2[i]);
+    return dist;
+  }
+
+  /// Point & segment (start and end points) distance. Ref. RTCD Ch 5.1 p. 130
+  template <typename Point>
+  double SqDist(const Point& pt, const Point& line_s, const Point& line_e)
+  {
+    auto const ab = line_e - line_s;
+    auto const ac = pt - line_s;
+    auto const bc = pt - line_e;
+    auto e = ac * ab;
+    if (e <= 0.) return ac.SqLength();
+    auto f = ab.SqLength();
+    if (e >= f) return bc.SqLength();
+    return (ac.SqLength() - e * e / f);
+  }
+
+  /// Point & LineSegment closest point. Ref. RTCD Ch 5.1 p. 128-129
+  template <typename Point, typename Segment>
+  Point ClosestPtOnSegment(const Point& pt, const Segment& seg)
+  {
+    auto const& ab = seg.Dir();
+    // Project pt on line (ab), but deferring divide by ab * ab
+    auto t = ((pt - seg.Start()) * ab);
+    // pt projects outside line, on the start side; clamp to start
+    if (t <= 0.) return seg.Start();
+    auto denom = ab.SqLength();
+    // pt projects outside line, on the end side; clamp to end
+    if (t >= denom) return seg.End();
+    // pt projects inside the line. must deferred divide now
+    return (seg.Start() + ab * (t / denom));
+  }
+
+  /// Point & HalfLine distance. Ref. RTCD Ch 5.1 p. 130
+  template <typename Point, typename HalfLine>
+  double SqDistFromHalfLine(const Point& pt, const HalfLine& hline)
+  {
+    auto const& ab = hline.Dir();
+    auto const ac = pt - hline.Start();
+
+    auto e = ac * ab;
+    if (e <= 0.) return (ac * ac);
+    auto f = ab.SqLength();
+    return (ac.SqLength() - e * e / f);
+  }
+
+  /// Point & HalfLine closest point. Ref. RTCD Ch 5.1 p. 128-129
+  template <typename Point, typename HalfLine>
+  Point ClosestPtOnHalfLine(const Point& pt, const HalfLine& hline)
+  {
+    auto const& ab = hline.Dir();
+    auto t = (pt - hline.Start()) * ab;
+    if (t <= 0.) return hline.Start();
+    auto denom = ab.Length();
+    return (hline.Start() + ab * (t / denom));
+  }
+
+  /// Point & AABox distance (to the closest wall, if the point is inside) (3D only).
+  /// Ref. RTCD Ch 5.1 p. 131-132 ... modified to consider distance to the box's wall
+  template <typename Point, typename Box>
+  double SqDistFromBox(const Point& pt, const Box& box)
+  {
+    double dist = kINVALID_DOUBLE;
+
+    // If a point is inside the box, simply compute the smallest perpendicular distance
+    if (box.Contain(pt)) {
+
+      auto const& pt_min = box.Min();
+      auto const& pt_max = box.Max();
+      // (1) Compute the distance to the YZ wall
+      double dist_to_yz = pt[0] - pt_min[0];
+      if (dist_to_yz > (pt_max[0] - pt[0])) dist_to_yz = pt_max[0] - pt[0];
+
+      // (2) Compute the distance to the XZ wall
+      double dist_to_zx = pt[1] - pt_min[1];
+      if (dist_to_zx > (pt_max[1] - pt[1])) dist_to_zx = pt_max[1] - pt[1];
+
+      // (3) Compute the distance to the XY wall
+      double dist_to_xy = pt[2] - pt_min[2];
+      if (dist_to_xy > (pt_max[2] - pt[2])) dist_to_xy = pt_max[2] - pt[2];
+
+      // (4) Compute the minimum of (3), (4), and (5)
+      dist = (dist_to_yz < dist_to_zx ? dist_to_yz : dist_to_zx);
+      dist = (dist < dist_to_xy ? dist : dist_to_xy);
+      dist *= dist;
+    }
+
+    else {
+      // This refers to Ref. RTCD 5.1.3.1
+      // re-set distance
+      dist = 0;
+      for (size_t i = 0; i < pt.size(); ++i) {
+
+        auto const& v_pt = pt[i];
+        auto const& v_max = box.Max()[i];
+        auto const& v_min = box.Min()[i];
+
+        if (v_pt < v_min) dist += (v_min - v_pt) * (v_min - v_pt);
+        if (v_pt > v_max) dist += (v_pt - v_max) * (v_pt - v_max);
+      }
+    }
+    return dist;
+  }
+
+  /// Point & AABox closest point.
+  /// Ref. RTCD Ch 5.1 p. 130-131 ... modified to consider a point on the surface
+  template <typename Point, typename Box>
+  Point ClosestPtInBox(const Point& pt, const Box& box)
+  {
+    // For each coordinate axis, if the point coordinate value is outside box,
+    // clamp it to the box, else keep it as is
+    auto res = pt;
+    for (size_t i = 0; i < pt.size(); ++i) {
+      if (pt[i] < box.Min()[i]) res[i] = box.Min()[i];
+      if (pt[i] > box.Max()[i]) res[i] = box.Max()[i];
+    }
+    return res;
+  }
+
+  /// LineSegment & LineSegment distance - keep track of points.
+  /// Ref. RTCD Sec. 5.1.9 - pg. 148-150
+  template <typename Segment, typename Point>
+  double SqDistSegments(const Segment& seg1, const Segment& seg2, Point& c1, Point& c2)
+  {
+    double t1, t2;
+
+    auto const& s1 = seg1.Start();
+    auto const& s2 = seg2.Start();
+
+    auto const& d1 = seg1.Dir();
+    auto const& d2 = seg2.Dir();
+    auto const r = s1 - s2;
+
+    double a = d1.SqLength();
+    double e = d2.SqLength();
+    double f = d2 * r;
+
+    // check if segment is too short
+    if ((a <= 0) and (e <= 0)) {
+      //both segments are too short
+      c1 = s1;
+      c2 = s2;
+      return SqDist(c1, c2);
+    }
+    if (a <= 0) {
+      //first segment degenerates into a point
+      t1 = 0.;
+      t2 = Clamp(f / e, 0., 1.);
+    }
+    else {
+      double c = d1 * r;
+      if (e <= 0) {
+        //second segment degenerates into a point
+        t2 = 0.;
+        t1 = Clamp(-c / a, 0., 1.);
+      }
+      else {
+        // the general case...no degeneracies
+        double b = d1 * d2;
+        double denom = (a * e) - (b * b);
+
+        if (denom != 0.)
+          t1 = Clamp((b * f - c * e) / denom, 0., 1.);
+        else
+          t1 = 0.;
+
+        t2 = (b * t1 + f) / e;
+
+        if (t2 < 0.) {
+          t2 = 0.;
+          t1 = Clamp(-c / a, 0., 1.);
+        }
+        else if (t2 > 1.) {
+          t2 = 1.;
+          t1 = Clamp((b - c) / a, 0., 1.);
+        }
+      }
+    }
+
+    c1 = s1 + d1 * t1;
+    c2 = s2 + d2 * t2;
+
+    return SqDist(c1, c2);
+  }
+
+  /// HalfLine & LineSegment distance - keep track of points.
+  /// Same as for two infinite lines, but checking whether s & t go out of bounds.
+  template <typename HalfLine, typename Segment, typename Point>
+  double SqDistHalfLineSegment(const HalfLine& hline, const Segment& seg, Point& L1, Point& L2)
+  {
+    auto const& d1 = hline.Dir();
+    auto const& d2 = seg.Dir();
+    auto const r = hline.Start() - seg.Start();
+
+    double a = d1 * d1;
+    double b = d1 * d2;
+    double c = d1 * r;
+    double e = d2 * d2;
+    double f = d2 * r;
+
+    double d = a * e - b * b;
+
+    // if parallel then d == 0
+    if (d == 0) {
+      // distance is smallest quantity between the distances of segment ends from line
+      double sDist = SqDistFromHalfLine(seg.Start(), hline);
+      double eDist = SqDistFromHalfLine(seg.End(), hline);
+      if (sDist <= eDist) {
+        L1 = ClosestPtOnHalfLine(seg.Start(), hline);
+        L2 = seg.Start();
+        return sDist;
+      }
+      else {
+        L1 = ClosestPtOnHalfLine(seg.End(), hline);
+        L2 = seg.End();
+        return eDist;
+      }
+    } // if parallel
+
+    double s = (b * f - c * e) / d;
+
+    // closest point on half-line is start:
+    // re-evaluate closest point on segment using line start point
+    if (s < 0) {
+      L1 = hline.Start();
+      L2 = ClosestPtOnSegment(L1, seg);
+      return SqDist(L1, L2);
+    }
+
+    // if t > 0 && < 1 then the two lines intersect
+    double t = (a * f - b * c) / d;
+    if ((t < 1) and (t > 0)) {
+      L1 = hline.Start() + d1 * s;
+      L2 = seg.Start() + d2 * t;
+      return SqDist(L1, L2);
+    }
+    // if out of bounds clamp, then re-evaluate closest point on line
+    t = Clamp(t, 0, 1);
+    L2 = seg.Start() + d2 * t;
+    L1 = ClosestPtOnHalfLine(L2, hline);
+    return SqDist(L1, L2);
+  }
+
+  /// Point & Trajectory distance: the shortest distance from any of its segments
+  template <typename Point, typename Trajectory>
+  double SqDistFromTrajectory(const Point& pt, const Trajectory& trj)
+  {
+    double distMin = kINVALID_DOUBLE;
+    for (size_t l = 0; l < trj.size() - 1; l++) {
+      double distTmp = SqDist(pt, trj[l], trj[l + 1]);
+      if (distTmp < distMin) { distMin = distTmp; }
+    }
+    return distMin;
+  }
+
+  /// Point & Trajectory closest point, on the segment (number idx) at the shortest distance.
+  /// A trajectory with a single point is its closest point (idx is 0).
+  template <typename Segment, typename Point, typename Trajectory>
+  Point ClosestPtOnTrajectory(const Point& pt, const Trajectory& trj, int& idx)
+  {
+    if (trj.size() == 1) {
+      idx = 0;
+      return trj[0];
+    }
+
+    double distMin = kINVALID_DOUBLE;
+    for (size_t l = 0; l < trj.size() - 1; l++) {
+      double distTmp = SqDist(pt, trj[l], trj[l + 1]);
+      if (distTmp < distMin) {
+        distMin = distTmp;
+        idx = l;
+      }
+    }
+    return ClosestPtOnSegment(pt, Segment(trj[idx], trj[idx + 1]));
+  }
+
+  /// Object & Trajectory distance, with the object distance from a segment given by segDist
+  /// (with its closest points). Keep track of the points of the closest segment.
+  template <typename Segment, typename Trajectory, typename Point, typename SegDist>
+  double SqDistFromTrajectorySegments(const Trajectory& trj,
+                                      Point& c1,
+                                      Point& c2,
+                                      SegDist segDist)
+  {
+    Point c1min;
+    Point c2min;
+    double distMin = kMAX_DOUBLE;
+    for (size_t l = 0; l < trj.size() - 1; l++) {
+      double distTmp = segDist(Segment(trj[l], trj[l + 1]), c1min, c2min);
+      if (distTmp < distMin) {
+        c1 = c1min;
+        c2 = c2min;
+        distMin = distTmp;
+      }
+    } //for all segments in the track
+    return distMin;
+  }
+
+  /// LineSegment & Trajectory distance - keep track of points
+  template <typename Segment, typename Trajectory, typename Point>
+  double SqDistSegmentTrajectory(const Segment& seg, const Trajectory& trj, Point& c1, Point& c2)
+  {
+    return SqDistFromTrajectorySegments<Segment>(
+      trj, c1, c2, [&seg](const Segment& segTmp, Point& c1min, Point& c2min) {
+        return SqDistSegments(segTmp, seg, c1min, c2min);
+      });
+  }
+
+  /// Trajectory & Trajectory distance - keep track of points
+  template <typename Segment, typename Trajectory, typename Point>
+  double SqDistTrajectories(const Trajectory& trj1, const Trajectory& trj2, Point& c1, Point& c2)
+  {
+    Point c1min;
+    Point c2min;
+    double distMin = kMAX_DOUBLE;
+    for (size_t l1 = 0; l1 < trj1.size() - 1; l1++) {
+      Segment const segTmp1(trj1[l1], trj1[l1 + 1]);
+      for (size_t l2 = 0; l2 < trj2.size() - 1; l2++) {
+        double distTmp = SqDistSegments(segTmp1, Segment(trj2[l2], trj2[l2 + 1]), c1min, c2min);
+        if (distTmp < distMin) {
+          c1 = c1min;
+          c2 = c2min;
+          distMin = distTmp;
+        }
+      } // for segments in trajectory 2
+    }   //for all segments in trajectory 1
+    return distMin;
+  }
+
+  /// HalfLine & Trajectory distance - keep track of points
+  template <typename Segment, typename HalfLine, typename Trajectory, typename Point>
+  double SqDistHalfLineTrajectory(const HalfLine& hline,
+                                  const Trajectory& trj,
+                                  Point& c1,
+                                  Point& c2)
+  {
+    return SqDistFromTrajectorySegments<Segment>(
+      trj, c1, c2, [&hline](const Segment& segTmp, Point& c1min, Point& c2min) {
+        return SqDistHalfLineSegment(hline, segTmp, c1min, c2min);
+      });
+  }
+
+}
+
+#endif
+/** @} */ // end of doxygen group
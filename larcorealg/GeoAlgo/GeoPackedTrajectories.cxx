@@ -0,0 +1,37 @@
+#include "larcorealg/GeoAlgo/GeoPackedTrajectories.h"
+#include "larcorealg/GeoAlgo/GeoAlgoException.h"
+
+namespace geoalgo {
+
+  PackedTrajectories::PackedTrajectories(const std::vector<Trajectory_t>& trjs)
+    : PackedTrajectories()
+  {
+    for (auto const& trj : trjs)
+      Add(trj);
+  }
+
+  PackedTrajectories::PackedTrajectories(const std::vector<Trajectory3D_t>& trjs)
+    : PackedTrajectories()
+  {
+    for (auto const& trj : trjs)
+      Add(trj);
+  }
+
+  void PackedTrajectories::Add(const Trajectory_t& trj)
+  {
+    // convert all the points first, so that nothing is added if any is not 3D
+    Add(ToTrajectory3D(trj));
+  }
+
+  void PackedTrajectories::Add(const Trajectory3D_t& trj)
+  {
+    if (!trj.size()) throw GeoAlgoException("Trajectory object not properly set...");
+    for (auto const& pt : trj) {
+      _x.push_back(pt[0]);
+      _y.push_back(pt[1]);
+      _z.push_back(pt[2]);
+    }
+    _first.push_back(_x.size());
+  }
+
+}
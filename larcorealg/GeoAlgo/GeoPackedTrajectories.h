@@ -0,0 +1,86 @@
+/**
+ * \file GeoPackedTrajectories.h
+ *
+ * \ingroup GeoAlgo
+ *
+ * \brief Class def header for a class PackedTrajectories
+ */
+
+/** \addtogroup GeoAlgo
+
+    @{*/
+#ifndef BASICTOOL_GEOPACKEDTRAJECTORIES_H
+#define BASICTOOL_GEOPACKEDTRAJECTORIES_H
+
+#include "larcorealg/GeoAlgo/GeoAlgo3D.h" // Trajectory3D_t
+#include "larcorealg/GeoAlgo/GeoTrajectory.h"
+#include "larcorealg/GeoAlgo/GeoVectorN.h"
+
+#include <stddef.h>
+#include <vector>
+
+namespace geoalgo {
+
+  /**
+     \class PackedTrajectories
+     @brief Many 3D trajectories packed in a structure of arrays, for batch distance queries.
+     The points of all the trajectories are stored one after the other, in one array for each
+     coordinate, so that the segments of a trajectory can be processed by vectorized loops
+     (see GeoAlgo3D batch SqDist()). Trajectories are numbered in the order they are added.
+  */
+  class PackedTrajectories {
+
+  public:
+    /// Default ctor: no trajectories
+    PackedTrajectories() : _first(1, 0) {}
+
+    /// Ctor w/ a list of dynamic trajectories (throws if any is empty or not 3D)
+    explicit PackedTrajectories(const std::vector<Trajectory_t>& trjs);
+
+    /// Ctor w/ a list of fixed-size trajectories (throws if any is empty)
+    explicit PackedTrajectories(const std::vector<Trajectory3D_t>& trjs);
+
+    /// Add a dynamic trajectory at the end (throws if it is empty or not 3D)
+    void Add(const Trajectory_t& trj);
+
+    /// Add a fixed-size trajectory at the end (throws if it is empty)
+    void Add(const Trajectory3D_t& trj);
+
+    /// Number of trajectories
+    size_t NTrajectories() const { return _first.size() - 1; }
+
+    /// Number of points in all trajectories
+    size_t NPoints() const { return _x.size(); }
+
+    /// Index of the first point of trajectory i
+    size_t FirstPoint(size_t i) const { return _first[i]; }
+
+    /// Number of points of trajectory i
+    size_t NPoints(size_t i) const { return _first[i + 1] - _first[i]; }
+
+    /// Number of segments of trajectory i
+    size_t NSegments(size_t i) const { return NPoints(i) - 1; }
+
+    /// Point number j of all trajectories
+    Point3D_t Point(size_t j) const { return {_x[j], _y[j], _z[j]}; }
+
+    /// Segment number s of trajectory i
+    LineSegment3D Segment(size_t i, size_t s) const
+    {
+      return {Point(_first[i] + s), Point(_first[i] + s + 1)};
+    }
+
+    const double* X() const { return _x.data(); } ///< x coordinates of all points
+    const double* Y() const { return _y.data(); } ///< y coordinates of all points
+    const double* Z() const { return _z.data(); } ///< z coordinates of all points
+
+  private:
+    std::vector<double> _x;     ///< x coordinate of all points
+    std::vector<double> _y;     ///< y coordinate of all points
+    std::vector<double> _z;     ///< z coordinate of all points
+    std::vector<size_t> _first; ///< First point of each trajectory, then total
+  };
+}
+
+#endif
+/** @} */ // end of doxygen group
@@ -0,0 +1,268 @@
+#include "larcorealg/GeoAlgo/GeoTrajectoryTree.h"
+#include "larcorealg/GeoAlgo/GeoAlgoConstants.h" // for kINVALID_DOUBLE
+#include "larcorealg/GeoAlgo/GeoAlgoException.h" // for GeoAlgoException
+
+#include <algorithm>
+#include <stddef.h>
+#include <tuple>   // std::tie()
+#include <utility> // std::swap()
+
+namespace {
+
+  // Maximum number of segments in a leaf of the tree
+  constexpr size_t kLeafSize = 4;
+
+  // Maximum depth of the tree, checked when building it: the tree is balanced, so this is
+  // plenty. A depth-first visit never holds more than kMaxDepth + 1 nodes in its stack.
+  constexpr size_t kMaxDepth = 64;
+
+  // Box containing a segment
+  geoalgo::AABox3D SegmentBox_(const geoalgo::LineSegment3D& seg)
+  {
+    geoalgo::Point3D_t min, max;
+    for (size_t i = 0; i < 3; ++i) {
+      min[i] = std::min(seg.Start()[i], seg.End()[i]);
+      max[i] = std::max(seg.Start()[i], seg.End()[i]);
+    }
+    return {min, max};
+  }
+
+  // Box containing two boxes
+  geoalgo::AABox3D MergeBoxes_(const geoalgo::AABox3D& a, const geoalgo::AABox3D& b)
+  {
+    geoalgo::Point3D_t min, max;
+    for (size_t i = 0; i < 3; ++i) {
+      min[i] = std::min(a.Min()[i], b.Min()[i]);
+      max[i] = std::max(a.Max()[i], b.Max()[i]);
+    }
+    return {min, max};
+  }
+
+  // Squared distance between two boxes (0 if they overlap): a lower bound for the distance
+  // between anything contained in them
+  double BoxSqDist_(const geoalgo::AABox3D& a, const geoalgo::AABox3D& b)
+  {
+    double dist = 0.;
+    for (size_t i = 0; i < 3; ++i) {
+      double const gap = std::max({a.Min()[i] - b.Max()[i], b.Min()[i] - a.Max()[i], 0.});
+      dist += gap * gap;
+    }
+    return dist;
+  }
+
+}
+
+namespace geoalgo {
+
+  TrajectoryTree::TrajectoryTree(const std::vector<Trajectory_t>& trjs)
+  {
+    std::vector<LineSegment3D> segs;
+    for (auto const& trj : trjs) {
+      if (!trj.size()) throw GeoAlgoException("Trajectory object not properly set...");
+      AddSegments_(ToTrajectory3D(trj), segs); // throws if not 3D
+    }
+    Build_(segs);
+  }
+
+  TrajectoryTree::TrajectoryTree(const std::vector<Trajectory3D_t>& trjs)
+  {
+    std::vector<LineSegment3D> segs;
+    for (auto const& trj : trjs)
+      AddSegments_(trj, segs);
+    Build_(segs);
+  }
+
+  void TrajectoryTree::AddSegments_(const Trajectory3D_t& trj, std::vector<LineSegment3D>& segs)
+  {
+    if (!trj.size()) throw GeoAlgoException("Trajectory object not properly set...");
+    int const trackIdx = _nTrajectories++;
+    for (size_t l = 0; l + 1 < trj.size(); ++l) {
+      segs.emplace_back(trj[l], trj[l + 1]);
+      _ids.emplace_back(trackIdx, l);
+    }
+  }
+
+  void TrajectoryTree::Build_(const std::vector<LineSegment3D>& segs)
+  {
+    if (segs.empty()) return;
+
+    std::vector<size_t> order(segs.size());
+    for (size_t k = 0; k < order.size(); ++k)
+      order[k] = k;
+    _nodes.reserve(2 * (segs.size() / kLeafSize + 1));
+    if (BuildNode_(segs, order, 0, order.size(), 0) > kMaxDepth)
+      throw GeoAlgoException("<<TrajectoryTree>> tree too deep!");
+
+    // sort the segments and their identifiers in leaf order
+    std::vector<SegmentID_t> ids;
+    _segments.reserve(segs.size());
+    ids.reserve(segs.size());
+    for (size_t k : order) {
+      _segments.push_back(segs[k]);
+      ids.push_back(_ids[k]);
+    }
+    _ids = std::move(ids);
+  }
+
+  // Top-down build: split the segments in two halves at the median of their centers along
+  // the direction where the centers are most spread
+  size_t TrajectoryTree::BuildNode_(const std::vector<LineSegment3D>& segs,
+                                    std::vector<size_t>& order,
+                                    size_t first,
+                                    size_t last,
+                                    size_t depth)
+  {
+    AABox3D box = SegmentBox_(segs[order[first]]);
+    Point3D_t cmin = (segs[order[first]].Start() + segs[order[first]].End()) / 2.;
+    Point3D_t cmax = cmin;
+    for (size_t k = first + 1; k < last; ++k) {
+      auto const& seg = segs[order[k]];
+      box = MergeBoxes_(box, SegmentBox_(seg));
+      Point3D_t const center = (seg.Start() + seg.End()) / 2.;
+      for (size_t i = 0; i < 3; ++i) {
+        cmin[i] = std::min(cmin[i], center[i]);
+        cmax[i] = std::max(cmax[i], center[i]);
+      }
+    }
+
+    size_t const node = _nodes.size();
+    _nodes.push_back({box, first, last - first, 0});
+    if (last - first <= kLeafSize) return depth;
+
+    size_t axis = 0;
+    for (size_t i = 1; i < 3; ++i) {
+      if (cmax[i] - cmin[i] > cmax[axis] - cmin[axis]) axis = i;
+    }
+    size_t const middle = first + (last - first) / 2;
+    std::nth_element(order.begin() + first,
+                     order.begin() + middle,
+                     order.begin() + last,
+                     [&segs, axis](size_t a, size_t b) {
+                       double const ca = segs[a].Start()[axis] + segs[a].End()[axis];
+                       double const cb = segs[b].Start()[axis] + segs[b].End()[axis];
+                       return (ca < cb) || ((ca == cb) && (a < b));
+                     });
+
+    _nodes[node].count = 0;
+    // first child is the next node
+    size_t const leftDepth = BuildNode_(segs, order, first, middle, depth + 1);
+    _nodes[node].right = _nodes.size();
+    size_t const rightDepth = BuildNode_(segs, order, middle, last, depth + 1);
+    return std::max(leftDepth, rightDepth);
+  }
+
+  // Depth-first visit, nearest child first, skipping the boxes farther than the closest
+  // segment found so far. Boxes just as far are still visited, so that the first of equally
+  // close segments (in collection order) is found, as in GeoAlgo.
+  template <typename BoxDist, typename SegDist>
+  size_t TrajectoryTree::Closest_(BoxDist boxDist, SegDist segDist, double& minDist) const
+  {
+    size_t best = _segments.size();
+    if (_nodes.empty()) return best;
+
+    size_t stack[kMaxDepth + 1]; // one pending sibling per level, plus the node being visited
+    size_t nStack = 0;
+    stack[nStack++] = 0;
+    while (nStack > 0) {
+      Node const& node = _nodes[stack[--nStack]];
+      if (boxDist(node.box) > minDist) continue;
+
+      if (node.count) {
+        for (size_t k = node.first; k < node.first + node.count; ++k) {
+          double const distTmp = segDist(_segments[k]);
+          bool const tie = (distTmp == minDist) && (best < _segments.size());
+          if ((distTmp < minDist) || (tie && (_ids[k] < _ids[best]))) {
+            minDist = distTmp;
+            best = k;
+          }
+        }
+        continue;
+      }
+
+      size_t near = &node - _nodes.data() + 1;
+      size_t far = node.right;
+      if (boxDist(_nodes[far].box) < boxDist(_nodes[near].box)) std::swap(near, far);
+      stack[nStack++] = far;
+      stack[nStack++] = near;
+    }
+    return best;
+  }
+
+  double TrajectoryTree::SqDist(const Point3D_t& pt, int& trackIdx, int& segIdx) const
+  {
+    AABox3D const ptBox(pt, pt);
+    double minDist = kINVALID_DOUBLE;
+    size_t const best = Closest_([&ptBox](const AABox3D& box) { return BoxSqDist_(ptBox, box); },
+                                 [this, &pt](const LineSegment3D& seg) {
+                                   return _algo.SqDist(pt, seg);
+                                 },
+                                 minDist);
+    if (best < _segments.size()) std::tie(trackIdx, segIdx) = _ids[best];
+    return minDist;
+  }
+
+  Point3D_t TrajectoryTree::ClosestPt(const Point3D_t& pt, int& trackIdx, int& segIdx) const
+  {
+    AABox3D const ptBox(pt, pt);
+    double minDist = kINVALID_DOUBLE;
+    size_t const best = Closest_([&ptBox](const AABox3D& box) { return BoxSqDist_(ptBox, box); },
+                                 [this, &pt](const LineSegment3D& seg) {
+                                   return _algo.SqDist(pt, seg);
+                                 },
+                                 minDist);
+    if (best == _segments.size()) throw GeoAlgoException("No trajectory segment to look at...");
+    std::tie(trackIdx, segIdx) = _ids[best];
+    return _algo.ClosestPt(pt, _segments[best]);
+  }
+
+  // The box of the segment bounds its distance from the boxes of the tree
+  double TrajectoryTree::SqDist(const LineSegment3D& seg,
+                                Point3D_t& c1,
+                                Point3D_t& c2,
+                                int& trackIdx,
+                                int& segIdx) const
+  {
+    AABox3D const segBox = SegmentBox_(seg);
+    double minDist = kMAX_DOUBLE;
+    size_t const best = Closest_([&segBox](const AABox3D& box) { return BoxSqDist_(segBox, box); },
+                                 [this, &seg](const LineSegment3D& trjSeg) {
+                                   return _algo.SqDist(trjSeg, seg);
+                                 },
+                                 minDist);
+    if (best < _segments.size()) {
+      std::tie(trackIdx, segIdx) = _ids[best];
+      _algo.SqDist(_segments[best], seg, c1, c2);
+    }
+    return minDist;
+  }
+
+  void TrajectoryTree::WithinRadius(const Point3D_t& pt,
+                                    double radius,
+                                    std::vector<SegmentID_t>& ids) const
+  {
+    ids.clear();
+    if (_nodes.empty()) return;
+
+    AABox3D const ptBox(pt, pt);
+    double const maxDist = radius * radius;
+    size_t stack[kMaxDepth + 1]; // one pending sibling per level, plus the node being visited
+    size_t nStack = 0;
+    stack[nStack++] = 0;
+    while (nStack > 0) {
+      size_t const iNode = stack[--nStack];
+      Node const& node = _nodes[iNode];
+      if (BoxSqDist_(ptBox, node.box) > maxDist) continue;
+
+      if (node.count) {
+        for (size_t k = node.first; k < node.first + node.count; ++k) {
+          if (_algo.SqDist(pt, _segments[k]) <= maxDist) ids.push_back(_ids[k]);
+        }
+        continue;
+      }
+      stack[nStack++] = node.right;
+      stack[nStack++] = iNode + 1;
+    }
+    std::sort(ids.begin(), ids.end());
+  }
+
+}
@@ -0,0 +1,149 @@
+/**
+ * \file GeoTrajectoryTree.h
+ *
+ * \ingroup GeoAlgo
+ *
+ * \brief Class def header for a class TrajectoryTree
+ */
+
+/** \addtogroup GeoAlgo
+
+    @{*/
+#ifndef BASICTOOL_GEOTRAJECTORYTREE_H
+#define BASICTOOL_GEOTRAJECTORYTREE_H
+
+#include "larcorealg/GeoAlgo/GeoAlgo3D.h"
+#include "larcorealg/GeoAlgo/GeoTrajectory.h"
+#include "larcorealg/GeoAlgo/GeoVectorN.h"
+
+#include <stddef.h>
+#include <utility>
+#include <vector>
+
+namespace geoalgo {
+
+  /**
+     \class TrajectoryTree
+     @brief Bounding volume hierarchy of the segments of a collection of trajectories.
+     The segments are sorted in a binary tree of axis-aligned boxes (AABox3D), each box containing
+     the segments of its branch: a query visits only the boxes close enough to possibly hold an
+     answer, instead of all the segments of all the trajectories. The tree is built once for a
+     collection, and can then be queried many times.
+
+     The tree is the cache of the collection: the caller keeps it along with the collection,
+     and builds a new one when the collection changes. GeoAlgo does not cache trees by itself,
+     since telling whether a collection has changed would take reading all of it, which is
+     what the tree avoids.
+
+     The results are the same as GeoAlgo with a vector of trajectories, with the closest segment
+     being the first one in the collection order if more are at the same distance. Trajectories
+     with a single point have no segment, and are never found.
+  */
+  class TrajectoryTree {
+
+  public:
+    /// Segment identifier: index of the trajectory, index of the segment within it
+    typedef std::pair<int, int> SegmentID_t;
+
+    /// Default ctor: no trajectories
+    TrajectoryTree() = default;
+
+    /// Ctor w/ a list of dynamic trajectories (throws if any is empty or not 3D)
+    explicit TrajectoryTree(const std::vector<Trajectory_t>& trjs);
+
+    /// Ctor w/ a list of fixed-size trajectories (throws if any is empty)
+    explicit TrajectoryTree(const std::vector<Trajectory3D_t>& trjs);
+
+    /// Number of trajectories
+    size_t NTrajectories() const { return _nTrajectories; }
+
+    /// Number of segments in all trajectories
+    size_t NSegments() const { return _segments.size(); }
+
+    //
+    // Point and trajectories
+    //
+    /// Point & closest segment distance - keep track of trajectory and segment
+    double SqDist(const Point3D_t& pt, int& trackIdx, int& segIdx) const;
+    /// Point & closest segment distance
+    double SqDist(const Point3D_t& pt) const
+    {
+      int trackIdx = -1;
+      int segIdx = -1;
+      return SqDist(pt, trackIdx, segIdx);
+    }
+    /// Point & closest segment closest point - keep track of trajectory and segment
+    Point3D_t ClosestPt(const Point3D_t& pt, int& trackIdx, int& segIdx) const;
+
+    //
+    // Line segment and trajectories
+    //
+    /// LineSegment & closest segment distance - keep track of points (c1 on the trajectory)
+    /// and of trajectory and segment
+    double SqDist(const LineSegment3D& seg,
+                  Point3D_t& c1,
+                  Point3D_t& c2,
+                  int& trackIdx,
+                  int& segIdx) const;
+    /// LineSegment & closest segment distance
+    double SqDist(const LineSegment3D& seg) const
+    {
+      Point3D_t c1;
+      Point3D_t c2;
+      int trackIdx = -1;
+      int segIdx = -1;
+      return SqDist(seg, c1, c2, trackIdx, segIdx);
+    }
+
+    //
+    // Radius search
+    //
+    /// All the segments within a distance radius from a point, sorted by trajectory and segment
+    std::vector<SegmentID_t> WithinRadius(const Point3D_t& pt, double radius) const
+    {
+      std::vector<SegmentID_t> ids;
+      WithinRadius(pt, radius, ids);
+      return ids;
+    }
+    /// All the segments within a distance radius from a point, filled into ids (reused)
+    void WithinRadius(const Point3D_t& pt, double radius, std::vector<SegmentID_t>& ids) const;
+
+  private:
+    /// Box of a branch: leaves list their segments, other nodes have two children
+    struct Node {
+      AABox3D box;  ///< Box containing all the segments of the branch
+      size_t first; ///< First segment (leaf only)
+      size_t count; ///< Number of segments (0 if not a leaf)
+      size_t right; ///< Second child (not leaf only; the first is the next node)
+    };
+
+    /// Add the segments of the trajectory (throws if empty) in the collection order
+    void AddSegments_(const Trajectory3D_t& trj, std::vector<LineSegment3D>& segs);
+
+    /// Build the tree from the segments in the collection order
+    void Build_(const std::vector<LineSegment3D>& segs);
+
+    /// Build the branch of the segments from first to last in order, with its root at depth;
+    /// return the depth of its deepest leaf
+    size_t BuildNode_(const std::vector<LineSegment3D>& segs,
+                      std::vector<size_t>& order,
+                      size_t first,
+                      size_t last,
+                      size_t depth);
+
+    /// Index (in leaf order) of the segment closest to a query, w/ a distance lower bound
+    /// function of the node boxes and the exact distance function of the segments
+    template <typename BoxDist, typename SegDist>
+    size_t Closest_(BoxDist boxDist, SegDist segDist, double& minDist) const;
+
+    size_t _nTrajectories = 0;            ///< Number of trajectories
+    std::vector<Node> _nodes;             ///< Nodes, depth first (root is the first)
+    std::vector<LineSegment3D> _segments; ///< Segments, in leaf order
+    std::vector<SegmentID_t> _ids;        ///< Identifier of each segment, in leaf order
+
+    GeoAlgo3D _algo; ///< Algorithms for the segment distances
+  };
+}
+
+#endif
+/** @} */ // end of doxygen group
@@ -0,0 +1,233 @@
+/**
+ * \file GeoVectorN.h
+ *
+ * \ingroup GeoAlgo
+ *
+ * \brief Class def header for a class VectorN, a fixed-size Vector
+ */
+
+/** \addtogroup GeoAlgo
+
+    @{*/
+#ifndef BASICTOOL_GEOVECTORN_H
+#define BASICTOOL_GEOVECTORN_H
+
+#include "larcorealg/GeoAlgo/GeoAlgoConstants.h"
+#include "larcorealg/GeoAlgo/GeoAlgoException.h"
+#include "larcorealg/GeoAlgo/GeoVector.h"
+
+#include "TVector3.h"
+
+#include <array>
+#include <cmath>
+#include <ostream>
+#include <stddef.h>
+
+namespace geoalgo {
+
+  /**
+     \class VectorN
+     This class represents a vector with a dimension fixed at compile time.
+     It has the same interface as geoalgo::Vector, but it keeps its elements in place
+     (no heap allocation) and it needs no dimension check at run time.
+     Conversions from and to geoalgo::Vector are provided; the conversion from
+     geoalgo::Vector throws GeoAlgoException if the dimensions do not match.
+  */
+  template <size_t N>
+  class VectorN : public std::array<double, N> {
+
+  public:
+    /// Dimension of the vector
+    static constexpr size_t Dim = N;
+
+    /// Default ctor: all elements set to invalid value
+    VectorN() { this->fill(kINVALID_DOUBLE); }
+
+    /// Ctor w/ x, y & z (only 3D)
+    VectorN(const double x, const double y, const double z) : std::array<double, N>{{x, y, z}}
+    {
+      static_assert(N == 3, "Only 3-dimensional vectors can be constructed from x, y & z");
+    }
+
+    /// Ctor w/ TVector3 (only 3D)
+    VectorN(const TVector3& pt) : VectorN(pt[0], pt[1], pt[2]) {}
+
+    /// Ctor w/ a dynamic vector, which must have dimension N
+    explicit VectorN(const Vector& obj)
+    {
+      if (obj.size() != N)
+        throw GeoAlgoException("<<VectorN>> dimension mismatch with the dynamic vector!");
+      for (size_t i = 0; i < N; ++i)
+        (*this)[i] = obj[i];
+    }
+
+    /// Convert to a dynamic vector
+    Vector ToVector() const
+    {
+      Vector res(N);
+      for (size_t i = 0; i < N; ++i)
+        res[i] = (*this)[i];
+      return res;
+    }
+
+    /// Check if point is valid
+    bool IsValid() const
+    {
+      for (auto const& v : (*this))
+        if (v != kINVALID_DOUBLE) return true;
+      return false;
+    }
+
+    /// Compute the squared length of the vector
+    double SqLength() const { return Dot(*this); }
+
+    /// Compute the length of the vector
+    double Length() const { return std::sqrt(SqLength()); }
+
+    /// Normalize itself
+    void Normalize() { (*this) /= Length(); }
+
+    /// Return a direction unit vector
+    VectorN Dir() const { return (*this) / Length(); }
+
+    /// Compute the angle Phi (only 2D and 3D)
+    double Phi() const
+    {
+      static_assert(N == 2 || N == 3, "<<Phi>> only possible for 2 or 3-dimensional vectors!");
+      return (*this)[0] == 0.0 && (*this)[1] == 0.0 ? 0.0 : std::atan2((*this)[1], (*this)[0]);
+    }
+
+    /// Compute the angle theta (only 3D)
+    double Theta() const
+    {
+      static_assert(N == 3, "<<Theta>> Only possible for 3-dimensional vectors!");
+      return Length() == 0.0 ? 0.0 : std::acos((*this)[2] / Length());
+    }
+
+    /// Compute the squared distance to another vector
+    double SqDist(const VectorN& obj) const
+    {
+      double dist = 0;
+      for (size_t i = 0; i < N; ++i)
+        dist += ((*this)[i] - obj[i]) * ((*this)[i] - obj[i]);
+      return dist;
+    }
+
+    /// Compute the distance to another vector
+    double Dist(const VectorN& obj) const { return std::sqrt(SqDist(obj)); }
+
+    /// Compute a dot product of two vectors
+    double Dot(const VectorN& obj) const
+    {
+      double res = 0;
+      for (size_t i = 0; i < N; ++i)
+        res += (*this)[i] * obj[i];
+      return res;
+    }
+
+    /// Compute a cross product of two vectors (only 3D)
+    VectorN Cross(const VectorN& obj) const
+    {
+      static_assert(N == 3, "<<Cross>> only possible for 3-dimensional vectors!");
+      return {(*this)[1] * obj[2] - obj[1] * (*this)[2],
+              (*this)[2] * obj[0] - obj[2] * (*this)[0],
+              (*this)[0] * obj[1] - obj[0] * (*this)[1]};
+    }
+
+    /// Compute an opening angle w.r.t. the given vector (only 2D and 3D)
+    double Angle(const VectorN& obj) const
+    {
+      static_assert(N == 2 || N == 3, "<<Angle>> only possible for 2 or 3-dimensional vectors!");
+      return std::acos(Dot(obj) / Length() / obj.Length());
+    }
+
+    //
+    // binary/uniry operators
+    //
+    inline VectorN& operator+=(const VectorN& rhs)
+    {
+      for (size_t i = 0; i < N; ++i)
+        (*this)[i] += rhs[i];
+      return *this;
+    }
+
+    inline VectorN& operator-=(const VectorN& rhs)
+    {
+      for (size_t i = 0; i < N; ++i)
+        (*this)[i] -= rhs[i];
+      return *this;
+    }
+
+    inline VectorN& operator*=(const double rhs)
+    {
+      for (auto& v : *this)
+        v *= rhs;
+      return *this;
+    }
+
+    inline VectorN& operator/=(const double rhs)
+    {
+      for (auto& v : *this)
+        v /= rhs;
+      return *this;
+    }
+
+    inline VectorN operator+(const VectorN& rhs) const
+    {
+      VectorN res((*this));
+      res += rhs;
+      return res;
+    }
+
+    inline VectorN operator-(const VectorN& rhs) const
+    {
+      VectorN res((*this));
+      res -= rhs;
+      return res;
+    }
+
+    inline double operator*(const VectorN& rhs) const { return Dot(rhs); }
+
+    inline VectorN operator*(const double& rhs) const
+    {
+      VectorN res((*this));
+      res *= rhs;
+      return res;
+    }
+
+    inline VectorN operator/(const double& rhs) const
+    {
+      VectorN res((*this));
+      res /= rhs;
+      return res;
+    }
+
+    inline bool operator==(const VectorN& rhs) const
+    {
+      for (size_t i = 0; i < N; ++i)
+        if ((*this)[i] != rhs[i]) return false;
+      return true;
+    }
+
+    inline bool operator!=(const VectorN& rhs) const { return !(*this == rhs); }
+
+/// Streamer
+#ifndef __CINT__
+    friend std::ostream& operator<<(std::ostream& o, VectorN const& a)
+    {
+      o << "Vector (";
+      for (auto const& v : a)
+        o << v << " ";
+      o << ")";
+      return o;
+    }
+#endif
+  };
+
+  /// 3D vector and point with fixed dimension
+  typedef VectorN<3> Vector3D_t;
+  typedef VectorN<3> Point3D_t;
+}
+
+#endif
+/** @} */ // end of doxygen group
@@ -0,0 +1,156 @@
+/**
+ * @file   larcorealg/Geometry/AuxDetPositionIndex.cxx
+ * @brief  Spatial index to find the auxiliary detector containing a point.
+ * @see    larcorealg/Geometry/AuxDetPositionIndex.h
+ */
+
+// class header
+#include "larcorealg/Geometry/AuxDetPositionIndex.h"
+
+// LArSoft libraries
+#include "larcorealg/Geometry/AuxDetGeo.h"
+#include "larcorealg/Geometry/details/trapezoidContains.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::min(), std::max(), std::nth_element()
+#include <cmath>     // std::abs(), std::sqrt()
+
+namespace geo {
+
+  //----------------------------------------------------------------------------
+  AuxDetPositionIndex::AuxDetPositionIndex(std::vector<AuxDetGeo> const& auxDets)
+  {
+    if (auxDets.empty()) return;
+
+    //
+    // world box of each detector, from the corners of its local bounding box
+    //
+    fItems.reserve(auxDets.size());
+    for (std::size_t iDet = 0; iDet < auxDets.size(); ++iDet) {
+      AuxDetGeo const& auxDet = auxDets[iDet];
+      double const halfWidth = std::max(auxDet.HalfWidth1(), auxDet.HalfWidth2());
+      double const halfHeight = auxDet.HalfHeight();
+      double const halfLength = auxDet.Length() / 2.0;
+
+      Item_t item{{}, &auxDet, iDet};
+      item.box[0].fill(std::numeric_limits<double>::max());
+      item.box[1].fill(std::numeric_limits<double>::lowest());
+      for (double x : {-halfWidth, halfWidth}) {
+        for (double y : {-halfHeight, halfHeight}) {
+          for (double z : {-halfLength, halfLength}) {
+            Point_t const corner = auxDet.toWorldCoords(AuxDetGeo::LocalPoint_t{x, y, z});
+            double const coords[3] = {corner.X(), corner.Y(), corner.Z()};
+            for (std::size_t axis = 0; axis < 3; ++axis) {
+              item.box[0][axis] = std::min(item.box[0][axis], coords[axis]);
+              item.box[1][axis] = std::max(item.box[1][axis], coords[axis]);
+            }
+          } // z
+        }   // y
+      }     // x
+      // points on the detector surface must not be lost to rounding
+      for (std::size_t axis = 0; axis < 3; ++axis) {
+        item.box[0][axis] -= BoxPadding;
+        item.box[1][axis] += BoxPadding;
+      }
+      fItems.push_back(item);
+
+      if (auxDet.Length() > 0.0) {
+        double const slope = std::abs(auxDet.HalfWidth1() - auxDet.HalfWidth2()) / auxDet.Length();
+        fMaxSlope = std::max(fMaxSlope, slope);
+      }
+    } // for detectors
+
+    fNodes.reserve(2 * (fItems.size() / MaxLeafItems + 1));
+    build(0, fItems.size());
+
+  } // AuxDetPositionIndex::AuxDetPositionIndex()
+
+  //----------------------------------------------------------------------------
+  std::size_t AuxDetPositionIndex::findAuxDet(Point_t const& point, double tolerance) const
+  {
+    if (empty()) return NoAuxDet;
+
+    // the tolerance is applied on each local axis, where it also extends the
+    // half width along the length; in world coordinates, the margin on each
+    // axis is at most sqrt(3) times the largest of the local ones
+    double const margin = std::abs(tolerance) * (1.0 + fMaxSlope) * std::sqrt(3.0);
+    double const coords[3] = {point.X(), point.Y(), point.Z()};
+    auto const inBox = [&coords, margin](Box_t const& box) {
+      for (std::size_t axis = 0; axis < 3; ++axis) {
+        if (coords[axis] < box[0][axis] - margin) return false;
+        if (coords[axis] > box[1][axis] + margin) return false;
+      }
+      return true;
+    };
+
+    std::size_t best = NoAuxDet;
+    std::size_t stack[64]; // the tree is balanced, its depth is about log2(size())
+    std::size_t stackSize = 0;
+    stack[stackSize++] = 0;
+    while (stackSize > 0) {
+      Node_t const& node = fNodes[stack[--stackSize]];
+      if (!inBox(node.box)) continue;
+      if (node.nItems == 0) { // inner node
+        stack[stackSize++] = node.secondChild;
+        stack[stackSize++] = static_cast<std::size_t>(&node - fNodes.data()) + 1;
+        continue;
+      }
+      for (std::size_t i = node.firstItem; i < node.firstItem + node.nItems; ++i) {
+        Item_t const& item = fItems[i];
+        if ((item.index >= best) || !inBox(item.box)) continue;
+        if (details::trapezoidContains(*item.auxDet, point, tolerance)) best = item.index;
+      }
+    } // while
+    return best;
+  } // AuxDetPositionIndex::findAuxDet()
+
+  //----------------------------------------------------------------------------
+  std::size_t AuxDetPositionIndex::build(std::size_t begin, std::size_t end)
+  {
+    std::size_t const iNode = fNodes.size();
+    fNodes.push_back({{}, begin, 0U, 0U});
+
+    Box_t box;
+    box[0].fill(std::numeric_limits<double>::max());
+    box[1].fill(std::numeric_limits<double>::lowest());
+    Box_t centers = box; // range of the box centers
+    for (std::size_t i = begin; i < end; ++i) {
+      Box_t const& itemBox = fItems[i].box;
+      for (std::size_t axis = 0; axis < 3; ++axis) {
+        box[0][axis] = std::min(box[0][axis], itemBox[0][axis]);
+        box[1][axis] = std::max(box[1][axis], itemBox[1][axis]);
+        double const center = (itemBox[0][axis] + itemBox[1][axis]) / 2.0;
+        centers[0][axis] = std::min(centers[0][axis], center);
+        centers[1][axis] = std::max(centers[1][axis], center);
+      }
+    } // for items
+    fNodes[iNode].box = box;
+
+    if (end - begin <= MaxLeafItems) {
+      fNodes[iNode].nItems = end - begin;
+      return iNode;
+    }
+
+    // split at the median box center on the axis with the largest spread
+    std::size_t axis = 0;
+    for (std::size_t a = 1; a < 3; ++a) {
+      if (centers[1][a] - centers[0][a] > centers[1][axis] - centers[0][axis]) axis = a;
+    }
+    std::size_t const middle = begin + (end - begin) / 2;
+    std::nth_element(fItems.begin() + begin,
+                     fItems.begin() + middle,
+                     fItems.begin() + end,
+                     [axis](Item_t const& a, Item_t const& b) {
+                       return (a.box[0][axis] + a.box[1][axis]) <
+                              (b.box[0][axis] + b.box[1][axis]);
+                     });
+
+    build(begin, middle); // first child is always the next node
+    std::size_t const secondChild = build(middle, end);
+    fNodes[iNode].secondChild = secondChild;
+    return iNode;
+  } // AuxDetPositionIndex::build()
+
+  //----------------------------------------------------------------------------
+
+} // namespace geo
@@ -0,0 +1,109 @@
+/**
+ * @file   larcorealg/Geometry/AuxDetPositionIndex.h
+ * @brief  Spatial index to find the auxiliary detector containing a point.
+ * @see    larcorealg/Geometry/AuxDetPositionIndex.cxx
+ * @ingroup Geometry
+ */
+
+#ifndef LARCOREALG_GEOMETRY_AUXDETPOSITIONINDEX_H
+#define LARCOREALG_GEOMETRY_AUXDETPOSITIONINDEX_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h" // geo::Point_t
+
+// C/C++ standard libraries
+#include <array>
+#include <cstddef> // std::size_t
+#include <limits>
+#include <vector>
+
+namespace geo {
+
+  class AuxDetGeo;
+
+  /**
+   * @brief Bounding volume hierarchy of the auxiliary detectors.
+   * @ingroup Geometry
+   *
+   * The index is a binary tree of axis-aligned boxes (in world coordinates)
+   * enclosing the auxiliary detectors. A query descends only into the boxes
+   * containing the point, and performs the exact containment test, in the
+   * local frame of the detector, only on the detectors whose box contains it.
+   *
+   * The containment test is `geo::details::trapezoidContains()`, the same as
+   * in `geo::ChannelMapAlg::FindAuxDet()`, including the treatment of the
+   * tolerance; when more detectors contain the point, the one with the lowest
+   * index is returned, as that method also does.
+   *
+   * The index keeps pointers to the detectors: it must be rebuilt whenever the
+   * list of auxiliary detectors is changed or sorted.
+   */
+  class AuxDetPositionIndex {
+  public:
+    /// Value returned when no detector is found.
+    static constexpr std::size_t NoAuxDet = std::numeric_limits<std::size_t>::max();
+
+    /// Constructor: an empty index, which does not find anything.
+    AuxDetPositionIndex() = default;
+
+    /**
+     * @brief Constructor: indexes all the auxiliary detectors.
+     * @param auxDets the list of detectors to be indexed
+     *
+     * The detectors must not be moved for the whole lifetime of the index.
+     */
+    explicit AuxDetPositionIndex(std::vector<AuxDetGeo> const& auxDets);
+
+    /// Returns whether the index contains no detector at all.
+    bool empty() const { return fItems.empty(); }
+
+    /// Returns the number of indexed detectors.
+    std::size_t size() const { return fItems.size(); }
+
+    /**
+     * @brief Returns the auxiliary detector containing the specified point.
+     * @param point the location [cm]
+     * @param tolerance tolerance on the detector boundaries [cm]
+     * @return the index of the detector, `NoAuxDet` if none contains `point`
+     */
+    std::size_t findAuxDet(Point_t const& point, double tolerance = 0.0) const;
+
+  private:
+    /// Axis-aligned box: { min, max } coordinates.
+    using Box_t = std::array<std::array<double, 3U>, 2U>;
+
+    /// An indexed detector.
+    struct Item_t {
+      Box_t box;               ///< Box enclosing the detector, without tolerance.
+      AuxDetGeo const* auxDet; ///< The detector.
+      std::size_t index;       ///< Index of the detector in the original list.
+    }; // Item_t
+
+    /// A node of the tree: either a leaf with items, or an inner node.
+    struct Node_t {
+      Box_t box;               ///< Box enclosing all the items in the subtree.
+      std::size_t firstItem;   ///< First item (leaves only).
+      std::size_t nItems;      ///< Number of items (`0` for inner nodes).
+      std::size_t secondChild; ///< Second child (inner nodes; first is next).
+    }; // Node_t
+
+    /// Largest number of items in a leaf.
+    static constexpr std::size_t MaxLeafItems = 4U;
+
+    /// Margin added to the box of each detector against rounding [cm].
+    static constexpr double BoxPadding = 1e-6;
+
+    std::vector<Item_t> fItems; ///< Detectors, sorted by tree leaf.
+    std::vector<Node_t> fNodes; ///< The tree, root first.
+
+    /// Largest rate of change of the half width along the length of detectors.
+    double fMaxSlope = 0.0;
+
+    /// Builds the subtree of the items in [ `begin`, `end` [; returns its node.
+    std::size_t build(std::size_t begin, std::size_t end);
+
+  }; // class AuxDetPositionIndex
+
+} // namespace geo
+
+#endif // LARCOREALG_GEOMETRY_AUXDETPOSITIONINDEX_H
@@ -7,9 +7,22 @@
 
 #include "larcorealg/Geometry/ChannelMapAlg.h"
 #include "larcorealg/Geometry/AuxDetGeo.h"
+#include "larcorealg/Geometry/details/trapezoidContains.h"
+
+#include <algorithm> // std::copy_n(), std::min()
 
 namespace geo {
 
+  //----------------------------------------------------------------------------
+  std::size_t ChannelMapAlg::ChannelToWireIDs(raw::ChannelID_t channel,
+                                              WireID* wires,
+                                              std::size_t maxWires) const
+  {
+    std::vector<WireID> const allWires = ChannelToWire(channel);
+    std::copy_n(allWires.begin(), std::min(maxWires, allWires.size()), wires);
+    return allWires.size();
+  }
+
   //----------------------------------------------------------------------------
   unsigned int ChannelMapAlg::NOpChannels(unsigned int NOpDets) const
   {
@@ -64,31 +77,63 @@ namespace geo {
   }
 
   //----------------------------------------------------------------------------
-  size_t ChannelMapAlg::NearestAuxDet(Point_t const& point,
-                                      std::vector<geo::AuxDetGeo> const& auxDets,
-                                      double tolerance) const
+  void ChannelMapAlg::WireCoordinates(PlaneID const& planeID,
+                                      std::size_t n,
+                                      double const* YPos,
+                                      double const* ZPos,
+                                      double* wireCoords) const
   {
-    for (size_t a = 0; a < auxDets.size(); ++a) {
-      auto const localPoint = auxDets[a].toLocalCoords(point);
+    for (std::size_t i = 0; i < n; ++i)
+      wireCoords[i] = WireCoordinate(YPos[i], ZPos[i], planeID);
+  }
 
-      double const HalfCenterWidth = 0.5 * (auxDets[a].HalfWidth1() + auxDets[a].HalfWidth2());
+  //----------------------------------------------------------------------------
+  void ChannelMapAlg::IndexAuxDets(std::vector<geo::AuxDetGeo> const& auxDets)
+  {
+    fAuxDetIndex = AuxDetPositionIndex{auxDets};
+    fIndexedAuxDets = &auxDets;
+  }
 
-      if (localPoint.Z() >= -(auxDets[a].Length() / 2 + tolerance) &&
-          localPoint.Z() <= (auxDets[a].Length() / 2 + tolerance) &&
-          localPoint.Y() >= -auxDets[a].HalfHeight() - tolerance &&
-          localPoint.Y() <= auxDets[a].HalfHeight() + tolerance &&
-          // if AuxDet a is a box, then HalfSmallWidth = HalfWidth
-          localPoint.X() >= -HalfCenterWidth +
-                              localPoint.Z() * (HalfCenterWidth - auxDets[a].HalfWidth2()) /
-                                (0.5 * auxDets[a].Length()) -
-                              tolerance &&
-          localPoint.X() <= HalfCenterWidth -
-                              localPoint.Z() * (HalfCenterWidth - auxDets[a].HalfWidth2()) /
-                                (0.5 * auxDets[a].Length()) +
-                              tolerance)
-        return a;
+  //----------------------------------------------------------------------------
+  void ChannelMapAlg::ClearAuxDetIndex()
+  {
+    fAuxDetIndex = {};
+    fIndexedAuxDets = nullptr;
+  }
 
-    } // for loop over AudDet a
+  //----------------------------------------------------------------------------
+  std::size_t ChannelMapAlg::FindAuxDet(Point_t const& point,
+                                        std::vector<geo::AuxDetGeo> const& auxDets,
+                                        double tolerance) const
+  {
+    // the index applies the same test as the loop below, only on nearby detectors
+    if ((&auxDets == fIndexedAuxDets) && (auxDets.size() == fAuxDetIndex.size()))
+      return fAuxDetIndex.findAuxDet(point, tolerance);
+
+    for (std::size_t a = 0; a < auxDets.size(); ++a) {
+      if (details::trapezoidContains(auxDets[a], point, tolerance)) return a;
+    }
+    return NoAuxDet;
+  }
+
+  //----------------------------------------------------------------------------
+  std::size_t ChannelMapAlg::FindSensitiveAuxDet(Point_t const& point,
+                                                 geo::AuxDetGeo const& auxDet,
+                                                 double tolerance) const
+  {
+    for (std::size_t a = 0; a < auxDet.NSensitiveVolume(); ++a) {
+      if (details::trapezoidContains(auxDet.SensitiveVolume(a), point, tolerance)) return a;
+    }
+    return NoAuxDet;
+  }
+
+  //----------------------------------------------------------------------------
+  size_t ChannelMapAlg::NearestAuxDet(Point_t const& point,
+                                      std::vector<geo::AuxDetGeo> const& auxDets,
+                                      double tolerance) const
+  {
+    std::size_t const a = FindAuxDet(point, auxDets, tolerance);
+    if (a != NoAuxDet) return a;
 
     // throw an exception because we couldn't find the sensitive volume
     throw cet::exception("ChannelMap") << "Can't find AuxDet for position (" << point.X() << ","
@@ -101,29 +146,8 @@ namespace geo {
                                                double tolerance) const
   {
     size_t auxDetIdx = NearestAuxDet(point, auxDets, tolerance);
-    geo::AuxDetGeo const& adg = auxDets[auxDetIdx];
-
-    for (size_t a = 0; a < adg.NSensitiveVolume(); ++a) {
-      geo::AuxDetSensitiveGeo const& adsg = adg.SensitiveVolume(a);
-      auto const localPoint = adsg.toLocalCoords(point);
-
-      double const HalfCenterWidth = 0.5 * (adsg.HalfWidth1() + adsg.HalfWidth2());
-
-      if (localPoint.Z() >= -(adsg.Length() / 2 + tolerance) &&
-          localPoint.Z() <= (adsg.Length() / 2 + tolerance) &&
-          localPoint.Y() >= -adsg.HalfHeight() - tolerance &&
-          localPoint.Y() <= adsg.HalfHeight() + tolerance &&
-          // if AuxDet a is a box, then HalfSmallWidth = HalfWidth
-          localPoint.X() >=
-            -HalfCenterWidth +
-              localPoint.Z() * (HalfCenterWidth - adsg.HalfWidth2()) / (0.5 * adsg.Length()) -
-              tolerance &&
-          localPoint.X() <=
-            HalfCenterWidth -
-              localPoint.Z() * (HalfCenterWidth - adsg.HalfWidth2()) / (0.5 * adsg.Length()) +
-              tolerance)
-        return a;
-    } // for loop over AuxDetSensitive a
+    std::size_t const a = FindSensitiveAuxDet(point, auxDets[auxDetIdx], tolerance);
+    if (a != NoAuxDet) return a;
 
     // throw an exception because we couldn't find the sensitive volume
     throw cet::exception("Geometry") << "Can't find AuxDetSensitive for position (" << point.X()
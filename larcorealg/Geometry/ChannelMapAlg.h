@@ -10,6 +10,7 @@
 ////////////////////////////////////////////////////////////////////////
 
 // LArSoft  libraries
+#include "larcorealg/Geometry/AuxDetPositionIndex.h"
 #include "larcorealg/Geometry/GeoObjectSorter.h"
 #include "larcorealg/Geometry/GeometryData.h"
 #include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
@@ -59,6 +60,22 @@ namespace geo {
     /// Deconfiguration: prepare for a following call of Initialize()
     virtual void Uninitialize() = 0;
 
+    /**
+     * @brief Indexes the auxiliary detectors for the default position lookup.
+     * @param auxDets the auxiliary detectors of the geometry, already sorted
+     *
+     * The default implementation of `FindAuxDet()` (and therefore of
+     * `NearestAuxDet()` and `NearestSensitiveAuxDet()`) uses this index to test
+     * only the detectors near the point, when it is asked about these same
+     * `auxDets`; it tests all the detectors otherwise. Implementations
+     * overriding those methods are not affected.
+     * The index must be rebuilt (or cleared) whenever `auxDets` changes.
+     */
+    void IndexAuxDets(std::vector<AuxDetGeo> const& auxDets);
+
+    /// Drops the index of the auxiliary detectors (see `IndexAuxDets()`).
+    void ClearAuxDetIndex();
+
     /// @}
 
     //--------------------------------------------------------------------------
@@ -83,6 +100,26 @@ namespace geo {
     /// @throws cet::exception (category: "Geometry") if non-existent channel
     virtual std::vector<WireID> ChannelToWire(raw::ChannelID_t channel) const = 0;
 
+    /**
+     * @brief Writes the TPC wires connected to a readout channel into a buffer
+     * @param channel ID of the channel
+     * @param wires pointer to the first element of the buffer to be filled
+     * @param maxWires number of wire IDs the buffer can hold
+     * @return the number of wires connected to `channel`
+     * @throws cet::exception (category: "Geometry") if non-existent channel
+     *
+     * At most `maxWires` wire IDs are written into `wires`, in the same order
+     * as `ChannelToWire()` returns them. If the returned number is larger than
+     * `maxWires`, the remaining wires are not written, and a larger buffer is
+     * needed to get all of them.
+     *
+     * Mappings should override this method to avoid allocating memory.
+     * The default implementation copies the result of `ChannelToWire()`.
+     */
+    virtual std::size_t ChannelToWireIDs(raw::ChannelID_t channel,
+                                         WireID* wires,
+                                         std::size_t maxWires) const;
+
     /**
      * @brief Return the signal type of the specified channel
      * @param channel ID of the channel
@@ -291,18 +328,71 @@ namespace geo {
      */
     virtual WireID NearestWireID(Point_t const& worldPos, PlaneID const& planeID) const = 0;
 
+    /**
+     * @brief Computes the wire coordinate of many points on a plane
+     * @param planeID ID of the plane
+     * @param n number of points
+     * @param YPos array with the _y_ coordinate of each point [cm]
+     * @param ZPos array with the _z_ coordinate of each point [cm]
+     * @param[out] wireCoords array to be filled with `n` wire coordinates
+     * @see WireCoordinate()
+     *
+     * This is the batch version of `WireCoordinate()`, returning the same
+     * values. The default implementation calls `WireCoordinate()` on each
+     * point; channel mappings are encouraged to override it with a loop that
+     * the compiler can vectorize.
+     */
+    virtual void WireCoordinates(PlaneID const& planeID,
+                                 std::size_t n,
+                                 double const* YPos,
+                                 double const* ZPos,
+                                 double* wireCoords) const;
+
     /// @}
 
     //--------------------------------------------------------------------------
     /// @{
     /// @name Auxiliary detectors
 
+    /// Value returned by `FindAuxDet()` and `FindSensitiveAuxDet()` on failure.
+    static constexpr std::size_t NoAuxDet = AuxDetPositionIndex::NoAuxDet;
+
+    /**
+     * @brief Returns the auxiliary detector containing the specified point.
+     * @param point coordinates of the position to be investigated (x, y, z)
+     * @param auxDets list of the sought auxiliary detectors
+     * @param tolerance tolerance for comparison. Default 0.
+     * @return index of auxiliary detector within auxDets, `NoAuxDet` if none
+     * @see `NearestAuxDet()`
+     *
+     * When more detectors contain `point`, the first one in `auxDets` is
+     * returned.
+     */
+    virtual std::size_t FindAuxDet(Point_t const& point,
+                                   std::vector<AuxDetGeo> const& auxDets,
+                                   double tolerance = 0) const;
+
+    /**
+     * @brief Returns the sensitive volume of `auxDet` containing the point.
+     * @param point coordinates of the position to be investigated (x, y, z)
+     * @param auxDet the auxiliary detector whose volumes are sought
+     * @param tolerance tolerance for comparison. Default 0.
+     * @return index of the sensitive volume within auxDet, `NoAuxDet` if none
+     * @see `NearestSensitiveAuxDet()`
+     */
+    virtual std::size_t FindSensitiveAuxDet(Point_t const& point,
+                                            AuxDetGeo const& auxDet,
+                                            double tolerance = 0) const;
+
     /**
      * @brief Returns the auxiliary detector closest to the specified point
      * @param point coordinates of the position to be investigated (x, y, z)
      * @param auxDets list of the sought auxiliary detectors
      * @param tolerance tolerance for comparison. Default 0.
      * @return index of auxiliary detector within auxDets
+     * @throw cet::exception (category "ChannelMap") if no detector is found
+     *
+     * The default implementation wraps `FindAuxDet()`.
      */
     virtual size_t NearestAuxDet(Point_t const& point,
                                  std::vector<AuxDetGeo> const& auxDets,
@@ -314,6 +404,10 @@ namespace geo {
      * @param auxDets list of the auxiliary detectors
      * @param tolerance tolerance for comparison. Default 0.
      * @return index of sought sensitive auxiliary detector within auxDets
+     * @throw cet::exception if no detector or sensitive volume is found
+     *
+     * The default implementation wraps `NearestAuxDet()` and
+     * `FindSensitiveAuxDet()`.
      */
     virtual size_t NearestSensitiveAuxDet(Point_t const& point,
                                           std::vector<AuxDetGeo> const& auxDets,
@@ -578,6 +672,13 @@ namespace geo {
     } // GetElementPtr()
 
     ///@} Internal structure data access
+
+  private:
+    /// Position index of the auxiliary detectors in `fIndexedAuxDets`.
+    AuxDetPositionIndex fAuxDetIndex;
+
+    /// The auxiliary detectors in `fAuxDetIndex` (`nullptr` if none).
+    std::vector<AuxDetGeo> const* fIndexedAuxDets = nullptr;
   };
 }
 #endif // GEO_CHANNELMAPALG_H
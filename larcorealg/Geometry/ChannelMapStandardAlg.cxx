@@ -16,6 +16,9 @@
 #include "cetlib_except/exception.h"
 #include "messagefacility/MessageLogger/MessageLogger.h"
 
+#include <algorithm> // std::min(), std::max()
+#include <cmath>     // std::sin(), std::cos()
+
 namespace geo {
 
   //----------------------------------------------------------------------------
@@ -46,6 +49,9 @@ namespace geo {
     fFirstChannelInNextPlane.resize(fNcryostat);
     fFirstChannelInThisPlane.resize(fNcryostat);
     fPlaneIDs.clear();
+    fPlaneFirstChannels.clear();
+    fChannelPlaneIDs.clear();
+    fPlaneSignalTypes.clear();
     fTopChannel = 0;
 
     int RunningTotal = 0;
@@ -80,17 +86,18 @@ namespace geo {
           double ThisWirePitch = TPC.WirePitch(PlaneCount);
           fWireCounts[cs][TPCCount][PlaneCount] = plane.Nwires();
 
-          const WireGeo& firstWire = plane.Wire(0);
-          const double sth = firstWire.SinThetaZ(), cth = firstWire.CosThetaZ();
+          // only plane information is used, so that wires are not built
+          // if they have been released (see `geo::PlaneGeo::ReleaseWires()`)
+          const double thetaZ = plane.ThetaZ();
+          const double sth = std::sin(thetaZ), cth = std::cos(thetaZ);
 
-          auto WireCenter1 = firstWire.GetCenter();
-          auto WireCenter2 = plane.Wire(1).GetCenter();
+          auto WireCenter1 = plane.FirstWireCenter();
+          auto const& IncreasingWireDir = plane.GetIncreasingWireDirection();
 
           // figure out if we need to flip the orthogonal vector
           // (should point from wire n -> n+1)
           double OrthY = cth, OrthZ = -sth;
-          if (((WireCenter2.Y() - WireCenter1.Y()) * OrthY +
-               (WireCenter2.Z() - WireCenter1.Z()) * OrthZ) < 0) {
+          if ((IncreasingWireDir.Y() * OrthY + IncreasingWireDir.Z() * OrthZ) < 0) {
             OrthZ *= -1;
             OrthY *= -1;
           }
@@ -116,6 +123,11 @@ namespace geo {
           RunningTotal += WiresThisPlane;
 
           fFirstChannelInThisPlane[cs].at(TPCCount).push_back(fTopChannel);
+          fPlaneFirstChannels.push_back(fTopChannel);
+          fChannelPlaneIDs.emplace_back(cs, TPCCount, PlaneCount);
+          // the last plane of each TPC is collection, all others are induction
+          fPlaneSignalTypes.push_back((PlaneCount + 1 == PlanesThisTPC) ? kCollection :
+                                                                          kInduction);
           fTopChannel += WiresThisPlane;
           fFirstChannelInNextPlane[cs].at(TPCCount).push_back(fTopChannel);
 
@@ -126,6 +138,8 @@ namespace geo {
     // calculate the total number of channels in the detector
     fNchannels = fTopChannel;
 
+    BuildChannelLookup();
+
     MF_LOG_DEBUG("ChannelMapStandard") << "# of channels is " << fNchannels;
   }
 
@@ -135,43 +149,70 @@ namespace geo {
   //----------------------------------------------------------------------------
   std::vector<WireID> ChannelMapStandardAlg::ChannelToWire(raw::ChannelID_t channel) const
   {
-    std::vector<WireID> AllSegments;
-    unsigned int cstat = 0;
-    unsigned int tpc = 0;
-    unsigned int plane = 0;
-    unsigned int wire = 0;
+    return {ChannelToWireID(channel)};
+  }
+
+  //----------------------------------------------------------------------------
+  std::size_t ChannelMapStandardAlg::ChannelToWireIDs(raw::ChannelID_t channel,
+                                                      WireID* wires,
+                                                      std::size_t maxWires) const
+  {
+    WireID const wire = ChannelToWireID(channel); // throws on illegal channel
+    if (maxWires > 0) wires[0] = wire;
+    return 1U;
+  }
 
+  //----------------------------------------------------------------------------
+  WireID ChannelMapStandardAlg::ChannelToWireID(raw::ChannelID_t channel) const
+  {
     // first check if this channel ID is legal
-    if (channel > fTopChannel)
+    if (channel >= fTopChannel)
       throw cet::exception("Geometry") << "ILLEGAL CHANNEL ID for channel " << channel << "\n";
 
-    // then go find which plane, tpc and cryostat it is in from the information we stored earlier
-    bool foundWid(false);
-    for (unsigned int csloop = 0; csloop != fNcryostat; ++csloop) {
-      for (unsigned int tpcloop = 0; tpcloop != fNTPC[csloop]; ++tpcloop) {
-        for (unsigned int planeloop = 0;
-             planeloop != fFirstChannelInNextPlane[csloop][tpcloop].size();
-             ++planeloop) {
-          if (channel < fFirstChannelInNextPlane[csloop][tpcloop][planeloop]) {
-            cstat = csloop;
-            tpc = tpcloop;
-            plane = planeloop;
-            wire = channel - fFirstChannelInThisPlane[cstat][tpcloop][planeloop];
-            foundWid = true;
-            break;
-          }
-          if (foundWid) break;
-        } // end plane loop
-        if (foundWid) break;
-      } // end tpc loop
-      if (foundWid) break;
-    } // end cryostat loop
-
-    WireID CodeWire(cstat, tpc, plane, wire);
+    std::size_t const iPlane = ChannelPlaneIndex(channel);
+    return {fChannelPlaneIDs[iPlane], channel - fPlaneFirstChannels[iPlane]};
+  }
 
-    AllSegments.push_back(CodeWire);
+  //----------------------------------------------------------------------------
+  void ChannelMapStandardAlg::BuildChannelLookup()
+  {
+    // Channels are split in buckets of the same size, no larger than the
+    // smallest plane: each bucket then spans at most two planes with wires,
+    // and the plane of a channel is at most a few steps after the plane of the
+    // first channel of its bucket (the steps are more only if there are
+    // planes with no wires, which share the first channel with the next one).
+    raw::ChannelID_t minPlaneChannels = fTopChannel;
+    for (std::size_t iPlane = 0; iPlane < fPlaneFirstChannels.size(); ++iPlane) {
+      raw::ChannelID_t const nextPlaneFirst = (iPlane + 1 < fPlaneFirstChannels.size()) ?
+                                                fPlaneFirstChannels[iPlane + 1] :
+                                                fTopChannel;
+      raw::ChannelID_t const nChannels = nextPlaneFirst - fPlaneFirstChannels[iPlane];
+      if (nChannels > 0) minPlaneChannels = std::min(minPlaneChannels, nChannels);
+    } // for planes
+    fChannelBucketSize = std::max(minPlaneChannels, raw::ChannelID_t{1U});
+
+    std::size_t const nBuckets = (fTopChannel + fChannelBucketSize - 1) / fChannelBucketSize;
+    fChannelBucketPlanes.resize(nBuckets);
+    std::size_t iPlane = 0;
+    for (std::size_t iBucket = 0; iBucket < nBuckets; ++iBucket) {
+      raw::ChannelID_t const firstChannel = iBucket * fChannelBucketSize;
+      while ((iPlane + 1 < fPlaneFirstChannels.size()) &&
+             (fPlaneFirstChannels[iPlane + 1] <= firstChannel))
+        ++iPlane;
+      fChannelBucketPlanes[iBucket] = iPlane;
+    } // for buckets
+
+  } // ChannelMapStandardAlg::BuildChannelLookup()
 
-    return AllSegments;
+  //----------------------------------------------------------------------------
+  std::size_t ChannelMapStandardAlg::ChannelPlaneIndex(raw::ChannelID_t channel) const
+  {
+    // start from the plane of the first channel in the bucket, then move on
+    std::size_t iPlane = fChannelBucketPlanes[channel / fChannelBucketSize];
+    while ((iPlane + 1 < fPlaneFirstChannels.size()) &&
+           (fPlaneFirstChannels[iPlane + 1] <= channel))
+      ++iPlane;
+    return iPlane;
   }
 
   //----------------------------------------------------------------------------
@@ -225,6 +266,22 @@ namespace geo {
     return WireID(planeID, (WireID::WireID_t)NearestWireNumber);
   }
 
+  //----------------------------------------------------------------------------
+  void ChannelMapStandardAlg::WireCoordinates(PlaneID const& planeID,
+                                              std::size_t n,
+                                              double const* YPos,
+                                              double const* ZPos,
+                                              double* wireCoords) const
+  {
+    // promoted to double as in WireCoordinate()
+    double const orthY = AccessElement(fOrthVectorsY, planeID);
+    double const orthZ = AccessElement(fOrthVectorsZ, planeID);
+    double const firstWireProj = AccessElement(fFirstWireProj, planeID);
+
+    for (std::size_t i = 0; i < n; ++i)
+      wireCoords[i] = YPos[i] * orthY + ZPos[i] * orthZ - firstWireProj;
+  }
+
   //----------------------------------------------------------------------------
   // This method returns the channel number, assuming the numbering scheme
   // is heirachical - that is, channel numbers run in order, for example:
@@ -263,28 +320,12 @@ namespace geo {
   //----------------------------------------------------------------------------
   SigType_t ChannelMapStandardAlg::SignalTypeForChannelImpl(raw::ChannelID_t const channel) const
   {
-
-    // still assume one cryostat for now -- faster
-    unsigned int nChanPerTPC = fNchannels / fNTPC[0];
-    // casting wil trunc towards 0 -- faster than floor
-    unsigned int tpc = channel / nChanPerTPC;
-    //need number of planes to know Collection
-    unsigned int PlanesThisTPC = fNPlanes[0][tpc];
-
-    SigType_t sigt = kMysteryType;
-    if ((channel >= fFirstChannelInThisPlane[0][tpc][0]) &&
-        (channel < fFirstChannelInNextPlane[0][tpc][PlanesThisTPC - 2])) {
-      sigt = kInduction;
-    }
-    else if ((channel >= fFirstChannelInThisPlane[0][tpc][PlanesThisTPC - 1]) &&
-             (channel < fFirstChannelInNextPlane[0][tpc][PlanesThisTPC - 1])) {
-      sigt = kCollection;
-    }
-    else
+    if (channel >= fTopChannel) { // this includes raw::InvalidChannelID
       mf::LogWarning("BadChannelSignalType")
         << "Channel " << channel << " not given signal type." << std::endl;
-
-    return sigt;
+      return kMysteryType;
+    }
+    return fPlaneSignalTypes[ChannelPlaneIndex(channel)];
   }
 
   //----------------------------------------------------------------------------
@@ -386,14 +427,8 @@ namespace geo {
   {
     if (!raw::isValidChannelID(channel)) return {}; // invalid ROP returned
 
-    // which wires does the channel cover?
-    std::vector<WireID> wires = ChannelToWire(channel);
-
-    // - none:
-    if (wires.empty()) return {}; // invalid ROP returned
-
-    // - one: maps its plane ID into a ROP ID
-    return WirePlaneToROP(wires[0]);
+    // each channel covers exactly one wire: maps its plane ID into a ROP ID
+    return WirePlaneToROP(ChannelToWireID(channel));
   }
 
   //----------------------------------------------------------------------------
@@ -14,6 +14,7 @@
 
 #include "fhiclcpp/fwd.h"
 
+#include <cstddef> // std::size_t
 #include <set>
 #include <vector>
 
@@ -26,6 +27,25 @@ namespace geo {
     void Initialize(GeometryData_t const& geodata) override;
     void Uninitialize() override;
     std::vector<WireID> ChannelToWire(raw::ChannelID_t channel) const override;
+
+    /// @copydoc ChannelMapAlg::ChannelToWireIDs()
+    /// In this mapping there is always exactly one wire per channel.
+    std::size_t ChannelToWireIDs(raw::ChannelID_t channel,
+                                 WireID* wires,
+                                 std::size_t maxWires) const override;
+
+    /**
+     * @brief Returns the only wire connected to the specified channel
+     * @param channel ID of the channel
+     * @return ID of the wire connected to `channel`
+     * @throws cet::exception (category: "Geometry") if non-existent channel
+     *
+     * In this mapping each channel is connected to exactly one wire, and
+     * channels are numbered sequentially plane after plane. The plane is found
+     * in constant time from a lookup table, and no memory is allocated.
+     */
+    WireID ChannelToWireID(raw::ChannelID_t channel) const;
+
     unsigned int Nchannels() const override;
 
     /// @brief Returns the number of channels in the specified ROP
@@ -40,6 +60,14 @@ namespace geo {
     WireID NearestWireID(Point_t const& worldPos, PlaneID const& planeID) const override;
     //@}
 
+    //@{
+    void WireCoordinates(PlaneID const& planeID,
+                         std::size_t n,
+                         double const* YPos,
+                         double const* ZPos,
+                         double* wireCoords) const override;
+    //@}
+
     //@{
     raw::ChannelID_t PlaneWireToChannel(WireID const& wireID) const override;
     //@}
@@ -216,10 +244,28 @@ namespace geo {
     PlaneInfoMap_t<unsigned int> fWiresPerPlane;  ///< The number of wires in this plane
                                                   ///< in the heirachy
 
+    /// First channel of each plane, in increasing order (for channel lookup).
+    std::vector<raw::ChannelID_t> fPlaneFirstChannels;
+    /// ID of each plane, in the same order as `fPlaneFirstChannels`.
+    std::vector<PlaneID> fChannelPlaneIDs;
+    /// Signal type of each plane, in the same order as `fPlaneFirstChannels`.
+    std::vector<SigType_t> fPlaneSignalTypes;
+    /// Number of channels in each bucket of `fChannelBucketPlanes`.
+    raw::ChannelID_t fChannelBucketSize = 1U;
+    /// Index of the plane of the first channel in each bucket of channels.
+    std::vector<std::size_t> fChannelBucketPlanes;
+
     GeoObjectSorterStandard fSorter; ///< class to sort geo objects
 
     SigType_t SignalTypeForChannelImpl(raw::ChannelID_t const channel) const override;
 
+    /// Returns the position in `fPlaneFirstChannels` of the plane of `channel`,
+    /// which must be an existing channel.
+    std::size_t ChannelPlaneIndex(raw::ChannelID_t channel) const;
+
+    /// Fills the channel lookup table `fChannelBucketPlanes`.
+    void BuildChannelLookup();
+
     /// Retrieved the wire cound for the specified plane ID
     unsigned int WireCount(PlaneID const& id) const { return AccessElement(fWireCounts, id); }
 
@@ -0,0 +1,127 @@
+/**
+ * @file   larcorealg/Geometry/ChannelRangeTable.cxx
+ * @brief  Table of the ranges of readout channels of TPCs, TPC sets and ROPs.
+ * @see    larcorealg/Geometry/ChannelRangeTable.h
+ */
+
+// class header
+#include "larcorealg/Geometry/ChannelRangeTable.h"
+
+// LArSoft libraries
+#include "larcorealg/Geometry/ChannelMapAlg.h"
+#include "larcorealg/Geometry/CryostatGeo.h"
+#include "larcorealg/Geometry/PlaneGeo.h"
+#include "larcorealg/Geometry/TPCGeo.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::sort(), std::unique(), std::remove_if(), std::max()
+#include <iterator>  // std::next()
+#include <utility>   // std::move()
+
+namespace {
+
+  /// Sorts `ranges` and merges the overlapping and adjacent ones.
+  void mergeRanges(std::vector<geo::ChannelRange>& ranges)
+  {
+    ranges.erase(std::remove_if(ranges.begin(),
+                                ranges.end(),
+                                [](geo::ChannelRange const& range) { return range.empty(); }),
+                 ranges.end());
+    std::sort(ranges.begin(), ranges.end(), [](auto const& a, auto const& b) {
+      return a.first < b.first;
+    });
+
+    if (ranges.empty()) return;
+
+    auto iLast = ranges.begin();
+    for (auto it = std::next(iLast); it != ranges.end(); ++it) {
+      if (it->first <= iLast->end)
+        iLast->end = std::max(iLast->end, it->end);
+      else
+        *(++iLast) = *it;
+    }
+    ranges.erase(std::next(iLast), ranges.end());
+  } // mergeRanges()
+
+} // local namespace
+
+namespace geo {
+
+  //----------------------------------------------------------------------------
+  template <typename ID>
+  void ChannelRangeTable::RangeList<ID>::assign(std::vector<std::vector<ChannelRange>> ranges)
+  {
+    allRanges.clear();
+    first.assign(1U, 0U);
+    for (std::vector<ChannelRange>& elementRanges : ranges) {
+      mergeRanges(elementRanges);
+      allRanges.insert(allRanges.end(), elementRanges.begin(), elementRanges.end());
+      first.push_back(allRanges.size());
+    }
+  } // ChannelRangeTable::RangeList<>::assign()
+
+  //----------------------------------------------------------------------------
+  ChannelRangeTable::ChannelRangeTable(ChannelMapAlg const& channelMap,
+                                       CryostatList_t const& cryostats)
+  {
+    // collect all the existing IDs, in order
+    std::vector<TPCID> TPCs;
+    std::vector<readout::TPCsetID> TPCsets;
+    std::vector<readout::ROPID> ROPs;
+    for (CryostatGeo const& cryo : cryostats) {
+      for (TPCGeo const& tpc : cryo.IterateTPCs())
+        TPCs.push_back(tpc.ID());
+      readout::CryostatID const cryoid{cryo.ID()};
+      unsigned int const nTPCsets = channelMap.NTPCsets(cryoid);
+      for (readout::TPCsetID::TPCsetID_t s = 0; s < nTPCsets; ++s) {
+        readout::TPCsetID const tpcsetid{cryoid, s};
+        TPCsets.push_back(tpcsetid);
+        unsigned int const nROPs = channelMap.NROPs(tpcsetid);
+        for (readout::ROPID::ROPID_t r = 0; r < nROPs; ++r)
+          ROPs.emplace_back(tpcsetid, r);
+      }
+    }
+    fTPCs.mapper = CompactGeoIDmapper<TPCID>{TPCs};
+    fTPCsets.mapper = CompactGeoIDmapper<readout::TPCsetID>{TPCsets};
+    fROPs.mapper = CompactGeoIDmapper<readout::ROPID>{ROPs};
+
+    // each ROP range goes to its ROP, to its TPC set and to all its TPCs
+    std::vector<std::vector<ChannelRange>> TPCranges(fTPCs.mapper.size());
+    std::vector<std::vector<ChannelRange>> TPCsetRanges(fTPCsets.mapper.size());
+    std::vector<std::vector<ChannelRange>> ROPranges(fROPs.mapper.size());
+    for (readout::ROPID const& ropid : ROPs) {
+      raw::ChannelID_t const first = channelMap.FirstChannelInROP(ropid);
+      ChannelRange const range{first, first + channelMap.Nchannels(ropid)};
+      ROPranges[fROPs.mapper.index(ropid)].push_back(range);
+      TPCsetRanges[fTPCsets.mapper.index(ropid)].push_back(range);
+      for (TPCID const& tpcid : channelMap.ROPtoTPCs(ropid)) {
+        if (fTPCs.mapper.hasElement(tpcid)) TPCranges[fTPCs.mapper.index(tpcid)].push_back(range);
+      }
+    }
+    fTPCs.assign(std::move(TPCranges));
+    fTPCsets.assign(std::move(TPCsetRanges));
+    fROPs.assign(std::move(ROPranges));
+
+    // channels of all the wires of the TPCs in each TPC set
+    fChannelsInTPCs.reserve(channelMap.Nchannels());
+    for (readout::TPCsetID const& tpcsetid : TPCsets) {
+      for (TPCID const& tpcid : channelMap.TPCsetToTPCs(tpcsetid)) {
+        if (tpcid.Cryostat >= cryostats.size()) continue;
+        TPCGeo const* tpc = cryostats[tpcid.Cryostat].TPCPtr(tpcid);
+        if (!tpc) continue;
+        for (PlaneGeo const& plane : tpc->IteratePlanes()) {
+          unsigned int const nWires = plane.Nwires();
+          for (WireID wireid{plane.ID(), 0U}; wireid.Wire < nWires; ++wireid.Wire)
+            fChannelsInTPCs.push_back(channelMap.PlaneWireToChannel(wireid));
+        }
+      }
+    }
+    std::sort(fChannelsInTPCs.begin(), fChannelsInTPCs.end());
+    fChannelsInTPCs.erase(std::unique(fChannelsInTPCs.begin(), fChannelsInTPCs.end()),
+                          fChannelsInTPCs.end());
+
+  } // ChannelRangeTable::ChannelRangeTable()
+
+  //----------------------------------------------------------------------------
+
+} // namespace geo
@@ -0,0 +1,131 @@
+/**
+ * @file   larcorealg/Geometry/ChannelRangeTable.h
+ * @brief  Table of the ranges of readout channels of TPCs, TPC sets and ROPs.
+ * @see    larcorealg/Geometry/ChannelRangeTable.cxx
+ * @ingroup Geometry
+ */
+
+#ifndef LARCOREALG_GEOMETRY_CHANNELRANGETABLE_H
+#define LARCOREALG_GEOMETRY_CHANNELRANGETABLE_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/span.h"
+#include "larcorealg/Geometry/GeometryData.h"
+#include "larcorealg/Geometry/GeometryIDmapper.h"              // geo::CompactGeoIDmapper
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h"       // raw::ChannelID_t
+#include "larcoreobj/SimpleTypesAndConstants/readout_types.h" // readout::ROPID...
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <vector>
+
+namespace geo {
+
+  class ChannelMapAlg;
+
+  /// A contiguous range of readout channels, `first` included, `end` excluded.
+  struct ChannelRange {
+    raw::ChannelID_t first = 0; ///< The first channel in the range.
+    raw::ChannelID_t end = 0;   ///< The channel after the last one in the range.
+
+    /// Returns the number of channels in the range.
+    unsigned int size() const { return end - first; }
+
+    /// Returns whether the range has no channels.
+    bool empty() const { return end == first; }
+
+    /// Returns whether `channel` is in the range.
+    bool contains(raw::ChannelID_t channel) const { return (channel >= first) && (channel < end); }
+  }; // struct ChannelRange
+
+  /**
+   * @brief Ranges of the readout channels of each TPC, TPC set and readout plane.
+   * @ingroup Geometry
+   *
+   * The table is computed once from the channel mapping, and then it is not
+   * modified. For each element, the channels are described as a sorted list of
+   * disjoint contiguous ranges (`geo::ChannelRange`), returned as a span into
+   * the table, with no allocation:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * for (geo::ChannelRange const& range: table.TPCchannels(tpcid)) {
+   *   for (raw::ChannelID_t channel = range.first; channel < range.end; ++channel)
+   *     // ...
+   * }
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * * a readout plane has at most one range, from
+   *   `geo::ChannelMapAlg::FirstChannelInROP()` and `Nchannels()`;
+   * * a TPC set has the ranges of all its readout planes;
+   * * a TPC has the ranges of all the readout planes covering it (see
+   *   `geo::ChannelMapAlg::ROPtoTPCs()`).
+   *
+   * Elements not in the table have no ranges.
+   * The table also holds the sorted list of all the channels of the wires in
+   * the TPCs (`channelsInTPCs()`).
+   *
+   * The table must be rebuilt whenever the channel mapping is changed.
+   */
+  class ChannelRangeTable {
+  public:
+    /// Type of list of cryostats the table is built from.
+    using CryostatList_t = GeometryData_t::CryostatList_t;
+
+    /// Type of the list of channel ranges of a single element.
+    using Ranges_t = util::span<std::vector<ChannelRange>::const_iterator>;
+
+    /// Constructor: an empty table, with no ranges.
+    ChannelRangeTable() = default;
+
+    /**
+     * @brief Constructor: records the channel ranges of all the elements.
+     * @param channelMap the channel mapping, already initialized
+     * @param cryostats the list of cryostats with the TPCs
+     */
+    ChannelRangeTable(ChannelMapAlg const& channelMap, CryostatList_t const& cryostats);
+
+    /// Returns the ranges of channels of the TPC (empty if not in the table).
+    Ranges_t TPCchannels(TPCID const& tpcid) const { return fTPCs.ranges(tpcid); }
+
+    /// Returns the ranges of channels of the TPC set (empty if not in the table).
+    Ranges_t TPCsetChannels(readout::TPCsetID const& tpcsetid) const
+    {
+      return fTPCsets.ranges(tpcsetid);
+    }
+
+    /// Returns the range of channels of the ROP (empty if not in the table).
+    Ranges_t ROPchannels(readout::ROPID const& ropid) const { return fROPs.ranges(ropid); }
+
+    /// Returns all the channels of the wires in the TPCs of all TPC sets, sorted.
+    std::vector<raw::ChannelID_t> const& channelsInTPCs() const { return fChannelsInTPCs; }
+
+  private:
+    /// Channel ranges of all the elements of one type.
+    template <typename ID>
+    struct RangeList {
+      CompactGeoIDmapper<ID> mapper;      ///< Index of each element.
+      std::vector<ChannelRange> allRanges; ///< Ranges of all elements, in order.
+      std::vector<std::size_t> first;      ///< First range of each element, then the total.
+
+      /// Returns the ranges of `id` (empty if not present).
+      Ranges_t ranges(ID const& id) const
+      {
+        if (!mapper.hasElement(id)) return {allRanges.cend(), allRanges.cend()};
+        auto const i = mapper.index(id);
+        return {allRanges.cbegin() + first[i], allRanges.cbegin() + first[i + 1U]};
+      }
+
+      /// Records `ranges` (one list per element of `mapper`), merging them.
+      void assign(std::vector<std::vector<ChannelRange>> ranges);
+    }; // struct RangeList
+
+    RangeList<TPCID> fTPCs;                ///< Ranges of each TPC.
+    RangeList<readout::TPCsetID> fTPCsets; ///< Ranges of each TPC set.
+    RangeList<readout::ROPID> fROPs;       ///< Range of each readout plane.
+
+    /// All the channels of the wires in TPCs, sorted.
+    std::vector<raw::ChannelID_t> fChannelsInTPCs;
+
+  }; // class ChannelRangeTable
+
+} // namespace geo
+
+#endif // LARCOREALG_GEOMETRY_CHANNELRANGETABLE_H
@@ -21,9 +21,10 @@
 #include "TGeoShape.h" // for TGeoShape
 
 // C++ standard libraries
-#include <limits>  // std::numeric_limits<>
-#include <sstream> // std::ostringstream
-#include <utility> // std::move()
+#include <algorithm> // std::sort(), std::min()
+#include <limits>    // std::numeric_limits<>
+#include <sstream>   // std::ostringstream
+#include <utility>   // std::move()
 #include <vector>
 
 namespace geo {
@@ -74,12 +75,28 @@ namespace geo {
     for (unsigned int opdet = 0; opdet < NOpDet(); ++opdet)
       fOpDets[opdet].UpdateAfterSorting(geo::OpDetID(fID, opdet));
 
+    // index the optical detectors by position, in their final order
+    std::vector<geo::Point_t> opDetCenters;
+    opDetCenters.reserve(NOpDet());
+    for (geo::OpDetGeo const& opDet : fOpDets)
+      opDetCenters.push_back(opDet.GetCenter());
+    fOpDetIndex = OpDetPositionIndex{opDetCenters};
+
     // trigger all the TPCs to update as well
     for (unsigned int tpc = 0; tpc < NTPC(); ++tpc)
       fTPCs[tpc].UpdateAfterSorting(geo::TPCID(fID, tpc));
 
   } // CryostatGeo::UpdateAfterSorting()
 
+  //......................................................................
+  unsigned int CryostatGeo::ReleaseWires()
+  {
+    unsigned int nPlanes = 0;
+    for (geo::TPCGeo& TPC : fTPCs)
+      nPlanes += TPC.ReleaseWires();
+    return nPlanes;
+  } // CryostatGeo::ReleaseWires()
+
   //......................................................................
   const TPCGeo& CryostatGeo::TPC(unsigned int itpc) const
   {
@@ -200,12 +217,15 @@ namespace geo {
   geo::OpDetGeo const* CryostatGeo::GetClosestOpDetPtr(geo::Point_t const& point) const
   {
     unsigned int iOpDet = GetClosestOpDet(point);
-    return (iOpDet == std::numeric_limits<double>::max()) ? nullptr : &OpDet(iOpDet);
+    return (iOpDet == std::numeric_limits<unsigned int>::max()) ? nullptr : &OpDet(iOpDet);
   }
 
   //......................................................................
   unsigned int CryostatGeo::GetClosestOpDet(geo::Point_t const& point) const
   {
+    // the index is available only after sorting
+    if (fOpDetIndex.size() == NOpDet()) return fOpDetIndex.nearest(point);
+
     unsigned int ClosestDet = std::numeric_limits<unsigned int>::max();
     double ClosestDist = std::numeric_limits<double>::max();
 
@@ -225,6 +245,36 @@ namespace geo {
     return GetClosestOpDet(geo::vect::makePointFromCoords(point));
   }
 
+  //......................................................................
+  void CryostatGeo::GetClosestOpDet(std::size_t nPoints,
+                                    geo::Point_t const* points,
+                                    unsigned int* opDets) const
+  {
+    if (fOpDetIndex.size() == NOpDet()) {
+      fOpDetIndex.nearest(nPoints, points, opDets);
+      return;
+    }
+    for (std::size_t i = 0; i < nPoints; ++i)
+      opDets[i] = GetClosestOpDet(points[i]);
+  } // CryostatGeo::GetClosestOpDet(batch)
+
+  //......................................................................
+  std::vector<unsigned int> CryostatGeo::GetClosestOpDets(geo::Point_t const& point,
+                                                          unsigned int k) const
+  {
+    if (fOpDetIndex.size() == NOpDet()) return fOpDetIndex.nearest(point, k);
+
+    // no index (yet): sort all the detectors by distance
+    std::vector<std::pair<double, unsigned int>> distances;
+    for (unsigned int o = 0U; o < NOpDet(); ++o)
+      distances.emplace_back((point - OpDet(o).GetCenter()).Mag2(), o);
+    std::sort(distances.begin(), distances.end());
+    std::vector<unsigned int> opDets;
+    for (std::size_t i = 0; i < std::min<std::size_t>(k, distances.size()); ++i)
+      opDets.push_back(distances[i].second);
+    return opDets;
+  } // CryostatGeo::GetClosestOpDets()
+
   //......................................................................
   void CryostatGeo::InitCryoBoundaries()
   {
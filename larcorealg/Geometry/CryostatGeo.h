@@ -13,6 +13,7 @@
 #include "larcorealg/Geometry/GeoVectorLocalTransformation.h" // for LocalT...
 #include "larcorealg/Geometry/LocalTransformationGeo.h"       // for LocalT...
 #include "larcorealg/Geometry/OpDetGeo.h"
+#include "larcorealg/Geometry/OpDetPositionIndex.h"
 #include "larcorealg/Geometry/TPCGeo.h"
 #include "larcorealg/Geometry/TransformationMatrix.h"
 #include "larcorealg/Geometry/WireGeo.h"           // for WireGeo
@@ -27,6 +28,7 @@
 #include "TGeoVolume.h"
 
 // C/C++ standard libraries
+#include <cstddef> // std::size_t
 #include <string>
 #include <vector>
 
@@ -324,11 +326,30 @@ namespace geo {
     const OpDetGeo& OpDet(unsigned int iopdet) const;
 
     /// Returns the index of the optical detector in this cryostat closest to
-    /// `point`.
+    /// `point` (`std::numeric_limits<unsigned int>::max()` if none).
     unsigned int GetClosestOpDet(geo::Point_t const& point) const;
     /// @see `GetClosestOpDet(geo::Point_t const&) const`
     unsigned int GetClosestOpDet(double const* point) const;
 
+    /**
+     * @brief Finds the optical detector closest to each of the points.
+     * @param nPoints number of points
+     * @param points array of `nPoints` locations, in world coordinates
+     * @param[out] opDets array of `nPoints` detector indices to be filled
+     * @see `GetClosestOpDet(geo::Point_t const&) const`
+     */
+    void GetClosestOpDet(std::size_t nPoints,
+                         geo::Point_t const* points,
+                         unsigned int* opDets) const;
+
+    /**
+     * @brief Returns the optical detectors in this cryostat closest to `point`.
+     * @param point the location, in world coordinates
+     * @param k the number of detectors to be returned
+     * @return the indices of up to `k` closest detectors, sorted by distance
+     */
+    std::vector<unsigned int> GetClosestOpDets(geo::Point_t const& point, unsigned int k) const;
+
     /// Returns the optical detector det in this cryostat nearest to `point`.
     /// If there are no optical detectors, `nullptr` is returned.
     geo::OpDetGeo const* GetClosestOpDetPtr(geo::Point_t const& point) const;
@@ -376,6 +397,10 @@ namespace geo {
     /// Performs all needed updates after geometry has sorted the cryostats
     void UpdateAfterSorting(geo::CryostatID cryoid);
 
+    /// Releases the wire objects of all planes (see `PlaneGeo::ReleaseWires()`);
+    /// returns the number of planes whose wires have been released.
+    unsigned int ReleaseWires();
+
   private:
     void FindTPC(std::vector<const TGeoNode*>& path, unsigned int depth);
     void MakeTPC(std::vector<const TGeoNode*>& path, int depth);
@@ -396,6 +421,9 @@ namespace geo {
     TGeoVolume* fVolume;          ///< Total volume of cryostat, called volCryostat in GDML file
     std::string fOpDetGeoName;    ///< Name of opdet geometry elements in gdml
     geo::CryostatID fID;          ///< ID of this cryostat
+
+    /// Index of the positions of the optical detectors (built after sorting).
+    OpDetPositionIndex fOpDetIndex;
   };
 }
 
@@ -0,0 +1,259 @@
+/**
+ * @file   larcorealg/Geometry/DensityVoxelMap.cxx
+ * @brief  Precomputed map of material and density of the detector on a grid.
+ * @see    larcorealg/Geometry/DensityVoxelMap.h
+ */
+
+// class header
+#include "larcorealg/Geometry/DensityVoxelMap.h"
+
+// LArSoft libraries
+#include "larcorealg/Geometry/GeometryCore.h"
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// ROOT libraries
+#include <TGeoMaterial.h>
+
+// C/C++ standard libraries
+#include <algorithm> // std::min(), std::max(), std::find()
+#include <cmath>     // std::ceil(), std::floor(), std::abs(), std::sqrt()
+#include <cstddef>   // std::ptrdiff_t
+#include <limits>
+#include <utility> // std::swap()
+
+namespace geo {
+
+  //----------------------------------------------------------------------------
+  DensityVoxelMap::DensityVoxelMap(GeometryCore const& geom,
+                                   BoxBoundedGeo const& box,
+                                   VoxelSizes_t voxelSizes)
+    : fBox(box)
+  {
+    double const extents[3] = {box.SizeX(), box.SizeY(), box.SizeZ()};
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+      if (!(extents[axis] > 0.0)) {
+        throw cet::exception("DensityVoxelMap")
+          << "The box to be mapped has no extent on axis #" << axis << " (" << box.Min()
+          << " -- " << box.Max() << ")\n";
+      }
+      if (!(voxelSizes[axis] > 0.0)) {
+        throw cet::exception("DensityVoxelMap")
+          << "Invalid voxel size " << voxelSizes[axis] << " on axis #" << axis << "\n";
+      }
+      fNVoxels[axis] = static_cast<std::size_t>(std::ceil(extents[axis] / voxelSizes[axis]));
+      fNVoxels[axis] = std::max(fNVoxels[axis], std::size_t{1U});
+      fVoxelSizes[axis] = extents[axis] / fNVoxels[axis];
+      fInvVoxelSizes[axis] = fNVoxels[axis] / extents[axis];
+    } // for axis
+
+    // material sampling happens at the voxel centers (for the map) and at the
+    // voxel corners (for the uncertainty)
+    auto const sampleDensity = [&geom](Point_t const& point) {
+      TGeoMaterial const* material = geom.Material(point);
+      return material ? material->GetDensity() : 0.0;
+    };
+
+    std::size_t const nVoxels = fNVoxels[0] * fNVoxels[1] * fNVoxels[2];
+    std::size_t const nCornersY = fNVoxels[1] + 1, nCornersZ = fNVoxels[2] + 1;
+    std::vector<double> cornerDensities((fNVoxels[0] + 1) * nCornersY * nCornersZ);
+    auto cornerIndex = [nCornersY, nCornersZ](std::size_t ix, std::size_t iy, std::size_t iz) {
+      return (ix * nCornersY + iy) * nCornersZ + iz;
+    };
+    for (std::size_t ix = 0; ix <= fNVoxels[0]; ++ix) {
+      double const x = box.MinX() + ix * fVoxelSizes[0];
+      for (std::size_t iy = 0; iy <= fNVoxels[1]; ++iy) {
+        double const y = box.MinY() + iy * fVoxelSizes[1];
+        for (std::size_t iz = 0; iz <= fNVoxels[2]; ++iz) {
+          double const z = box.MinZ() + iz * fVoxelSizes[2];
+          cornerDensities[cornerIndex(ix, iy, iz)] = sampleDensity({x, y, z});
+        }
+      }
+    } // for corners
+
+    fMaterialIndex.resize(nVoxels);
+    fDensityErrors.resize(nVoxels);
+    for (std::size_t ix = 0; ix < fNVoxels[0]; ++ix) {
+      double const x = box.MinX() + (ix + 0.5) * fVoxelSizes[0];
+      for (std::size_t iy = 0; iy < fNVoxels[1]; ++iy) {
+        double const y = box.MinY() + (iy + 0.5) * fVoxelSizes[1];
+        for (std::size_t iz = 0; iz < fNVoxels[2]; ++iz) {
+          double const z = box.MinZ() + (iz + 0.5) * fVoxelSizes[2];
+
+          std::size_t const voxel = flatIndex(ix, iy, iz);
+          MaterialIndex_t const iMaterial = materialIndex(geom.Material({x, y, z}));
+          fMaterialIndex[voxel] = iMaterial;
+
+          double const density = fDensities[iMaterial];
+          double maxDiff = 0.0;
+          for (std::size_t cx : {ix, ix + 1})
+            for (std::size_t cy : {iy, iy + 1})
+              for (std::size_t cz : {iz, iz + 1})
+                maxDiff =
+                  std::max(maxDiff, std::abs(cornerDensities[cornerIndex(cx, cy, cz)] - density));
+          fDensityErrors[voxel] = static_cast<float>(maxDiff);
+        } // for z
+      }   // for y
+    }     // for x
+
+  } // DensityVoxelMap::DensityVoxelMap()
+
+  //----------------------------------------------------------------------------
+  TGeoMaterial const* DensityVoxelMap::Material(Point_t const& point) const
+  {
+    std::size_t const voxel = voxelIndex(point);
+    return (voxel == NoVoxel) ? nullptr : fMaterials[fMaterialIndex[voxel]];
+  } // DensityVoxelMap::Material()
+
+  //----------------------------------------------------------------------------
+  double DensityVoxelMap::Density(Point_t const& point) const
+  {
+    std::size_t const voxel = voxelIndex(point);
+    return (voxel == NoVoxel) ? 0.0 : fDensities[fMaterialIndex[voxel]];
+  } // DensityVoxelMap::Density()
+
+  //----------------------------------------------------------------------------
+  template <typename Visitor>
+  void DensityVoxelMap::traverse(Point_t const& p1, Point_t const& p2, Visitor&& visit) const
+  {
+    if (empty()) return;
+
+    double const start[3] = {p1.X(), p1.Y(), p1.Z()};
+    double const dir[3] = {p2.X() - p1.X(), p2.Y() - p1.Y(), p2.Z() - p1.Z()};
+    double const boxMin[3] = {fBox.MinX(), fBox.MinY(), fBox.MinZ()};
+    double const boxMax[3] = {fBox.MaxX(), fBox.MaxY(), fBox.MaxZ()};
+    double const length = std::sqrt(dir[0] * dir[0] + dir[1] * dir[1] + dir[2] * dir[2]);
+    if (!(length > 0.0)) return;
+
+    //
+    // clip the segment (parametrised as `start + t dir`, `t` in [0;1]) to the box
+    //
+    double tEnter = 0.0, tExit = 1.0;
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+      if (dir[axis] == 0.0) {
+        if ((start[axis] < boxMin[axis]) || (start[axis] > boxMax[axis])) return;
+        continue;
+      }
+      double t1 = (boxMin[axis] - start[axis]) / dir[axis];
+      double t2 = (boxMax[axis] - start[axis]) / dir[axis];
+      if (t1 > t2) std::swap(t1, t2);
+      tEnter = std::max(tEnter, t1);
+      tExit = std::min(tExit, t2);
+    } // for axis
+    if (!(tEnter < tExit)) return;
+
+    //
+    // 3D DDA: at each iteration, step to the closest voxel boundary
+    //
+    constexpr double Infinity = std::numeric_limits<double>::infinity();
+    std::ptrdiff_t cell[3], step[3], nCells[3];
+    double tNext[3], tDelta[3];
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+      nCells[axis] = static_cast<std::ptrdiff_t>(fNVoxels[axis]);
+      double const entry = start[axis] + tEnter * dir[axis];
+      double const fCell = std::floor((entry - boxMin[axis]) * fInvVoxelSizes[axis]);
+      cell[axis] = std::min(std::max(static_cast<std::ptrdiff_t>(fCell), std::ptrdiff_t{0}),
+                            nCells[axis] - 1);
+      if (dir[axis] > 0.0) {
+        step[axis] = +1;
+        double const boundary = boxMin[axis] + (cell[axis] + 1) * fVoxelSizes[axis];
+        tNext[axis] = (boundary - start[axis]) / dir[axis];
+        tDelta[axis] = fVoxelSizes[axis] / dir[axis];
+      }
+      else if (dir[axis] < 0.0) {
+        step[axis] = -1;
+        double const boundary = boxMin[axis] + cell[axis] * fVoxelSizes[axis];
+        tNext[axis] = (boundary - start[axis]) / dir[axis];
+        tDelta[axis] = -fVoxelSizes[axis] / dir[axis];
+      }
+      else {
+        step[axis] = 0;
+        tNext[axis] = Infinity;
+        tDelta[axis] = Infinity;
+      }
+    } // for axis
+
+    double t = tEnter;
+    while (true) {
+      std::size_t const axis = (tNext[0] < tNext[1]) ? ((tNext[0] < tNext[2]) ? 0 : 2) :
+                                                       ((tNext[1] < tNext[2]) ? 1 : 2);
+      double const tLeave = std::min(tNext[axis], tExit);
+      if (tLeave > t) {
+        std::size_t const voxel = flatIndex(static_cast<std::size_t>(cell[0]),
+                                            static_cast<std::size_t>(cell[1]),
+                                            static_cast<std::size_t>(cell[2]));
+        visit(voxel, (tLeave - t) * length);
+      }
+      if (tNext[axis] >= tExit) break;
+
+      t = tLeave;
+      cell[axis] += step[axis];
+      if ((cell[axis] < 0) || (cell[axis] >= nCells[axis])) break;
+      tNext[axis] += tDelta[axis];
+    } // while
+
+  } // DensityVoxelMap::traverse()
+
+  //----------------------------------------------------------------------------
+  auto DensityVoxelMap::ColumnDensity(Point_t const& p1, Point_t const& p2) const
+    -> ColumnDensity_t
+  {
+    ColumnDensity_t result;
+    traverse(p1, p2, [this, &result](std::size_t voxel, double length) {
+      result.value += length * fDensities[fMaterialIndex[voxel]];
+      result.error += length * fDensityErrors[voxel];
+    });
+    return result;
+  } // DensityVoxelMap::ColumnDensity()
+
+  //----------------------------------------------------------------------------
+  auto DensityVoxelMap::MaterialSteps(Point_t const& p1, Point_t const& p2) const
+    -> std::vector<MaterialStep_t>
+  {
+    std::vector<MaterialStep_t> steps;
+    traverse(p1, p2, [this, &steps](std::size_t voxel, double length) {
+      TGeoMaterial const* material = fMaterials[fMaterialIndex[voxel]];
+      if (steps.empty() || (steps.back().material != material))
+        steps.push_back({material, length});
+      else
+        steps.back().length += length;
+    });
+    return steps;
+  } // DensityVoxelMap::MaterialSteps()
+
+  //----------------------------------------------------------------------------
+  auto DensityVoxelMap::materialIndex(TGeoMaterial const* material) -> MaterialIndex_t
+  {
+    auto const it = std::find(fMaterials.begin(), fMaterials.end(), material);
+    if (it != fMaterials.end()) return static_cast<MaterialIndex_t>(it - fMaterials.begin());
+
+    if (fMaterials.size() > std::numeric_limits<MaterialIndex_t>::max()) {
+      throw cet::exception("DensityVoxelMap")
+        << "Too many materials in the geometry (" << fMaterials.size() << ")\n";
+    }
+    fMaterials.push_back(material);
+    fDensities.push_back(material ? material->GetDensity() : 0.0);
+    return static_cast<MaterialIndex_t>(fMaterials.size() - 1);
+  } // DensityVoxelMap::materialIndex()
+
+  //----------------------------------------------------------------------------
+  std::size_t DensityVoxelMap::voxelIndex(Point_t const& point) const
+  {
+    if (empty()) return NoVoxel;
+
+    double const coords[3] = {point.X() - fBox.MinX(), point.Y() - fBox.MinY(),
+                              point.Z() - fBox.MinZ()};
+    std::size_t index[3];
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+      double const cell = coords[axis] * fInvVoxelSizes[axis];
+      // written to reject also NaN coordinates
+      if (!((cell >= 0.0) && (cell <= fNVoxels[axis]))) return NoVoxel;
+      index[axis] = std::min(static_cast<std::size_t>(cell), fNVoxels[axis] - 1);
+    }
+    return flatIndex(index[0], index[1], index[2]);
+  } // DensityVoxelMap::voxelIndex()
+
+  //----------------------------------------------------------------------------
+
+} // namespace geo
@@ -0,0 +1,186 @@
+/**
+ * @file   larcorealg/Geometry/DensityVoxelMap.h
+ * @brief  Precomputed map of material and density of the detector on a grid.
+ * @see    larcorealg/Geometry/DensityVoxelMap.cxx
+ * @ingroup Geometry
+ */
+
+#ifndef LARCOREALG_GEOMETRY_DENSITYVOXELMAP_H
+#define LARCOREALG_GEOMETRY_DENSITYVOXELMAP_H
+
+// LArSoft libraries
+#include "larcorealg/Geometry/BoxBoundedGeo.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h" // geo::Point_t
+
+// C/C++ standard libraries
+#include <array>
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint16_t
+#include <vector>
+
+// ROOT libraries
+class TGeoMaterial;
+
+namespace geo {
+
+  class GeometryCore;
+
+  /**
+   * @brief Grid of voxels caching material and density of the detector.
+   * @ingroup Geometry
+   *
+   * The map covers a box (for example `geo::GeometryCore::WorldBox()` or
+   * `geo::GeometryCore::DetectorEnclosureBox()`) with a regular grid of voxels,
+   * and assigns to each voxel the material found at its center.
+   * Queries along a segment traverse the voxels with a 3D DDA algorithm
+   * (Amanatides and Woo), without any geometry navigation: the cost is
+   * proportional to the number of voxels crossed.
+   *
+   * The map is an approximation of the geometry description, whose quality
+   * depends on the resolution chosen at construction.
+   * On construction the material is also sampled at the voxel corners, and each
+   * voxel is assigned an uncertainty on its density, the largest difference
+   * between the density at the center and the ones at the corners.
+   * Column density queries return the sum of the uncertainties of the voxels
+   * crossed, weighted by the length of the crossing, as error bound with respect
+   * to the exact result of `geo::GeometryCore::MassBetweenPoints()`.
+   * Volumes thinner than the voxels may escape the sampling altogether, and in
+   * that case the bound is underestimated.
+   *
+   * Only the part of the segments inside the box of the map is considered.
+   *
+   * Example of use:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * geo::DensityVoxelMap const densityMap
+   *   { geom, geom.DetectorEnclosureBox(), { 1.0, 1.0, 1.0 } };
+   * auto const [ columnDensity, error ] = densityMap.ColumnDensity(start, end);
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * Construction navigates the geometry once per voxel and once per voxel
+   * corner, and may take a long time at fine resolution.
+   */
+  class DensityVoxelMap {
+  public:
+    /// Number of voxels on each direction.
+    using VoxelCounts_t = std::array<std::size_t, 3U>;
+
+    /// Size of the voxels on each direction [cm].
+    using VoxelSizes_t = std::array<double, 3U>;
+
+    /// Result of a column density query.
+    struct ColumnDensity_t {
+      double value = 0.0; ///< Column density.
+      double error = 0.0; ///< Estimated bound on the error of `value`.
+    };
+
+    /// A segment of uniform material.
+    struct MaterialStep_t {
+      TGeoMaterial const* material = nullptr; ///< Material (`nullptr` if none).
+      double length = 0.0;                    ///< Length of the segment [cm].
+    };
+
+    /// Constructor: an empty map, which covers no volume.
+    DensityVoxelMap() = default;
+
+    /**
+     * @brief Constructor: samples the material of the geometry in `box`.
+     * @param geom the geometry to be mapped
+     * @param box the volume to be mapped [cm]
+     * @param voxelSizes the largest size of the voxels on each direction [cm]
+     * @throw cet::exception (category: `DensityVoxelMap`) on invalid arguments
+     *
+     * The number of voxels on each direction is the smallest one with voxels
+     * not larger than the requested size.
+     */
+    DensityVoxelMap(GeometryCore const& geom, BoxBoundedGeo const& box, VoxelSizes_t voxelSizes);
+
+    /// Returns whether the map covers no volume.
+    bool empty() const { return fMaterialIndex.empty(); }
+
+    /// Returns the box covered by the map.
+    BoxBoundedGeo const& Box() const { return fBox; }
+
+    /// Returns the number of voxels on each direction.
+    VoxelCounts_t const& VoxelCounts() const { return fNVoxels; }
+
+    /// Returns the actual size of the voxels on each direction [cm].
+    VoxelSizes_t const& VoxelSizes() const { return fVoxelSizes; }
+
+    /// Returns the number of distinct materials in the map.
+    std::size_t NMaterials() const { return fMaterials.size(); }
+
+    /// Returns the material at `point` (`nullptr` if none or outside the map).
+    TGeoMaterial const* Material(Point_t const& point) const;
+
+    /// Returns the density at `point` (`0` outside the map).
+    double Density(Point_t const& point) const;
+
+    /**
+     * @brief Returns the column density between two points.
+     * @param p1 the first point [cm]
+     * @param p2 the second point [cm]
+     * @return the column density and its error bound
+     * @see `geo::GeometryCore::MassBetweenPoints()`
+     *
+     * Only the part of the segment inside the map is integrated.
+     * The units are the same as in `geo::GeometryCore::MassBetweenPoints()`,
+     * that is the density unit of `TGeoMaterial::GetDensity()` times
+     * centimeters.
+     */
+    ColumnDensity_t ColumnDensity(Point_t const& p1, Point_t const& p2) const;
+
+    /**
+     * @brief Returns the materials crossed by a segment.
+     * @param p1 the first point [cm]
+     * @param p2 the second point [cm]
+     * @return the list of materials in order from `p1` to `p2`
+     *
+     * Consecutive voxels of the same material are merged into a single step.
+     * Only the part of the segment inside the map is included.
+     */
+    std::vector<MaterialStep_t> MaterialSteps(Point_t const& p1, Point_t const& p2) const;
+
+  private:
+    using MaterialIndex_t = std::uint16_t; ///< Type of index in the material table.
+
+    BoxBoundedGeo fBox;            ///< Volume covered by the map.
+    VoxelCounts_t fNVoxels{};      ///< Number of voxels on each axis.
+    VoxelSizes_t fVoxelSizes{};    ///< Size of voxels on each axis.
+    VoxelSizes_t fInvVoxelSizes{}; ///< Inverse of the size of voxels on each axis.
+
+    std::vector<TGeoMaterial const*> fMaterials; ///< Table of the materials.
+    std::vector<double> fDensities;              ///< Density of each material.
+
+    std::vector<MaterialIndex_t> fMaterialIndex; ///< Material of each voxel.
+    std::vector<float> fDensityErrors;           ///< Density uncertainty of each voxel.
+
+    /// Returns the index of `material` in the table, adding it if needed.
+    MaterialIndex_t materialIndex(TGeoMaterial const* material);
+
+    /// Returns the index of the voxel containing `point`, or `NoVoxel`.
+    std::size_t voxelIndex(Point_t const& point) const;
+
+    /// Returns the flat index of the voxel with the specified axis indices.
+    std::size_t flatIndex(std::size_t ix, std::size_t iy, std::size_t iz) const
+    {
+      return (ix * fNVoxels[1] + iy) * fNVoxels[2] + iz;
+    }
+
+    /**
+     * @brief Calls `visit(voxel, length)` for each voxel crossed by a segment.
+     * @param p1 the first point [cm]
+     * @param p2 the second point [cm]
+     * @param visit callable object taking the voxel index and a length [cm]
+     *
+     * Voxels are visited in order from `p1` to `p2`.
+     */
+    template <typename Visitor>
+    void traverse(Point_t const& p1, Point_t const& p2, Visitor&& visit) const;
+
+    /// Value of voxel index denoting a point outside the map.
+    static constexpr std::size_t NoVoxel = static_cast<std::size_t>(-1);
+
+  }; // class DensityVoxelMap
+
+} // namespace geo
+
+#endif // LARCOREALG_GEOMETRY_DENSITYVOXELMAP_H
@@ -0,0 +1,101 @@
+/**
+ * @file   larcorealg/Geometry/DetectorDriftPartitions.cxx
+ * @brief  Drift volume partitions of all the cryostats of the detector.
+ * @see    larcorealg/Geometry/DetectorDriftPartitions.h
+ */
+
+// class header
+#include "larcorealg/Geometry/DetectorDriftPartitions.h"
+
+// LArSoft libraries
+#include "larcorealg/Geometry/BoxBoundedGeo.h"
+#include "larcorealg/Geometry/CryostatGeo.h"
+#include "larcorealg/Geometry/TPCGeo.h"
+
+// C/C++ standard libraries
+#include <array>
+
+namespace {
+
+  /// Box boundaries, expanded by the wiggle factor: { min, max } per axis.
+  using ExpandedBox_t = std::array<std::array<double, 2U>, 3U>;
+
+  /// Returns the range of `box` as `geo::BoxBoundedGeo::CoordinateContained()`
+  /// accepts it with the specified `wiggle` factor.
+  ExpandedBox_t expandedBox(geo::BoxBoundedGeo const& box, double wiggle)
+  {
+    auto const expand = [wiggle](double min, double max) -> std::array<double, 2U> {
+      return {(min > 0) ? min / wiggle : min * wiggle, (max < 0) ? max / wiggle : max * wiggle};
+    };
+    return {expand(box.MinX(), box.MaxX()),
+            expand(box.MinY(), box.MaxY()),
+            expand(box.MinZ(), box.MaxZ())};
+  } // expandedBox()
+
+  /// Returns whether there may be points contained in both boxes.
+  bool overlap(ExpandedBox_t const& a, ExpandedBox_t const& b)
+  {
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+      if ((a[axis][0] > b[axis][1]) || (b[axis][0] > a[axis][1])) return false;
+    }
+    return true;
+  } // overlap()
+
+} // local namespace
+
+namespace geo {
+
+  //----------------------------------------------------------------------------
+  DetectorDriftPartitions::DetectorDriftPartitions(CryostatList_t const& cryostats,
+                                                   double wiggle)
+    : fWiggle(wiggle)
+  {
+    std::vector<TPCID> TPCs;
+    for (CryostatGeo const& cryo : cryostats) {
+      // buildDriftVolumes() does not support cryostats without TPCs
+      fPartitions.push_back((cryo.NTPC() > 0) ? buildDriftVolumes(cryo) :
+                                                DriftPartitions{DriftPartitions::Decomposer_t{}});
+      fFlatPartitions.emplace_back(fPartitions.back());
+      for (TPCGeo const& tpc : cryo.IterateTPCs())
+        TPCs.push_back(tpc.ID());
+    } // for cryostats
+    fTPCmapper = CompactTPCIDmapper<>{TPCs};
+
+    // the TPCs which the linear scan would test before each TPC, and which
+    // may contain the same points
+    fPrecedingOffsets.assign(1U, 0U);
+    for (CryostatGeo const& cryo : cryostats) {
+      std::vector<ExpandedBox_t> boxes;
+      for (TPCGeo const& tpc : cryo.IterateTPCs()) {
+        boxes.push_back(expandedBox(tpc.BoundingBox(), fWiggle));
+        for (std::size_t t = 0; t + 1U < boxes.size(); ++t) {
+          if (overlap(boxes[t], boxes.back())) fPreceding.push_back(&cryo.TPC(t));
+        }
+        fPrecedingOffsets.push_back(fPreceding.size());
+      } // for TPCs
+    }   // for cryostats
+
+  } // DetectorDriftPartitions::DetectorDriftPartitions()
+
+  //----------------------------------------------------------------------------
+  TPCGeo const* DetectorDriftPartitions::findTPC(Point_t const& point,
+                                                 CryostatGeo const& cryo) const
+  {
+    if (hasCryostat(cryo.ID())) {
+      TPCGeo const* tpc = flatPartitions(cryo.ID()).TPCat(point);
+      if (tpc && tpc->ContainsPosition(point, fWiggle)) {
+        std::size_t const iTPC = fTPCmapper.index(tpc->ID());
+        for (std::size_t i = fPrecedingOffsets[iTPC]; i < fPrecedingOffsets[iTPC + 1]; ++i) {
+          if (fPreceding[i]->ContainsPosition(point, fWiggle)) return fPreceding[i];
+        }
+        return tpc;
+      }
+    }
+
+    // points outside the partitions, or in the margin of tolerance
+    return cryo.PositionToTPCptr(point, fWiggle);
+  } // DetectorDriftPartitions::findTPC()
+
+  //----------------------------------------------------------------------------
+
+} // namespace geo
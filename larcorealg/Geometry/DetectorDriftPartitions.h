@@ -0,0 +1,119 @@
+/**
+ * @file   larcorealg/Geometry/DetectorDriftPartitions.h
+ * @brief  Drift volume partitions of all the cryostats of the detector.
+ * @see    larcorealg/Geometry/DetectorDriftPartitions.cxx
+ * @ingroup Geometry
+ */
+
+#ifndef LARCOREALG_GEOMETRY_DETECTORDRIFTPARTITIONS_H
+#define LARCOREALG_GEOMETRY_DETECTORDRIFTPARTITIONS_H
+
+// LArSoft libraries
+#include "larcorealg/Geometry/DriftPartitions.h"
+#include "larcorealg/Geometry/FlatDriftPartitions.h"
+#include "larcorealg/Geometry/GeometryData.h"
+#include "larcorealg/Geometry/GeometryIDmapper.h" // geo::CompactTPCIDmapper
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h" // geo::Point_t
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <vector>
+
+namespace geo {
+
+  class CryostatGeo;
+  class TPCGeo;
+
+  /**
+   * @brief Drift volumes of all the cryostats, for TPC lookup by position.
+   * @ingroup Geometry
+   * @see `geo::buildDriftVolumes()`, `geo::FlatDriftPartitions`,
+   *      `geo::GeometryCore::GetDriftPartitions()`
+   *
+   * The object holds the partitions from `geo::buildDriftVolumes()` of each
+   * cryostat, and their flattened version used for the lookup.
+   *
+   * The partitions assign each point to at most one TPC, without any
+   * tolerance, while the linear scan of the TPCs of a cryostat returns the
+   * first one containing the point within a tolerance factor `wiggle` (see
+   * `geo::BoxBoundedGeo::ContainsPosition()`). `findTPC()` returns the same
+   * TPC as the linear scan: the candidate TPC from the partition is accepted
+   * if it contains the point within the tolerance, after checking the TPCs
+   * with lower ID overlapping with it, which would precede it in the scan;
+   * otherwise, the TPCs of the cryostat are scanned.
+   *
+   * The object keeps pointers to the geometry objects: it must be rebuilt
+   * whenever the cryostat list is changed or sorted.
+   */
+  class DetectorDriftPartitions {
+  public:
+    /// Type of list of cryostats the partitions are built from.
+    using CryostatList_t = GeometryData_t::CryostatList_t;
+
+    /// Constructor: no partitions, no TPC found anywhere.
+    DetectorDriftPartitions() = default;
+
+    /**
+     * @brief Constructor: partitions all the cryostats.
+     * @param cryostats the list of cryostats to be partitioned
+     * @param wiggle tolerance factor as in `geo::BoxBoundedGeo::ContainsPosition()`
+     * @throw cet::exception if `geo::buildDriftVolumes()` fails on a cryostat
+     *
+     * The cryostats must be already sorted (their TPCs too), and must not be
+     * moved for the whole lifetime of this object.
+     */
+    DetectorDriftPartitions(CryostatList_t const& cryostats, double wiggle);
+
+    /// Returns whether there are no cryostats at all.
+    bool empty() const { return fPartitions.empty(); }
+
+    /// Returns the number of partitioned cryostats.
+    std::size_t nCryostats() const { return fPartitions.size(); }
+
+    /// Returns whether the specified cryostat is partitioned.
+    bool hasCryostat(CryostatID const& cryoid) const
+    {
+      return cryoid.isValid && (cryoid.Cryostat < nCryostats());
+    }
+
+    /// Returns the drift partitions of the specified cryostat (no check).
+    DriftPartitions const& partitions(CryostatID const& cryoid) const
+    {
+      return fPartitions[cryoid.Cryostat];
+    }
+
+    /// Returns the flattened drift partitions of the cryostat (no check).
+    FlatDriftPartitions const& flatPartitions(CryostatID const& cryoid) const
+    {
+      return fFlatPartitions[cryoid.Cryostat];
+    }
+
+    /**
+     * @brief Returns the TPC of the specified cryostat containing a point.
+     * @param point the location [cm]
+     * @param cryo the cryostat the TPC is looked for in
+     * @return the TPC of `cryo` containing `point`, `nullptr` if none
+     *
+     * The result is the same as `cryo.PositionToTPCptr(point, wiggle)`.
+     */
+    TPCGeo const* findTPC(Point_t const& point, CryostatGeo const& cryo) const;
+
+  private:
+    double fWiggle = 1.0; ///< Tolerance factor on containment.
+
+    std::vector<DriftPartitions> fPartitions;         ///< Partitions of each cryostat.
+    std::vector<FlatDriftPartitions> fFlatPartitions; ///< Flattened partitions.
+
+    CompactTPCIDmapper<> fTPCmapper; ///< Index of each TPC.
+
+    /// TPCs of lower ID overlapping with TPC `i` are from `fPrecedingOffsets[i]`
+    /// to `fPrecedingOffsets[i+1]`.
+    std::vector<std::size_t> fPrecedingOffsets;
+    std::vector<TPCGeo const*> fPreceding; ///< Overlapping TPCs of lower ID.
+
+  }; // class DetectorDriftPartitions
+
+} // namespace geo
+
+#endif // LARCOREALG_GEOMETRY_DETECTORDRIFTPARTITIONS_H
@@ -0,0 +1,134 @@
+/**
+ * @file   larcorealg/Geometry/FlatDriftPartitions.cxx
+ * @brief  Flattened lookup of TPCs by position in drift volumes.
+ * @see    larcorealg/Geometry/FlatDriftPartitions.h
+ */
+
+// class header
+#include "larcorealg/Geometry/FlatDriftPartitions.h"
+
+// LArSoft libraries
+#include "larcorealg/Geometry/TPCGeo.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::sort(), std::unique(), std::lower_bound(), ...
+#include <iterator>  // std::distance()
+
+namespace {
+
+  /// Sorts the coordinates and removes the duplicates.
+  void sortUnique(std::vector<double>& coords)
+  {
+    std::sort(coords.begin(), coords.end());
+    coords.erase(std::unique(coords.begin(), coords.end()), coords.end());
+  } // sortUnique()
+
+  /**
+   * @brief Returns a coordinate within the specified cell.
+   * @param coords sorted coordinates
+   * @param cell index of the cell
+   *
+   * Cell `2i + 1` is the coordinate `i` itself, cell `2i` the interval
+   * between coordinates `i - 1` and `i`, with cell `0` and the last cell
+   * being the unbounded intervals before the first and after the last
+   * coordinate.
+   */
+  double cellCoordinate(std::vector<double> const& coords, std::size_t cell)
+  {
+    std::size_t const i = cell / 2U;
+    if (cell % 2U == 1U) return coords[i];
+    if (i == 0U) return coords.front() - 1.0;
+    if (i == coords.size()) return coords.back() + 1.0;
+    return (coords[i - 1U] + coords[i]) / 2.0;
+  } // cellCoordinate()
+
+} // local namespace
+
+namespace geo {
+
+  //----------------------------------------------------------------------------
+  FlatDriftPartitions::FlatDriftPartitions(DriftPartitions const& partitions)
+    : fDecomposer(partitions.decomposer)
+  {
+    /*
+     * The partitions only compare coordinates with the boundaries of their
+     * areas, which include them: the answer is the same for all points
+     * between two consecutive boundaries, and it is computed with one of them.
+     */
+    for (DriftPartitions::DriftVolume_t const& volume : partitions.volumes) {
+      fDriftLower.push_back(volume.driftCoverage.lower);
+      fDriftUpper.push_back(volume.driftCoverage.upper);
+
+      std::vector<double> widths, depths;
+      if (volume.partition) {
+        volume.partition->walk([&widths, &depths](auto const& part) {
+          auto const& area = part.area();
+          widths.push_back(area.width.lower);
+          widths.push_back(area.width.upper);
+          depths.push_back(area.depth.lower);
+          depths.push_back(area.depth.upper);
+        });
+      }
+      sortUnique(widths);
+      sortUnique(depths);
+
+      fVolumes.push_back(
+        {fWidths.size(), widths.size(), fDepths.size(), depths.size(), fCells.size()});
+      std::size_t const nWidthCells = 2U * widths.size() + 1U;
+      std::size_t const nDepthCells = 2U * depths.size() + 1U;
+      for (std::size_t iDepth = 0; iDepth < nDepthCells; ++iDepth) {
+        for (std::size_t iWidth = 0; iWidth < nWidthCells; ++iWidth) {
+          fCells.push_back((widths.empty() || depths.empty()) ?
+                             nullptr :
+                             volume.partition->atPoint(cellCoordinate(widths, iWidth),
+                                                       cellCoordinate(depths, iDepth)));
+        }
+      }
+      fWidths.insert(fWidths.end(), widths.begin(), widths.end());
+      fDepths.insert(fDepths.end(), depths.begin(), depths.end());
+    } // for volumes
+
+  } // FlatDriftPartitions::FlatDriftPartitions()
+
+  //----------------------------------------------------------------------------
+  TPCGeo const* FlatDriftPartitions::TPCat(Position_t const& pos) const
+  {
+    auto const comp = fDecomposer.DecomposePoint(pos);
+    return TPCat(comp.distance, comp.projection.X(), comp.projection.Y());
+  } // FlatDriftPartitions::TPCat()
+
+  //----------------------------------------------------------------------------
+  void FlatDriftPartitions::TPCat(std::size_t nPoints,
+                                  Position_t const* points,
+                                  TPCGeo const** TPCs) const
+  {
+    for (std::size_t i = 0; i < nPoints; ++i)
+      TPCs[i] = TPCat(points[i]);
+  } // FlatDriftPartitions::TPCat(batch)
+
+  //----------------------------------------------------------------------------
+  std::size_t FlatDriftPartitions::cellIndex(double const* coords, std::size_t n, double value)
+  {
+    double const* const iCoord = std::lower_bound(coords, coords + n, value);
+    std::size_t const i = std::distance(coords, iCoord);
+    return ((i < n) && (*iCoord == value)) ? (2U * i + 1U) : (2U * i);
+  } // FlatDriftPartitions::cellIndex()
+
+  //----------------------------------------------------------------------------
+  TPCGeo const* FlatDriftPartitions::TPCat(double drift, double width, double depth) const
+  {
+    // the last drift volume starting before `drift`, like in DriftPartitions
+    auto const iNext = std::upper_bound(fDriftLower.cbegin(), fDriftLower.cend(), drift);
+    if (iNext == fDriftLower.cbegin()) return nullptr;
+    std::size_t const iVol = std::distance(fDriftLower.cbegin(), iNext) - 1U;
+    if (drift > fDriftUpper[iVol]) return nullptr;
+
+    Volume_t const& volume = fVolumes[iVol];
+    std::size_t const iWidth = cellIndex(fWidths.data() + volume.firstWidth, volume.nWidths, width);
+    std::size_t const iDepth = cellIndex(fDepths.data() + volume.firstDepth, volume.nDepths, depth);
+    return fCells[volume.firstCell + iDepth * (2U * volume.nWidths + 1U) + iWidth];
+  } // FlatDriftPartitions::TPCat(double, double, double)
+
+  //----------------------------------------------------------------------------
+
+} // namespace geo
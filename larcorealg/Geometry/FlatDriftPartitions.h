@@ -0,0 +1,102 @@
+/**
+ * @file   larcorealg/Geometry/FlatDriftPartitions.h
+ * @brief  Flattened lookup of TPCs by position in drift volumes.
+ * @see    larcorealg/Geometry/FlatDriftPartitions.cxx
+ * @ingroup Geometry
+ */
+
+#ifndef LARCOREALG_GEOMETRY_FLATDRIFTPARTITIONS_H
+#define LARCOREALG_GEOMETRY_FLATDRIFTPARTITIONS_H
+
+// LArSoft libraries
+#include "larcorealg/Geometry/DriftPartitions.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <vector>
+
+namespace geo {
+
+  class TPCGeo;
+
+  /**
+   * @brief Drift volumes of a cryostat, flattened into arrays for TPC lookup.
+   * @ingroup Geometry
+   * @see `geo::DriftPartitions`, `geo::buildDriftVolumes()`
+   *
+   * This object answers the same question as `geo::DriftPartitions::TPCat()`
+   * with the same answers, but instead of walking the hierarchy of partitions
+   * of each drift volume it uses:
+   * * the sorted list of drift ranges of all the drift volumes;
+   * * for each drift volume, the sorted list of all the coordinates where the
+   *   partition may change along width and along depth, and the TPC of each
+   *   cell of the resulting grid.
+   *
+   * A lookup is then a binary search on the drift coordinate, and one on each
+   * of width and depth coordinates, over contiguous arrays.
+   *
+   * Since the areas of the partitions include their boundaries, each
+   * coordinate in the lists is a cell of its own, between the cells of the
+   * intervals around it.
+   *
+   * The object points to the same TPC objects as the partition it is built
+   * from, and it is invalidated when they are.
+   */
+  class FlatDriftPartitions {
+  public:
+    /// Type representing a position in 3D space.
+    using Position_t = DriftPartitions::Position_t;
+
+    /// Constructor: no drift volumes, no TPC found anywhere.
+    FlatDriftPartitions() = default;
+
+    /// Constructor: flattens the specified drift volumes.
+    explicit FlatDriftPartitions(DriftPartitions const& partitions);
+
+    /// Returns the number of drift volumes.
+    std::size_t nVolumes() const { return fVolumes.size(); }
+
+    /// Returns which TPC contains the specified position (`nullptr` if none).
+    TPCGeo const* TPCat(Position_t const& pos) const;
+
+    /**
+     * @brief Finds the TPC containing each of the positions.
+     * @param nPoints number of positions
+     * @param points array of `nPoints` positions [cm]
+     * @param[out] TPCs array of `nPoints` TPC pointers to be filled
+     *
+     * Each result is the same as from `TPCat()` (`nullptr` if no TPC).
+     */
+    void TPCat(std::size_t nPoints, Position_t const* points, TPCGeo const** TPCs) const;
+
+  private:
+    /// Location of the data of one drift volume in the arrays.
+    struct Volume_t {
+      std::size_t firstWidth; ///< Index of the first width coordinate.
+      std::size_t nWidths;    ///< Number of width coordinates.
+      std::size_t firstDepth; ///< Index of the first depth coordinate.
+      std::size_t nDepths;    ///< Number of depth coordinates.
+      std::size_t firstCell;  ///< Index of the first cell.
+    };
+
+    /// Decomposition on drift, width and depth axes.
+    DriftPartitions::Decomposer_t fDecomposer;
+
+    std::vector<double> fDriftLower;   ///< Start of each drift volume, sorted.
+    std::vector<double> fDriftUpper;   ///< End of each drift volume.
+    std::vector<Volume_t> fVolumes;    ///< Layout of each drift volume.
+    std::vector<double> fWidths;       ///< Width coordinates of all volumes.
+    std::vector<double> fDepths;       ///< Depth coordinates of all volumes.
+    std::vector<TPCGeo const*> fCells; ///< TPC of each cell of each volume.
+
+    /// Returns the index of the cell of `value` along sorted `coords`.
+    static std::size_t cellIndex(double const* coords, std::size_t n, double value);
+
+    /// Returns the TPC at the specified decomposed position.
+    TPCGeo const* TPCat(double drift, double width, double depth) const;
+
+  }; // class FlatDriftPartitions
+
+} // namespace geo
+
+#endif // LARCOREALG_GEOMETRY_FLATDRIFTPARTITIONS_H
@@ -12,6 +12,9 @@
 // ROOT libraries
 #include "TGeoNode.h"
 
+// C++ standard library
+#include <utility> // std::move()
+
 //------------------------------------------------------------------------------
 geo::GeoNodePath::operator std::string() const
 {
@@ -30,3 +33,21 @@ geo::GeoNodePath::operator std::string() const
 } // operator std::string()
 
 //------------------------------------------------------------------------------
+geo::TransformationMatrix const& geo::GeoNodePath::updateTransformations() const
+{
+  // the products are performed in the same order as `transformationFromPath()`
+  // does, for the result to be exactly the same
+  while (fTransforms.size() < fNodes.size()) {
+    auto const& nodeMatrix = *(fNodes[fTransforms.size()]->GetMatrix());
+    if (fTransforms.empty())
+      fTransforms.push_back(convertTransformationMatrix<TransformationMatrix>(nodeMatrix));
+    else {
+      TransformationMatrix matrix = fTransforms.back();
+      matrix *= convertTransformationMatrix<TransformationMatrix>(nodeMatrix);
+      fTransforms.push_back(std::move(matrix));
+    }
+  } // while
+  return fTransforms.back();
+} // geo::GeoNodePath::updateTransformations()
+
+//------------------------------------------------------------------------------
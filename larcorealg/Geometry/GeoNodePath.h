@@ -12,6 +12,7 @@
 
 // LArSoft libraries
 #include "larcorealg/Geometry/LocalTransformation.h"
+#include "larcorealg/Geometry/TransformationMatrix.h"
 
 // ROOT libraries
 #include "TGeoNode.h"
@@ -20,6 +21,7 @@
 #include <cstddef> // std::size_t
 #include <initializer_list>
 #include <string>
+#include <type_traits> // std::is_same_v
 #include <vector>
 
 namespace geo {
@@ -33,6 +35,16 @@ namespace geo {
    * It behaves like a `stack` in that it inserts and removes elements at the
    * "top", which is also what defines the current node.
    *
+   * The path also keeps a stack of the accumulated transformations, from the
+   * root node to each node in the path, as `geo::TransformationMatrix`.
+   * The stack is filled on demand by `currentTransformation()`, and it is
+   * trimmed by `pop()`: when the transformation of a node is requested, only
+   * the transformations of the nodes appended after the last request need to
+   * be composed (e.g. a single one for each of the sibling wires in a plane),
+   * while nodes which are only traversed cost nothing.
+   * This caching makes `currentTransformation()` not thread-safe: a path
+   * object must not be shared among threads.
+   *
    */
   class GeoNodePath {
 
@@ -54,12 +66,17 @@ namespace geo {
     GeoNodePath() = default;
 
     /// Sets all the the specified nodes into the current path.
-    GeoNodePath(std::initializer_list<TGeoNode const*> nodes) : fNodes(nodes) {}
+    GeoNodePath(std::initializer_list<TGeoNode const*> nodes) : fNodes(nodes)
+    {
+      fTransforms.reserve(fNodes.size());
+    }
 
     /// Sets the nodes from `begin` to `end` as the path content.
     template <typename Iter>
     GeoNodePath(Iter begin, Iter end) : fNodes(begin, end)
-    {}
+    {
+      fTransforms.reserve(fNodes.size());
+    }
 
     // --- END Constructors and destructor -------------------------------------
 
@@ -73,6 +90,9 @@ namespace geo {
     /// Returns the current node. Undefined if the path is empty.
     Node_t const& current() const { return *(fNodes.back()); }
 
+    /// Returns all the nodes in the path, from the root to the current one.
+    Nodes_t const& nodes() const { return fNodes; }
+
     // --- END Query and access ------------------------------------------------
 
     // --- BEGIN Content management --------------------------------------------
@@ -80,10 +100,20 @@ namespace geo {
     void append(Node_t const& node) { fNodes.push_back(&node); }
 
     /// Removes the current node from the path, moving the current one up.
-    void pop() { fNodes.pop_back(); }
+    void pop()
+    {
+      fNodes.pop_back();
+      if (fTransforms.size() > fNodes.size()) fTransforms.pop_back();
+    }
     // --- END Content management ----------------------------------------------
 
-    /// Returns the total transformation to the current node, as a `Matrix`.
+    /**
+     * @brief Returns the total transformation to the current node.
+     * @tparam Matrix type of the returned transformation matrix
+     *
+     * With `geo::TransformationMatrix`, the accumulated transformation stack
+     * is used and extended; any other type is computed from all the nodes.
+     */
     template <typename Matrix = TGeoHMatrix>
     Matrix currentTransformation() const;
 
@@ -93,6 +123,12 @@ namespace geo {
   private:
     Nodes_t fNodes; ///< Local path of pointers to ROOT geometry nodes.
 
+    /// Transformations from the root to each node (up to the last requested).
+    mutable std::vector<TransformationMatrix> fTransforms;
+
+    /// Extends the transformation stack up to the current node; returns it.
+    TransformationMatrix const& updateTransformations() const;
+
   }; // class GeoNodePath
 
 } // namespace geo
@@ -103,7 +139,12 @@ namespace geo {
 template <typename Matrix /* = TGeoHMatrix */>
 Matrix geo::GeoNodePath::currentTransformation() const
 {
-  return geo::transformationFromPath<Matrix>(fNodes.begin(), fNodes.end());
+  if constexpr (std::is_same_v<Matrix, TransformationMatrix>) {
+    if (fNodes.empty()) return {}; // identity by default construction
+    return updateTransformations();
+  }
+  else
+    return geo::transformationFromPath<Matrix>(fNodes.begin(), fNodes.end());
 } // geo::GeoNodePath::currentTransformation()
 
 //------------------------------------------------------------------------------
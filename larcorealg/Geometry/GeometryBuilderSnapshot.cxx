@@ -0,0 +1,314 @@
+/**
+ * @file   larcorealg/Geometry/GeometryBuilderSnapshot.cxx
+ * @brief  Geometry extractors recording and replaying a geometry snapshot.
+ * @see    `larcorealg/Geometry/GeometryBuilderSnapshot.h`
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/GeometryBuilderSnapshot.h"
+
+// support libraries
+#include "cetlib_except/exception.h"
+
+// C++ standard library
+#include <array>
+#include <cstdint> // std::uint32_t
+#include <tuple>   // std::tie()
+#include <utility> // std::move()
+
+namespace {
+
+  /// Returns a name for the object type, for messages.
+  char const* typeName(geo::GeometrySnapshot::ObjectType type)
+  {
+    using ObjectType = geo::GeometrySnapshot::ObjectType;
+    switch (type) {
+    case ObjectType::Cryostat: return "cryostat";
+    case ObjectType::TPC: return "TPC";
+    case ObjectType::Plane: return "plane";
+    case ObjectType::Wire: return "wire";
+    case ObjectType::OpDet: return "optical detector";
+    case ObjectType::AuxDet: return "auxiliary detector";
+    case ObjectType::AuxDetSensitive: return "auxiliary detector sensitive volume";
+    } // switch
+    return "unknown object";
+  } // typeName()
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+//--- geo::GeometryBuilderSnapshot
+//------------------------------------------------------------------------------
+geo::GeometryBuilderSnapshot::GeometryBuilderSnapshot(GeometrySnapshot const& snapshot)
+  : fSnapshot(snapshot), fChildren(snapshot.size())
+{
+  for (std::size_t iRecord = 0; iRecord < fSnapshot.size(); ++iRecord) {
+    std::uint32_t const parent = fSnapshot.record(iRecord).parent;
+    if (parent == GeometrySnapshot::NoParent)
+      fTopRecords.push_back(iRecord);
+    else
+      fChildren[parent].push_back(iRecord);
+  } // for
+}
+
+//------------------------------------------------------------------------------
+geo::GeometryBuilderSnapshot::Cryostats_t geo::GeometryBuilderSnapshot::doExtractCryostats(
+  Path_t& path)
+{
+  Cryostats_t cryostats;
+  for (std::size_t iRecord : fTopRecords) {
+    if (fSnapshot.record(iRecord).type != ObjectType::Cryostat) continue;
+    cryostats.push_back(makeCryostat(iRecord, path.current()));
+  }
+  return cryostats;
+}
+
+//------------------------------------------------------------------------------
+geo::GeometryBuilderSnapshot::AuxDets_t geo::GeometryBuilderSnapshot::doExtractAuxiliaryDetectors(
+  Path_t& path)
+{
+  AuxDets_t auxDets;
+  for (std::size_t iRecord : fTopRecords) {
+    if (fSnapshot.record(iRecord).type != ObjectType::AuxDet) continue;
+    auxDets.push_back(makeAuxDet(iRecord, path.current()));
+  }
+  return auxDets;
+}
+
+//------------------------------------------------------------------------------
+TGeoNode const& geo::GeometryBuilderSnapshot::findNode(std::size_t iRecord,
+                                                       TGeoNode const& container) const
+{
+  GeometrySnapshot::Record_t const& record = fSnapshot.record(iRecord);
+  GeometrySnapshot::PathIndex_t const* indices = fSnapshot.pathIndices(record);
+
+  TGeoNode const* node = &container;
+  for (std::uint32_t i = 0; i < record.nPathIndices; ++i) {
+    TGeoVolume const* volume = node->GetVolume();
+    if (!volume || (indices[i] >= static_cast<unsigned int>(volume->GetNdaughters()))) {
+      throw cet::exception("GeometrySnapshot")
+        << "The " << typeName(record.type) << " in snapshot record #" << iRecord
+        << " is not in the geometry (no daughter #" << indices[i] << " in node '"
+        << node->GetName() << "')\n";
+    }
+    node = volume->GetNode(indices[i]);
+  } // for
+
+  auto const nameHash = static_cast<std::uint32_t>(GeometrySnapshot::hash(node->GetName()));
+  if (nameHash != record.nameHash) {
+    throw cet::exception("GeometrySnapshot")
+      << "The " << typeName(record.type) << " in snapshot record #" << iRecord
+      << " does not match the geometry node '" << node->GetName() << "'\n";
+  }
+  return *node;
+}
+
+//------------------------------------------------------------------------------
+geo::TransformationMatrix geo::GeometryBuilderSnapshot::transformation(std::size_t iRecord) const
+{
+  auto const& matrix = fSnapshot.record(iRecord).matrix;
+  return TransformationMatrix{matrix.begin(), matrix.end()};
+}
+
+//------------------------------------------------------------------------------
+void geo::GeometryBuilderSnapshot::checkType(std::size_t iRecord, ObjectType type) const
+{
+  ObjectType const recordType = fSnapshot.record(iRecord).type;
+  if (recordType == type) return;
+  throw cet::exception("GeometrySnapshot")
+    << "Snapshot record #" << iRecord << " is a " << typeName(recordType) << ", "
+    << typeName(type) << " expected\n";
+}
+
+//------------------------------------------------------------------------------
+geo::CryostatGeo geo::GeometryBuilderSnapshot::makeCryostat(std::size_t iRecord,
+                                                            TGeoNode const& container) const
+{
+  TGeoNode const& node = findNode(iRecord, container);
+  CryostatGeo::TPCList_t TPCs;
+  CryostatGeo::OpDetList_t opDets;
+  for (std::size_t iChild : fChildren[iRecord]) {
+    if (fSnapshot.record(iChild).type == ObjectType::OpDet)
+      opDets.push_back(makeOpDet(iChild, node));
+    else
+      TPCs.push_back(makeTPC(iChild, node));
+  }
+  return CryostatGeo{node, transformation(iRecord), std::move(TPCs), std::move(opDets)};
+}
+
+//------------------------------------------------------------------------------
+geo::TPCGeo geo::GeometryBuilderSnapshot::makeTPC(std::size_t iRecord,
+                                                  TGeoNode const& container) const
+{
+  checkType(iRecord, ObjectType::TPC);
+  TGeoNode const& node = findNode(iRecord, container);
+  TPCGeo::PlaneCollection_t planes;
+  planes.reserve(fChildren[iRecord].size());
+  for (std::size_t iChild : fChildren[iRecord])
+    planes.push_back(makePlane(iChild, node));
+  return TPCGeo{node, transformation(iRecord), std::move(planes)};
+}
+
+//------------------------------------------------------------------------------
+geo::PlaneGeo geo::GeometryBuilderSnapshot::makePlane(std::size_t iRecord,
+                                                      TGeoNode const& container) const
+{
+  checkType(iRecord, ObjectType::Plane);
+  TGeoNode const& node = findNode(iRecord, container);
+  PlaneGeo::WireCollection_t wires;
+  wires.reserve(fChildren[iRecord].size());
+  for (std::size_t iChild : fChildren[iRecord])
+    wires.push_back(makeWire(iChild, node));
+  return PlaneGeo{node, transformation(iRecord), std::move(wires)};
+}
+
+//------------------------------------------------------------------------------
+geo::WireGeo geo::GeometryBuilderSnapshot::makeWire(std::size_t iRecord,
+                                                    TGeoNode const& container) const
+{
+  checkType(iRecord, ObjectType::Wire);
+  return WireGeo{findNode(iRecord, container), transformation(iRecord)};
+}
+
+//------------------------------------------------------------------------------
+geo::OpDetGeo geo::GeometryBuilderSnapshot::makeOpDet(std::size_t iRecord,
+                                                      TGeoNode const& container) const
+{
+  checkType(iRecord, ObjectType::OpDet);
+  return OpDetGeo{findNode(iRecord, container), transformation(iRecord)};
+}
+
+//------------------------------------------------------------------------------
+geo::AuxDetGeo geo::GeometryBuilderSnapshot::makeAuxDet(std::size_t iRecord,
+                                                        TGeoNode const& container) const
+{
+  TGeoNode const& node = findNode(iRecord, container);
+  AuxDetGeo::AuxDetSensitiveList_t sensitive;
+  sensitive.reserve(fChildren[iRecord].size());
+  for (std::size_t iChild : fChildren[iRecord])
+    sensitive.push_back(makeAuxDetSensitive(iChild, node));
+  return AuxDetGeo{node, transformation(iRecord), std::move(sensitive)};
+}
+
+//------------------------------------------------------------------------------
+geo::AuxDetSensitiveGeo geo::GeometryBuilderSnapshot::makeAuxDetSensitive(
+  std::size_t iRecord,
+  TGeoNode const& container) const
+{
+  checkType(iRecord, ObjectType::AuxDetSensitive);
+  return AuxDetSensitiveGeo{findNode(iRecord, container), transformation(iRecord)};
+}
+
+//------------------------------------------------------------------------------
+//--- geo::GeometrySnapshotRecorder
+//------------------------------------------------------------------------------
+template <typename Make>
+auto geo::GeometrySnapshotRecorder::record(GeometrySnapshot::ObjectType type,
+                                           Path_t& path,
+                                           Make make)
+{
+  openRecord(type, path);
+  auto obj = make(path);
+  closeRecord();
+  return obj;
+}
+
+//------------------------------------------------------------------------------
+geo::AuxDetGeo geo::GeometrySnapshotRecorder::doMakeAuxDet(Path_t& path)
+{
+  return record(GeometrySnapshot::ObjectType::AuxDet, path, [this](Path_t& p) {
+    return GeometryBuilderStandard::doMakeAuxDet(p);
+  });
+}
+
+//------------------------------------------------------------------------------
+geo::AuxDetSensitiveGeo geo::GeometrySnapshotRecorder::doMakeAuxDetSensitive(Path_t& path)
+{
+  return record(GeometrySnapshot::ObjectType::AuxDetSensitive, path, [this](Path_t& p) {
+    return GeometryBuilderStandard::doMakeAuxDetSensitive(p);
+  });
+}
+
+//------------------------------------------------------------------------------
+geo::CryostatGeo geo::GeometrySnapshotRecorder::doMakeCryostat(Path_t& path)
+{
+  return record(GeometrySnapshot::ObjectType::Cryostat, path, [this](Path_t& p) {
+    return GeometryBuilderStandard::doMakeCryostat(p);
+  });
+}
+
+//------------------------------------------------------------------------------
+geo::OpDetGeo geo::GeometrySnapshotRecorder::doMakeOpDet(Path_t& path)
+{
+  return record(GeometrySnapshot::ObjectType::OpDet, path, [this](Path_t& p) {
+    return GeometryBuilderStandard::doMakeOpDet(p);
+  });
+}
+
+//------------------------------------------------------------------------------
+geo::TPCGeo geo::GeometrySnapshotRecorder::doMakeTPC(Path_t& path)
+{
+  return record(GeometrySnapshot::ObjectType::TPC, path, [this](Path_t& p) {
+    return GeometryBuilderStandard::doMakeTPC(p);
+  });
+}
+
+//------------------------------------------------------------------------------
+geo::PlaneGeo geo::GeometrySnapshotRecorder::doMakePlane(Path_t& path)
+{
+  return record(GeometrySnapshot::ObjectType::Plane, path, [this](Path_t& p) {
+    return GeometryBuilderStandard::doMakePlane(p);
+  });
+}
+
+//------------------------------------------------------------------------------
+geo::WireGeo geo::GeometrySnapshotRecorder::doMakeWire(Path_t& path)
+{
+  return record(GeometrySnapshot::ObjectType::Wire, path, [this](Path_t& p) {
+    return GeometryBuilderStandard::doMakeWire(p);
+  });
+}
+
+//------------------------------------------------------------------------------
+void geo::GeometrySnapshotRecorder::openRecord(GeometrySnapshot::ObjectType type,
+                                               Path_t const& path)
+{
+  // the path is recorded starting from the node of the container;
+  // objects with no container start from the root of the path
+  Path_t::Nodes_t const& nodes = path.nodes();
+  std::uint32_t parent = GeometrySnapshot::NoParent;
+  std::size_t startDepth = 1;
+  if (!fOpenRecords.empty()) std::tie(parent, startDepth) = fOpenRecords.back();
+
+  std::vector<PathIndex_t> indices;
+  indices.reserve(nodes.size() - startDepth);
+  for (std::size_t depth = startDepth; depth < nodes.size(); ++depth)
+    indices.push_back(daughterIndex(*(nodes[depth - 1]->GetVolume()), *(nodes[depth])));
+
+  std::array<double, 12U> matrix;
+  path.currentTransformation<TransformationMatrix>().GetComponents(matrix.begin());
+
+  std::size_t const iRecord =
+    fSnapshot.addRecord(type, parent, indices, path.current().GetName(), matrix);
+  fOpenRecords.emplace_back(static_cast<std::uint32_t>(iRecord), nodes.size());
+}
+
+//------------------------------------------------------------------------------
+auto geo::GeometrySnapshotRecorder::daughterIndex(TGeoVolume const& volume, TGeoNode const& node)
+  -> PathIndex_t
+{
+  auto& indices = fDaughterIndices[&volume];
+  if (indices.empty()) {
+    int const n = volume.GetNdaughters();
+    for (int i = 0; i < n; ++i)
+      indices.emplace(volume.GetNode(i), static_cast<PathIndex_t>(i));
+  }
+  auto const it = indices.find(&node);
+  if (it == indices.end()) {
+    throw cet::exception("GeometrySnapshot")
+      << "Node '" << node.GetName() << "' not found in volume '" << volume.GetName() << "'\n";
+  }
+  return it->second;
+}
+
+//------------------------------------------------------------------------------
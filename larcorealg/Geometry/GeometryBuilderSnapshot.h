@@ -0,0 +1,152 @@
+/**
+ * @file   larcorealg/Geometry/GeometryBuilderSnapshot.h
+ * @brief  Geometry extractors recording and replaying a geometry snapshot.
+ * @see    `larcorealg/Geometry/GeometryBuilder.h`,
+ *         `larcorealg/Geometry/GeometrySnapshot.h`,
+ *         `larcorealg/Geometry/GeometryBuilderSnapshot.cxx`
+ */
+
+#ifndef LARCOREALG_GEOMETRY_GEOMETRYBUILDERSNAPSHOT_H
+#define LARCOREALG_GEOMETRY_GEOMETRYBUILDERSNAPSHOT_H
+
+// LArSoft libraries
+#include "larcorealg/Geometry/GeometryBuilderStandard.h"
+#include "larcorealg/Geometry/GeometrySnapshot.h"
+
+// ROOT libraries
+#include "TGeoNode.h"
+#include "TGeoVolume.h"
+
+// C++ standard library
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t
+#include <unordered_map>
+#include <utility> // std::pair
+#include <vector>
+
+namespace geo {
+
+  /**
+   * @brief Geometry builder rebuilding the geometry from a snapshot.
+   * @see `geo::GeometrySnapshot`, `geo::GeometrySnapshotRecorder`
+   *
+   * This builder does not search the ROOT geometry tree: it reaches the node
+   * of each object directly, following the path recorded in the snapshot,
+   * and it uses the recorded transformation instead of composing the ones of
+   * all the nodes in that path.
+   * The resulting objects are the same, in the same order, as the ones built
+   * by the builder which recorded the snapshot.
+   *
+   * If the snapshot does not match the ROOT geometry (a path leads to a
+   * missing node or to a node with a different name, or the objects are not
+   * nested as expected), an exception is thrown (category:
+   * `"GeometrySnapshot"`).
+   */
+  class GeometryBuilderSnapshot : public GeometryBuilder {
+
+  public:
+    /// Constructor: uses the specified snapshot, which must stay available.
+    GeometryBuilderSnapshot(GeometrySnapshot const& snapshot);
+
+  protected:
+    /// Builds all the cryostats in the snapshot.
+    virtual Cryostats_t doExtractCryostats(Path_t& path) override;
+
+    /// Builds all the auxiliary detectors in the snapshot.
+    virtual AuxDets_t doExtractAuxiliaryDetectors(Path_t& path) override;
+
+  private:
+    using ObjectType = GeometrySnapshot::ObjectType;
+
+    GeometrySnapshot const& fSnapshot; ///< The snapshot being replayed.
+
+    /// Index of the records of the objects contained in each record.
+    std::vector<std::vector<std::size_t>> fChildren;
+
+    /// Records of the objects with no container.
+    std::vector<std::size_t> fTopRecords;
+
+    /// Returns the node of the object in `iRecord`, from its `container` node.
+    TGeoNode const& findNode(std::size_t iRecord, TGeoNode const& container) const;
+
+    /// Returns the transformation of the object in `iRecord`.
+    TransformationMatrix transformation(std::size_t iRecord) const;
+
+    /// Throws an exception if the object in `iRecord` is not of `type`.
+    void checkType(std::size_t iRecord, ObjectType type) const;
+
+    // the objects in a record, from the node of their container
+    CryostatGeo makeCryostat(std::size_t iRecord, TGeoNode const& container) const;
+    TPCGeo makeTPC(std::size_t iRecord, TGeoNode const& container) const;
+    PlaneGeo makePlane(std::size_t iRecord, TGeoNode const& container) const;
+    WireGeo makeWire(std::size_t iRecord, TGeoNode const& container) const;
+    OpDetGeo makeOpDet(std::size_t iRecord, TGeoNode const& container) const;
+    AuxDetGeo makeAuxDet(std::size_t iRecord, TGeoNode const& container) const;
+    AuxDetSensitiveGeo makeAuxDetSensitive(std::size_t iRecord, TGeoNode const& container) const;
+
+  }; // class GeometryBuilderSnapshot
+
+  /**
+   * @brief Standard geometry builder which also records a snapshot.
+   * @see `geo::GeometrySnapshot`, `geo::GeometryBuilderSnapshot`
+   *
+   * This builder works exactly like `geo::GeometryBuilderStandard`, and in
+   * addition it records each object it builds into a `geo::GeometrySnapshot`,
+   * which can later be used by `geo::GeometryBuilderSnapshot` to build the
+   * same objects again.
+   *
+   * Recording happens while the objects are built, and this builder always
+   * runs in a single thread, ignoring the `threads` configuration parameter.
+   */
+  class GeometrySnapshotRecorder : public GeometryBuilderStandard {
+
+  public:
+    /// Constructor: configures the standard builder; the snapshot has `key`.
+    GeometrySnapshotRecorder(Config const& config, GeometrySnapshot::Hash_t key)
+      : GeometryBuilderStandard(config), fSnapshot(key)
+    {
+      fNThreads = 1U; // recording is not thread-safe
+    }
+
+    /// Returns the snapshot of all the objects built so far.
+    GeometrySnapshot const& snapshot() const { return fSnapshot; }
+
+  protected:
+    virtual AuxDetGeo doMakeAuxDet(Path_t& path) override;
+    virtual AuxDetSensitiveGeo doMakeAuxDetSensitive(Path_t& path) override;
+    virtual CryostatGeo doMakeCryostat(Path_t& path) override;
+    virtual OpDetGeo doMakeOpDet(Path_t& path) override;
+    virtual TPCGeo doMakeTPC(Path_t& path) override;
+    virtual PlaneGeo doMakePlane(Path_t& path) override;
+    virtual WireGeo doMakeWire(Path_t& path) override;
+
+  private:
+    using PathIndex_t = GeometrySnapshot::PathIndex_t;
+
+    GeometrySnapshot fSnapshot; ///< The snapshot being recorded.
+
+    /// Objects being built (record and depth of their node), innermost last.
+    std::vector<std::pair<std::uint32_t, std::size_t>> fOpenRecords;
+
+    /// Cache of the index of each daughter node in its mother volume.
+    std::unordered_map<TGeoVolume const*, std::unordered_map<TGeoNode const*, PathIndex_t>>
+      fDaughterIndices;
+
+    /// Records the object at the current node of `path` and opens it.
+    void openRecord(GeometrySnapshot::ObjectType type, Path_t const& path);
+
+    /// Closes the innermost object being built.
+    void closeRecord() { fOpenRecords.pop_back(); }
+
+    /// Builds an object with `make` between opening and closing its record.
+    template <typename Make>
+    auto record(GeometrySnapshot::ObjectType type, Path_t& path, Make make);
+
+    /// Returns the index of `node` among the daughters of `volume`.
+    PathIndex_t daughterIndex(TGeoVolume const& volume, TGeoNode const& node);
+
+  }; // class GeometrySnapshotRecorder
+
+} // namespace geo
+
+#endif // LARCOREALG_GEOMETRY_GEOMETRYBUILDERSNAPSHOT_H
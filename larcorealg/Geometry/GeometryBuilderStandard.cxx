@@ -15,8 +15,10 @@
 // ROOT libraries
 
 // C++ standard library
-#include <algorithm> // std::move()
+#include <algorithm> // std::move(), std::max(), std::min()
+#include <exception> // std::exception_ptr, std::rethrow_exception()
 #include <string_view>
+#include <thread>
 
 using namespace std::literals;
 
@@ -52,7 +54,9 @@ namespace {
 
 //------------------------------------------------------------------------------
 geo::GeometryBuilderStandard::GeometryBuilderStandard(Config const& config)
-  : fMaxDepth(config.maxDepth()), fOpDetGeoName(config.opDetGeoName())
+  : fMaxDepth(config.maxDepth())
+  , fOpDetGeoName(config.opDetGeoName())
+  , fNThreads(std::max(config.threads(), 1U))
 {}
 
 //------------------------------------------------------------------------------
@@ -146,6 +150,8 @@ geo::PlaneGeo geo::GeometryBuilderStandard::doMakePlane(Path_t& path)
 //------------------------------------------------------------------------------
 geo::GeometryBuilderStandard::Wires_t geo::GeometryBuilderStandard::doExtractWires(Path_t& path)
 {
+  if (fNThreads > 1)
+    return doExtractGeometryObjectsInParallel(path, isWireNode, &GeometryBuilderStandard::makeWire);
   return doExtractGeometryObjects(path, isWireNode, &GeometryBuilderStandard::makeWire);
 }
 
@@ -189,3 +195,93 @@ geo::GeometryBuilder::GeoColl_t<ObjGeo> geo::GeometryBuilderStandard::doExtractG
 }
 
 //------------------------------------------------------------------------------
+template <typename ObjGeo>
+geo::GeometryBuilder::GeoColl_t<ObjGeo>
+geo::GeometryBuilderStandard::doExtractGeometryObjectsInParallel(
+  Path_t& path,
+  std::function<bool(TGeoNode const&)> const IsObj,
+  ObjGeo (GeometryBuilderStandard::*MakeObj)(Path_t&))
+{
+  //
+  // discover all the candidates first
+  //
+  std::vector<Path_t::Nodes_t> found;
+  Path_t::Nodes_t below;
+  findGeometryObjects(path, IsObj, below, found);
+  if (found.empty()) return {};
+
+  //
+  // create the objects, each thread with a contiguous block of candidates
+  //
+  std::size_t const nBlocks = std::min(static_cast<std::size_t>(fNThreads), found.size());
+  std::vector<GeoColl_t<ObjGeo>> blocks(nBlocks);
+  std::vector<std::exception_ptr> errors(nBlocks);
+  auto makeBlock = [&, this](std::size_t iBlock) {
+    try {
+      std::size_t const begin = found.size() * iBlock / nBlocks;
+      std::size_t const end = found.size() * (iBlock + 1) / nBlocks;
+      Path_t localPath = path; // includes the transformations computed so far
+      GeoColl_t<ObjGeo>& objs = blocks[iBlock];
+      objs.reserve(end - begin);
+      for (std::size_t i = begin; i < end; ++i) {
+        for (TGeoNode const* node : found[i])
+          localPath.append(*node);
+        objs.push_back((this->*MakeObj)(localPath));
+        for (std::size_t n = 0; n < found[i].size(); ++n)
+          localPath.pop();
+      } // for
+    }
+    catch (...) {
+      errors[iBlock] = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(nBlocks - 1);
+  for (std::size_t iBlock = 1; iBlock < nBlocks; ++iBlock)
+    threads.emplace_back(makeBlock, iBlock);
+  makeBlock(0); // this thread takes the first block
+  for (std::thread& thread : threads)
+    thread.join();
+
+  for (std::exception_ptr const& error : errors)
+    if (error) std::rethrow_exception(error);
+
+  //
+  // concatenate the blocks, in order
+  //
+  GeoColl_t<ObjGeo> objs;
+  objs.reserve(found.size());
+  for (GeoColl_t<ObjGeo>& block : blocks)
+    extendCollection(objs, std::move(block));
+  return objs;
+}
+
+//------------------------------------------------------------------------------
+void geo::GeometryBuilderStandard::findGeometryObjects(
+  Path_t& path,
+  std::function<bool(TGeoNode const&)> const& IsObj,
+  Path_t::Nodes_t& below,
+  std::vector<Path_t::Nodes_t>& found) const
+{
+  // same logic as in `doExtractGeometryObjects()`
+  if (IsObj(path.current())) {
+    found.push_back(below);
+    return;
+  }
+
+  if (path.depth() >= fMaxDepth) return;
+
+  TGeoVolume const* volume = path.current().GetVolume();
+  int const n = volume->GetNdaughters();
+  for (int i = 0; i < n; ++i) {
+    TGeoNode const* node = volume->GetNode(i);
+    path.append(*node);
+    below.push_back(node);
+    findGeometryObjects(path, IsObj, below, found);
+    below.pop_back();
+    path.pop();
+  } // for
+}
+
+//------------------------------------------------------------------------------
@@ -30,6 +30,7 @@
 #include <functional>
 #include <limits> // std::numeric_limits<>
 #include <string_view>
+#include <vector>
 
 namespace geo {
 
@@ -40,6 +41,12 @@ namespace geo {
    * a specific type of geometry object (e.g. cryostat, or wire plane within a
    * TPC).
    *
+   * The wires of each plane can be constructed by multiple threads, as
+   * set by the `threads` configuration parameter (by default, only one thread
+   * is used). The discovery of the wires and the construction of all the
+   * other objects stay sequential, and the result is the same regardless of
+   * the number of threads.
+   *
    *
    * Further customization notes
    * ============================
@@ -124,6 +131,12 @@ namespace geo {
         "volOpDetSensitive" // default
       };
 
+      fhicl::Atom<unsigned int> threads{
+        Name("threads"),
+        Comment("number of threads constructing the wires of each plane (1: no threads)"),
+        1U // default
+      };
+
     }; // struct Config
 
     GeometryBuilderStandard(Config const& config);
@@ -139,6 +152,9 @@ namespace geo {
     /// Name of the optical detector nodes.
     std::string fOpDetGeoName = "volOpDetSensitive";
 
+    /// Number of threads constructing the wires of a plane (`1`: no threads).
+    unsigned int fNThreads = 1U;
+
     // --- BEGIN Auxiliary detector information --------------------------------
     /// @name Auxiliary detector information
     /// @{
@@ -340,7 +356,9 @@ namespace geo {
 
     /// Core implementation of `extractWires()`.
     ///
-    /// The actual algorithm is specialization of `doExtractGeometryObjects()`.
+    /// The actual algorithm is specialization of `doExtractGeometryObjects()`,
+    /// or of `doExtractGeometryObjectsInParallel()` if more than one thread is
+    /// configured.
     virtual Wires_t doExtractWires(Path_t& path);
 
     /// Core implementation of `makeWire()`.
@@ -372,6 +390,43 @@ namespace geo {
       std::function<bool(TGeoNode const&)> IsObj,
       ObjGeo (geo::GeometryBuilderStandard::*MakeObj)(Path_t&));
 
+    /**
+     * @brief Multi-thread version of `doExtractGeometryObjects()`.
+     * @tparam ObjGeo the geometry object being extracted (e.g. `geo::WireGeo`)
+     * @param path the path to the node describing the object
+     * @param IsObj function to identify if a node is of the right type
+     * @param MakeObj class method creating the target object from a path
+     * @return a fully constructed object of type `ObjGeo`
+     *
+     * The candidate nodes are first all discovered, as in
+     * `doExtractGeometryObjects()`; then, the list of candidates is split in
+     * up to `fNThreads` contiguous blocks, and the objects of each block are
+     * created in a different thread. The result is the same, in the same
+     * order, as from `doExtractGeometryObjects()`.
+     * `MakeObj` is called concurrently, each time with a different path, and
+     * it must not change the state of the builder.
+     */
+    template <typename ObjGeo>
+    GeoColl_t<ObjGeo> doExtractGeometryObjectsInParallel(
+      Path_t& path,
+      std::function<bool(TGeoNode const&)> IsObj,
+      ObjGeo (geo::GeometryBuilderStandard::*MakeObj)(Path_t&));
+
+    /**
+     * @brief Collects the nodes below `path` of each object found there.
+     * @param path the path to the node where to start the search
+     * @param IsObj function to identify if a node is of the right type
+     * @param below the nodes between the start of the search and `path`
+     * @param[out] found for each candidate, the nodes leading to it from the
+     *                   start of the search
+     *
+     * The candidates are the same as in `doExtractGeometryObjects()`.
+     */
+    void findGeometryObjects(Path_t& path,
+                             std::function<bool(TGeoNode const&)> const& IsObj,
+                             Path_t::Nodes_t& below,
+                             std::vector<Path_t::Nodes_t>& found) const;
+
   }; // class GeometryBuilderStandard
 
 } // namespace geo
@@ -14,9 +14,12 @@
 #include "larcorealg/Geometry/AuxDetGeo.h"
 #include "larcorealg/Geometry/AuxDetSensitiveGeo.h"
 #include "larcorealg/Geometry/Decomposer.h" // geo::vect::dot()
+#include "larcorealg/Geometry/GeometryBuilderSnapshot.h"
 #include "larcorealg/Geometry/GeometryBuilderStandard.h"
+#include "larcorealg/Geometry/GeometrySnapshot.h"
 #include "larcorealg/Geometry/Intersections.h"
 #include "larcorealg/Geometry/OpDetGeo.h"
+#include "larcorealg/Geometry/details/cappedNearestWire.h"
 #include "larcorealg/Geometry/geo_vectors_utils.h"                // geo::vect
 #include "larcorealg/Geometry/geo_vectors_utils_TVector.h"        // geo::vect
 #include "larcoreobj/SimpleTypesAndConstants/PhysicalConstants.h" // util::pi<>
@@ -31,16 +34,19 @@
 #include <TGeoBBox.h>
 #include <TGeoManager.h>
 #include <TGeoMatrix.h>
+#include <TGeoNavigator.h>
 #include <TGeoNode.h>
 #include <TGeoVolume.h>
 
 // C/C++ includes
 #include <algorithm> // std::for_each(), std::transform()
+#include <atomic>    // std::atomic<>
 #include <cctype>    // ::tolower()
 #include <cmath>     // std::abs() ...
 #include <cstddef>   // size_t
 #include <iterator>  // std::back_inserter()
 #include <limits>    // std::numeric_limits<>
+#include <mutex>     // std::call_once()
 #include <numeric>   // std::accumulate
 #include <sstream>   // std::ostringstream
 #include <tuple>
@@ -64,6 +70,9 @@ namespace {
         << caller << " needs two different planes, got " << std::string(pid1) << " twice\n";
     }
   }
+
+  /// Number of ROOT geometry imports so far; navigators of older imports are stale
+  std::atomic<unsigned long> ROOTgeometryGeneration{0UL};
 }
 
 namespace geo {
@@ -75,6 +84,10 @@ namespace geo {
     , fDetectorName(pset.get<std::string>("Name"))
     , fMinWireZDist(pset.get<double>("MinWireZDist", 3.0))
     , fPositionWiggle(pset.get<double>("PositionEpsilon", 1.e-4))
+    , fNavigationThreads(pset.get<unsigned int>("NavigationThreads", 0U))
+    , fSnapshotFile(pset.get<std::string>("SnapshotFile", ""))
+    , fReleaseWires(pset.get<bool>("ReleaseWires", false))
+    , fDriftPartitionLookup(pset.get<bool>("DriftPartitionLookup", false))
     , fBuilderParameters(pset.get<fhicl::ParameterSet>("Builder", fhicl::ParameterSet()))
   {
     std::transform(fDetectorName.begin(), fDetectorName.end(), fDetectorName.begin(), ::tolower);
@@ -85,7 +98,10 @@ namespace geo {
   {
     SortGeometry(pChannelMap->Sorter());
     UpdateAfterSorting(); // after channel mapping has sorted objects, set their IDs
+    if (fReleaseWires) ReleaseWires();
     pChannelMap->Initialize(fGeoData);
+    pChannelMap->IndexAuxDets(AuxDets());
+    fChannelRanges = ChannelRangeTable{*pChannelMap, Cryostats()};
     fChannelMapAlg = move(pChannelMap);
   }
 
@@ -128,6 +144,15 @@ namespace geo {
       }
       TGeoManager::Import(rootfile.c_str());
       gGeoManager->LockGeometry();
+      ++ROOTgeometryGeneration; // navigators cached by the threads are now stale
+    }
+
+    // multi-thread navigation can be enabled only on a closed geometry,
+    // and from the main thread
+    if ((fNavigationThreads > 0) && !gGeoManager->IsMultiThread()) {
+      gGeoManager->SetMaxThreads(fNavigationThreads);
+      mf::LogInfo("GeometryCore") << "ROOT geometry navigation enabled for up to "
+                                  << fNavigationThreads << " threads";
     }
 
     BuildGeometry(builder);
@@ -149,12 +174,54 @@ namespace geo {
                                                                       {"tool_type"});
     // this is a wink to the understanding that we might be using an art-based
     // service provider configuration sprinkled with tools.
-    GeometryBuilderStandard builder{builderConfig()};
+    if (fSnapshotFile.empty()) {
+      GeometryBuilderStandard builder{builderConfig()};
+      LoadGeometryFile(gdmlfile, rootfile, builder, bForceReload);
+      return;
+    }
+
+    // the snapshot depends on the content of the geometry files (even if the
+    // GDML one is not used for building) and on the builder configuration
+    GeometrySnapshot::Hash_t key = GeometrySnapshot::hashFile(gdmlfile);
+    key = GeometrySnapshot::hashFile(rootfile, key);
+    key = GeometrySnapshot::hash(fBuilderParameters.to_string(), key);
+
+    if (auto const snapshot = GeometrySnapshot::read(fSnapshotFile, key)) {
+      try {
+        GeometryBuilderSnapshot builder{*snapshot};
+        LoadGeometryFile(gdmlfile, rootfile, builder, bForceReload);
+        mf::LogInfo("GeometryCore") << "Geometry built from snapshot '" << fSnapshotFile << "'";
+        return;
+      }
+      catch (cet::exception const& e) {
+        mf::LogWarning("GeometryCore") << "Geometry snapshot '" << fSnapshotFile
+                                       << "' can't be used, geometry will be rebuilt:\n"
+                                       << e.what();
+      }
+    }
+
+    GeometrySnapshotRecorder builder{builderConfig(), key};
     LoadGeometryFile(gdmlfile, rootfile, builder, bForceReload);
+    try {
+      builder.snapshot().write(fSnapshotFile);
+    }
+    catch (cet::exception const& e) {
+      // the snapshot is just a shortcut: failing to save it is not fatal
+      mf::LogWarning("GeometryCore") << e.what();
+    }
   }
 
   //......................................................................
-  void GeometryCore::ClearGeometry() { fGeoData = {}; }
+  void GeometryCore::ClearGeometry()
+  {
+    fTPCindex = {};
+    if (fChannelMapAlg) fChannelMapAlg->ClearAuxDetIndex(); // it points to the old detectors
+    fWireTable = {};
+    fWireIntersections = {};
+    fChannelRanges = {};
+    fDriftPartitions.reset();
+    fGeoData = {};
+  }
 
   //......................................................................
   void GeometryCore::SortGeometry(GeoObjectSorter const& sorter)
@@ -183,37 +250,72 @@ namespace geo {
       auto const& TPCviews = tpc.Views();
       allViews.insert(TPCviews.cbegin(), TPCviews.cend());
     }
+
+    // the index points to the geometry objects, which are now in final order
+    fTPCindex = TPCPositionIndex{Cryostats(), 1.0 + fPositionWiggle};
+    fWireTable = WireTable{Cryostats()};
+    fWireIntersections = WireIntersectionTable{fWireTable, Cryostats()};
+    fDriftPartitions = std::make_unique<DriftPartitionsCache_t>(); // built on demand
   }
 
   //......................................................................
-  TGeoManager* GeometryCore::ROOTGeoManager() const { return gGeoManager; }
+  void GeometryCore::ReleaseWires()
+  {
+    unsigned int nReleased = 0;
+    for (CryostatGeo& cryo : Cryostats())
+      nReleased += cryo.ReleaseWires();
 
-  //......................................................................
-  unsigned int GeometryCore::Nchannels() const { return fChannelMapAlg->Nchannels(); }
+    unsigned int nPlanes = 0;
+    for (TPCGeo const& tpc : Iterate<TPCGeo>())
+      nPlanes += tpc.Nplanes();
+    if (nReleased < nPlanes) {
+      mf::LogWarning("GeometryCore") << "Wires of " << (nPlanes - nReleased) << "/" << nPlanes
+                                     << " planes can't be rebuilt on demand, and are kept.";
+    }
+    else {
+      mf::LogInfo("GeometryCore") << "Wires of all " << nPlanes
+                                  << " planes will be built on first access.";
+    }
+  }
 
   //......................................................................
-  unsigned int GeometryCore::Nchannels(readout::ROPID const& ropid) const
-  {
-    return fChannelMapAlg->Nchannels(ropid);
-  }
+  TGeoManager* GeometryCore::ROOTGeoManager() const { return gGeoManager; }
 
   //......................................................................
-  std::vector<raw::ChannelID_t> GeometryCore::ChannelsInTPCs() const
+  TGeoNavigator* GeometryCore::ROOTGeoNavigator() const
   {
-    std::vector<raw::ChannelID_t> channels;
-    channels.reserve(fChannelMapAlg->Nchannels());
+    TGeoManager* const manager = ROOTGeoManager();
+    if (!manager->IsMultiThread()) return manager->GetCurrentNavigator();
 
-    for (auto const& ts : Iterate<readout::TPCsetID>()) {
-      for (auto const t : fChannelMapAlg->TPCsetToTPCs(ts)) {
-        for (auto const& wire : Iterate<WireID>(t)) {
-          channels.push_back(fChannelMapAlg->PlaneWireToChannel(wire));
-        }
+    // each thread creates its own navigator the first time, and caches it
+    // together with the generation of the geometry it belongs to:
+    // a reloaded geometry may be allocated at the same address as the old one,
+    // so the manager pointer alone can't tell a stale navigator;
+    // `AddNavigator()` is serialized by ROOT, while the cache spares the
+    // lookup in the navigator registry at each call
+    thread_local unsigned long navigatorGeneration = 0UL;
+    thread_local TGeoNavigator* navigator = nullptr;
+    unsigned long const generation = ROOTgeometryGeneration.load();
+    if (!navigator || (navigatorGeneration != generation)) {
+      navigator = manager->AddNavigator();
+      if (!navigator) {
+        throw cet::exception("GeometryCore")
+          << "ROOT geometry can't provide a navigator to this thread"
+             " (too many threads? "
+          << fNavigationThreads << " configured via `NavigationThreads`)\n";
       }
+      navigatorGeneration = generation;
     }
-    std::sort(channels.begin(), channels.end());
-    auto last = std::unique(channels.begin(), channels.end());
-    channels.erase(last, channels.end());
-    return channels;
+    return navigator;
+  } // GeometryCore::ROOTGeoNavigator()
+
+  //......................................................................
+  unsigned int GeometryCore::Nchannels() const { return fChannelMapAlg->Nchannels(); }
+
+  //......................................................................
+  unsigned int GeometryCore::Nchannels(readout::ROPID const& ropid) const
+  {
+    return fChannelMapAlg->Nchannels(ropid);
   }
 
   //......................................................................
@@ -318,10 +420,17 @@ namespace geo {
     if (!cryo) return {};
 
     // then ask it about the TPC
-    TPCID tpcid = cryo->PositionToTPCID(point, 1. + fPositionWiggle);
-    if (tpcid) return tpcid;
+    TPCGeo const* tpc = nullptr;
+    if (fDriftPartitionLookup && fDriftPartitions)
+      tpc = GetDriftPartitions().findTPC(point, *cryo);
+    else if (!fTPCindex.empty())
+      tpc = fTPCindex.findTPC(point, *cryo);
+    else
+      tpc = cryo->PositionToTPCptr(point, 1. + fPositionWiggle);
+    if (tpc) return tpc->ID();
 
     // return an invalid TPC ID with cryostat information set:
+    TPCID tpcid;
     tpcid.Cryostat = cryo->ID().Cryostat;
     tpcid.markInvalid();
     return tpcid;
@@ -330,6 +439,8 @@ namespace geo {
   //......................................................................
   CryostatGeo const* GeometryCore::PositionToCryostatPtr(Point_t const& point) const
   {
+    if (!fTPCindex.empty()) return fTPCindex.findCryostat(point);
+
     for (auto const& cryostat : Iterate<CryostatGeo>()) {
       if (cryostat.ContainsPosition(point, 1.0 + fPositionWiggle)) return &cryostat;
     }
@@ -346,6 +457,12 @@ namespace geo {
   //......................................................................
   TPCGeo const* GeometryCore::PositionToTPCptr(Point_t const& point) const
   {
+    if (fDriftPartitionLookup && fDriftPartitions) {
+      CryostatGeo const* cryo = PositionToCryostatPtr(point);
+      return cryo ? GetDriftPartitions().findTPC(point, *cryo) : nullptr;
+    }
+    if (!fTPCindex.empty()) return fTPCindex.findTPC(point);
+
     CryostatGeo const* cryo = PositionToCryostatPtr(point);
     return cryo ? cryo->PositionToTPCptr(point, 1. + fPositionWiggle) : nullptr;
   }
@@ -364,6 +481,19 @@ namespace geo {
     return tpc ? tpc->ID() : TPCID{};
   }
 
+  //......................................................................
+  DetectorDriftPartitions const& GeometryCore::GetDriftPartitions() const
+  {
+    if (!fDriftPartitions) {
+      throw cet::exception("GeometryCore")
+        << "Drift partitions requested before the geometry is sorted.\n";
+    }
+    std::call_once(fDriftPartitions->built, [this]() {
+      fDriftPartitions->partitions = DetectorDriftPartitions{Cryostats(), 1.0 + fPositionWiggle};
+    });
+    return fDriftPartitions->partitions;
+  }
+
   //......................................................................
   void GeometryCore::GetEndID(TPCID& id) const
   {
@@ -431,6 +561,37 @@ namespace geo {
     return AuxDet(ad).SensitiveVolume(sv);
   }
 
+  //......................................................................
+  AuxDetGeo const* GeometryCore::PositionToAuxDetPtr(Point_t const& point,
+                                                     unsigned int& ad,
+                                                     double tolerance) const
+  {
+    std::size_t const iDet = fChannelMapAlg->FindAuxDet(point, AuxDets(), tolerance);
+    if (iDet == ChannelMapAlg::NoAuxDet) {
+      ad = std::numeric_limits<unsigned int>::max();
+      return nullptr;
+    }
+    ad = iDet;
+    return &AuxDets()[iDet];
+  } // GeometryCore::PositionToAuxDetPtr()
+
+  //......................................................................
+  AuxDetSensitiveGeo const* GeometryCore::PositionToAuxDetSensitivePtr(Point_t const& point,
+                                                                       std::size_t& ad,
+                                                                       std::size_t& sv,
+                                                                       double tolerance) const
+  {
+    // ChannelMapAlg::NoAuxDet is std::numeric_limits<std::size_t>::max()
+    sv = ChannelMapAlg::NoAuxDet;
+    ad = fChannelMapAlg->FindAuxDet(point, AuxDets(), tolerance);
+    if (ad == ChannelMapAlg::NoAuxDet) return nullptr;
+
+    AuxDetGeo const& auxDet = AuxDets()[ad];
+    sv = fChannelMapAlg->FindSensitiveAuxDet(point, auxDet, tolerance);
+    if (sv == ChannelMapAlg::NoAuxDet) return nullptr;
+    return &auxDet.SensitiveVolume(sv);
+  } // GeometryCore::PositionToAuxDetSensitivePtr()
+
   //......................................................................
   const AuxDetGeo& GeometryCore::ChannelToAuxDet(std::string const& auxDetName,
                                                  uint32_t const& channel) const
@@ -818,6 +979,17 @@ namespace geo {
     return maxWires;
   }
 
+  //......................................................................
+  std::size_t GeometryCore::WireIndex(WireID const& wireid) const
+  {
+    WireIDmapper const& mapper = GetWireIDmapper();
+    if (!mapper.hasWire(wireid)) {
+      throw cet::exception("GeometryCore") << "WireIndex(): wire " << std::string(wireid)
+                                           << " is not in the detector\n";
+    }
+    return mapper.index(wireid);
+  }
+
   //......................................................................
   void GeometryCore::GetEndID(WireID& id) const
   {
@@ -924,13 +1096,13 @@ namespace geo {
       return "unknownVolume";
     }
 
-    return gGeoManager->FindNode(point.X(), point.Y(), point.Z())->GetName();
+    return ROOTGeoNavigator()->FindNode(point.X(), point.Y(), point.Z())->GetName();
   }
 
   //......................................................................
   TGeoMaterial const* GeometryCore::Material(Point_t const& point) const
   {
-    auto const pNode = gGeoManager->FindNode(point.X(), point.Y(), point.Z());
+    auto const pNode = ROOTGeoNavigator()->FindNode(point.X(), point.Y(), point.Z());
     if (!pNode) return nullptr;
     auto const pMedium = pNode->GetMedium();
     return pMedium ? pMedium->GetMaterial() : nullptr;
@@ -1021,30 +1193,33 @@ namespace geo {
     //bit of column density
     double columnD = 0.;
 
+    // the navigator holds the state of the track: each thread has its own
+    TGeoNavigator* const navigator = ROOTGeoNavigator();
+
     //first initialize a track - get the direction cosines
     Vector_t const dir = (p2 - p1).Unit();
 
     double const dxyz[3] = {dir.X(), dir.Y(), dir.Z()};
     double const cp1[3] = {p1.X(), p1.Y(), p1.Z()};
-    gGeoManager->InitTrack(cp1, dxyz);
+    navigator->InitTrack(cp1, dxyz);
 
     //might be helpful to have a point to a TGeoNode
-    TGeoNode* node = gGeoManager->GetCurrentNode();
+    TGeoNode* node = navigator->GetCurrentNode();
 
     //check that the points are not in the same volume already.
     //if they are in different volumes, keep stepping until you
     //are in the same volume as the second point
-    while (!gGeoManager->IsSameLocation(p2.X(), p2.Y(), p2.Z())) {
-      gGeoManager->FindNextBoundary();
-      columnD += gGeoManager->GetStep() * node->GetMedium()->GetMaterial()->GetDensity();
+    while (!navigator->IsSameLocation(p2.X(), p2.Y(), p2.Z())) {
+      navigator->FindNextBoundary();
+      columnD += navigator->GetStep() * node->GetMedium()->GetMaterial()->GetDensity();
 
       //the act of stepping puts you in the next node and returns that node
-      node = gGeoManager->Step();
+      node = navigator->Step();
     } //end loop to get to volume of second point
 
     //now you are in the same volume as the last point, but not at that point.
     //get the distance between the current point and the last one
-    Point_t const last = vect::makePointFromCoords(gGeoManager->GetCurrentPoint());
+    Point_t const last = vect::makePointFromCoords(navigator->GetCurrentPoint());
     double const lastStep = (p2 - last).R();
     columnD += lastStep * node->GetMedium()->GetMaterial()->GetDensity();
 
@@ -1065,6 +1240,14 @@ namespace geo {
     return fChannelMapAlg->ChannelToWire(channel);
   }
 
+  //--------------------------------------------------------------------
+  std::size_t GeometryCore::ChannelToWireIDs(raw::ChannelID_t channel,
+                                             WireID* wires,
+                                             std::size_t maxWires) const
+  {
+    return fChannelMapAlg->ChannelToWireIDs(channel, wires, maxWires);
+  }
+
   //--------------------------------------------------------------------
   readout::ROPID GeometryCore::ChannelToROP(raw::ChannelID_t channel) const
   {
@@ -1083,6 +1266,63 @@ namespace geo {
     return Plane(planeid).NearestWireID(worldPos);
   }
 
+  //----------------------------------------------------------------------------
+  WireID GeometryCore::NearestWireID(Point_t const& worldPos,
+                                     PlaneID const& planeid,
+                                     bool& outOfRange) const
+  {
+    return Plane(planeid).NearestWireID(worldPos, outOfRange);
+  }
+
+  //----------------------------------------------------------------------------
+  void GeometryCore::WireCoordinates(PlaneID const& planeid,
+                                     std::vector<double> const& YPos,
+                                     std::vector<double> const& ZPos,
+                                     std::vector<double>& wireCoords) const
+  {
+    if (YPos.size() != ZPos.size()) {
+      throw cet::exception("GeometryCore") << "WireCoordinates(): " << YPos.size()
+                                           << " y coordinates but " << ZPos.size() << " z\n";
+    }
+    wireCoords.resize(YPos.size());
+    fChannelMapAlg->WireCoordinates(
+      planeid, YPos.size(), YPos.data(), ZPos.data(), wireCoords.data());
+  }
+
+  //----------------------------------------------------------------------------
+  std::size_t GeometryCore::NearestWireNumbers(PlaneID const& planeid,
+                                               std::vector<double> const& YPos,
+                                               std::vector<double> const& ZPos,
+                                               std::vector<WireID::WireID_t>& wireNos,
+                                               std::vector<bool>& outOfRange) const
+  {
+    if (YPos.size() != ZPos.size()) {
+      throw cet::exception("GeometryCore") << "NearestWireNumbers(): " << YPos.size()
+                                           << " y coordinates but " << ZPos.size() << " z\n";
+    }
+    std::size_t const n = YPos.size();
+    double const nWires = Plane(planeid).Nwires();
+    wireNos.resize(n);
+    outOfRange.resize(n);
+
+    // wire coordinates are computed in blocks, to avoid allocating a buffer
+    constexpr std::size_t BlockSize = 256;
+    double wireCoords[BlockSize];
+    std::size_t nOutOfRange = 0;
+    for (std::size_t first = 0; first < n; first += BlockSize) {
+      std::size_t const nBlock = std::min(BlockSize, n - first);
+      fChannelMapAlg->WireCoordinates(
+        planeid, nBlock, YPos.data() + first, ZPos.data() + first, wireCoords);
+      for (std::size_t i = 0; i < nBlock; ++i) {
+        bool bad;
+        wireNos[first + i] = details::cappedNearestWire(wireCoords[i], nWires, bad);
+        outOfRange[first + i] = bad;
+        nOutOfRange += bad;
+      }
+    }
+    return nOutOfRange;
+  }
+
   //----------------------------------------------------------------------------
   raw::ChannelID_t GeometryCore::NearestChannel(Point_t const& worldPos,
                                                 PlaneID const& planeid) const
@@ -1095,11 +1335,24 @@ namespace geo {
     // * according to documentation, should return invalid channel
     // * in the actual code throw an exception because of a BUG
     //
-    // The following implementation automatically becomes in fact compliant to
-    // the documentation if upstreams becomes compliant to.
-    // When that happens, just delete this comment.
-    WireID const wireID = NearestWireID(worldPos, planeid);
-    return wireID ? PlaneWireToChannel(wireID) : raw::InvalidChannelID;
+    // The common case (point within the plane) uses the non-throwing lookup;
+    // only out of range the throwing version is called, to produce the same
+    // exception as before.
+    PlaneGeo const& plane = Plane(planeid);
+    bool outOfRange = false;
+    WireID const wireID = plane.NearestWireID(worldPos, outOfRange);
+    if (!outOfRange) return PlaneWireToChannel(wireID);
+
+    plane.NearestWireID(worldPos); // throws InvalidWireError
+    return raw::InvalidChannelID;
+  }
+
+  //----------------------------------------------------------------------------
+  raw::ChannelID_t GeometryCore::NearestChannel(Point_t const& worldPos,
+                                                PlaneID const& planeid,
+                                                bool& outOfRange) const
+  {
+    return PlaneWireToChannel(NearestWireID(worldPos, planeid, outOfRange));
   }
 
   //--------------------------------------
@@ -1143,27 +1396,31 @@ namespace geo {
   {
     // [GP] these errors should be exceptions, and this function is deprecated
     // because it violates interoperability
-    std::vector<WireID> chan1wires = ChannelToWire(c1);
-    if (chan1wires.empty()) {
+    // only one wire per channel is supported: a buffer of two is enough
+    // to detect channels with more wires, without allocating memory
+    WireID chan1wires[2];
+    std::size_t const nChan1Wires = ChannelToWireIDs(c1, chan1wires, 2U);
+    if (nChan1Wires == 0) {
       mf::LogError("ChannelsIntersect")
         << "1st channel " << c1 << " maps to no wire (is it a real one?)";
       return false;
     }
-    std::vector<WireID> chan2wires = ChannelToWire(c2);
-    if (chan2wires.empty()) {
+    WireID chan2wires[2];
+    std::size_t const nChan2Wires = ChannelToWireIDs(c2, chan2wires, 2U);
+    if (nChan2Wires == 0) {
       mf::LogError("ChannelsIntersect")
         << "2nd channel " << c2 << " maps to no wire (is it a real one?)";
       return false;
     }
 
-    if (chan1wires.size() > 1) {
+    if (nChan1Wires > 1) {
       mf::LogWarning("ChannelsIntersect")
-        << "1st channel " << c1 << " maps to " << chan2wires.size() << " wires; using the first!";
+        << "1st channel " << c1 << " maps to " << nChan1Wires << " wires; using the first!";
       return false;
     }
-    if (chan2wires.size() > 1) {
+    if (nChan2Wires > 1) {
       mf::LogError("ChannelsIntersect")
-        << "2nd channel " << c2 << " maps to " << chan2wires.size() << " wires; using the first!";
+        << "2nd channel " << c2 << " maps to " << nChan2Wires << " wires; using the first!";
       return false;
     }
 
@@ -1255,6 +1512,73 @@ namespace geo {
       return false;
     }
 
+    return WireIDsIntersectImpl(wid1, wid2, intersection);
+  }
+
+  //......................................................................
+  void GeometryCore::WireIDsIntersect(std::vector<WireID> const& wires1,
+                                      std::vector<WireID> const& wires2,
+                                      std::vector<Point_t>& intersections,
+                                      std::vector<bool>& within) const
+  {
+    if (wires1.size() != wires2.size()) {
+      throw cet::exception("GeometryCore") << "WireIDsIntersect(): " << wires1.size()
+                                           << " first wires but " << wires2.size()
+                                           << " second wires\n";
+    }
+    constexpr auto infinity = std::numeric_limits<double>::infinity();
+
+    std::size_t const nPairs = wires1.size();
+    intersections.resize(nPairs);
+    within.resize(nPairs);
+    for (std::size_t i = 0; i < nPairs; ++i) {
+      if (WireIDsCanIntersect(wires1[i], wires2[i]))
+        within[i] = WireIDsIntersectImpl(wires1[i], wires2[i], intersections[i]);
+      else {
+        intersections[i] = {infinity, infinity, infinity};
+        within[i] = false;
+      }
+    } // for
+  } // GeometryCore::WireIDsIntersect(batch)
+
+  //......................................................................
+  bool GeometryCore::WireIDsCanIntersect(WireID const& wid1, WireID const& wid2) const
+  {
+    if ((wid1.asTPCID() != wid2) || (wid1.Plane == wid2.Plane)) return false;
+    if (!fWireTable.empty()) return fWireTable.hasWire(wid1) && fWireTable.hasWire(wid2);
+    return HasWire(wid1) && HasWire(wid2);
+  }
+
+  //......................................................................
+  bool GeometryCore::WireIDsIntersectImpl(WireID const& wid1,
+                                          WireID const& wid2,
+                                          Point_t& intersection) const
+  {
+    // precomputed kernel for this pair of planes, if wires are uniform
+    if (auto const* kernel = fWireIntersections.kernel(wid1, wid2.Plane)) {
+      IntersectionPointAndOffsets<Point_t> const intersectionAndOffset =
+        (*kernel)(wid1.Wire, wid2.Wire);
+      intersection = intersectionAndOffset.point;
+      return ((std::abs(intersectionAndOffset.offset1) <=
+               fWireTable.halfLength(fWireTable.index(wid1))) &&
+              (std::abs(intersectionAndOffset.offset2) <=
+               fWireTable.halfLength(fWireTable.index(wid2))));
+    }
+
+    // same computation as geo::WiresIntersectionAndOffsets(), from the table
+    if (fWireTable.hasWire(wid1) && fWireTable.hasWire(wid2)) {
+      auto const i1 = fWireTable.index(wid1);
+      auto const i2 = fWireTable.index(wid2);
+      IntersectionPointAndOffsets<Point_t> const intersectionAndOffset =
+        LineClosestPointAndOffsetsWithUnitVectors(fWireTable.center(i1),
+                                                  fWireTable.direction(i1),
+                                                  fWireTable.center(i2),
+                                                  fWireTable.direction(i2));
+      intersection = intersectionAndOffset.point;
+      return ((std::abs(intersectionAndOffset.offset1) <= fWireTable.halfLength(i1)) &&
+              (std::abs(intersectionAndOffset.offset2) <= fWireTable.halfLength(i2)));
+    }
+
     WireGeo const& wire1 = Wire(wid1);
     WireGeo const& wire2 = Wire(wid2);
 
@@ -1616,9 +1940,26 @@ namespace geo {
     return OpDetFromCryo(o, cryo->ID().Cryostat);
   }
 
+  //--------------------------------------------------------------------
+  void GeometryCore::GetClosestOpDet(std::size_t nPoints,
+                                     Point_t const* points,
+                                     unsigned int* opDets) const
+  {
+    for (std::size_t i = 0; i < nPoints; ++i) {
+      CryostatGeo const* cryo = PositionToCryostatPtr(points[i]);
+      if (!cryo) {
+        opDets[i] = std::numeric_limits<unsigned int>::max();
+        continue;
+      }
+      opDets[i] = OpDetFromCryo(cryo->GetClosestOpDet(points[i]), cryo->ID().Cryostat);
+    } // for
+  } // GeometryCore::GetClosestOpDet(batch)
+
   //--------------------------------------------------------------------
   bool GeometryCore::WireIDIntersectionCheck(const WireID& wid1, const WireID& wid2) const
   {
+    if (WireIDsCanIntersect(wid1, wid2)) return true; // no message formatting if good
+
     if (wid1.asTPCID() != wid2) {
       mf::LogError("WireIDIntersectionCheck")
         << "Comparing two wires on different TPCs: return failure.";
@@ -25,16 +25,23 @@
 #include "larcorealg/Geometry/AuxDetSensitiveGeo.h"
 #include "larcorealg/Geometry/BoxBoundedGeo.h"
 #include "larcorealg/Geometry/ChannelMapAlg.h"
+#include "larcorealg/Geometry/ChannelRangeTable.h"
 #include "larcorealg/Geometry/CryostatGeo.h"
+#include "larcorealg/Geometry/DetectorDriftPartitions.h"
 #include "larcorealg/Geometry/GeoObjectSorter.h"
 #include "larcorealg/Geometry/GeometryBuilder.h"
 #include "larcorealg/Geometry/GeometryData.h"
-#include "larcorealg/Geometry/GeometryDataContainers.h" // geo::TPCDataContainer
+#include "larcorealg/Geometry/GeometryDataContainers.h" // geo::TPCDataContainer...
 #include "larcorealg/Geometry/OpDetGeo.h"
 #include "larcorealg/Geometry/PlaneGeo.h"
 #include "larcorealg/Geometry/ReadoutDataContainers.h" // readout::ROPDataContainer
 #include "larcorealg/Geometry/TPCGeo.h"
+#include "larcorealg/Geometry/TPCPositionIndex.h"
+#include "larcorealg/Geometry/WireDataContainer.h"
 #include "larcorealg/Geometry/WireGeo.h"
+#include "larcorealg/Geometry/WireIDmapper.h"
+#include "larcorealg/Geometry/WireIntersectionTable.h"
+#include "larcorealg/Geometry/WireTable.h"
 #include "larcorealg/Geometry/details/geometry_iterator_maker.h"
 #include "larcorealg/Geometry/details/geometry_iterators.h"
 #include "larcorealg/Geometry/fwd.h"
@@ -51,6 +58,7 @@
 #include <cstddef>  // size_t
 #include <iterator> // std::forward_iterator_tag
 #include <memory>   // std::shared_ptr<>
+#include <mutex>    // std::once_flag
 #include <set>
 #include <string>
 #include <type_traits> // std::is_base_of<>
@@ -62,6 +70,7 @@ class TGeoManager;
 class TGeoNode;
 class TGeoVolume;
 class TGeoMaterial;
+class TGeoNavigator;
 
 /// Namespace collecting geometry-related classes utilities
 namespace geo {
@@ -114,6 +123,31 @@ namespace geo {
    * - *MinWireZDist* (real; default: 3)
    * - *PositionEpsilon* (real; default: 0.01%) set the default tolerance
    *   (see DefaultWiggle())
+   * - *NavigationThreads* (integer; default: 0) if positive, ROOT geometry is
+   *   switched to multi-thread mode supporting up to this number of threads,
+   *   each with its own navigator (see ROOTGeoNavigator()); this makes the
+   *   queries navigating the geometry (`VolumeName()`, `Material()`,
+   *   `MaterialName()`, `MassBetweenPoints()`) safe to call concurrently.
+   *   With the default value, all queries share the navigator of the ROOT
+   *   geometry manager and they must not be run concurrently.
+   * - *SnapshotFile* (string; default: empty) path of a binary snapshot of the
+   *   geometry objects (see `geo::GeometrySnapshot`); if the snapshot exists
+   *   and was recorded from the same geometry files and builder configuration,
+   *   `LoadGeometryFile()` rebuilds the geometry objects from it without
+   *   searching the ROOT geometry node tree; otherwise, the geometry is built
+   *   as usual and the snapshot is (re)written. The ROOT geometry is imported,
+   *   and the objects are sorted and mapped to channels, in both cases.
+   *   The default disables the snapshot.
+   * - *ReleaseWires* (boolean; default: `false`) if set, after the geometry
+   *   is set up the wire objects are released, and the ones of each plane are
+   *   rebuilt only when first accessed (see `geo::PlaneGeo::ReleaseWires()`);
+   *   this saves memory for jobs which do not use wires. It does not speed up
+   *   the setup: all wires are still built (and checked to be rebuildable)
+   *   before being released.
+   * - *DriftPartitionLookup* (boolean; default: `false`) if set, the TPC at a
+   *   position is found via the drift partitions of the cryostats (see
+   *   `GetDriftPartitions()`) rather than via the spatial index of the TPCs;
+   *   the answers are the same.
    *
    */
   class GeometryCore {
@@ -257,6 +291,22 @@ namespace geo {
     /// Access to the ROOT geometry description manager
     TGeoManager* ROOTGeoManager() const;
 
+    /**
+     * @brief Returns the ROOT geometry navigator for the current thread.
+     * @return a navigator of the ROOT geometry manager
+     *
+     * If ROOT geometry is in multi-thread mode (see the configuration parameter
+     * *NavigationThreads*), each thread is assigned its own navigator, created
+     * on the first call from that thread and reused afterwards, until the
+     * geometry is loaded again (see `LoadGeometryFile()`).
+     * Otherwise, the current navigator of the ROOT geometry manager is
+     * returned, which is shared by all threads.
+     *
+     * ROOT geometry is prepared for the number of concurrent threads
+     * configured in *NavigationThreads*.
+     */
+    TGeoNavigator* ROOTGeoNavigator() const;
+
     /// Return the name of the world volume (needed by Geant4 simulation)
     const std::string GetWorldVolumeName() const;
 
@@ -487,6 +537,8 @@ namespace geo {
      * @return pointer to the `geo::CryostatGeo` including `point`, or `nullptr`
      *
      * The tolerance used here is the one returned by DefaultWiggle().
+     * After the channel mapping is applied (`ApplyChannelMap()`), the lookup
+     * is performed via a spatial index (`geo::TPCPositionIndex`).
      */
     CryostatGeo const* PositionToCryostatPtr(Point_t const& point) const;
 
@@ -672,6 +724,35 @@ namespace geo {
       return {Ncryostats(), MaxTPCs(), defValue};
     }
 
+    /**
+     * @brief Returns a container with one entry per existing TPC.
+     * @tparam T type of data in the container
+     * @return a container with one default-constructed `T` per TPC
+     * @see `makeTPCData()`, `geo::CompactTPCIDmapper`
+     *
+     * Unlike `makeTPCData()`, the container has room only for the TPCs that
+     * are actually present in each cryostat, and its iteration visits only
+     * them. The container is not updated if the geometry changes.
+     */
+    template <typename T>
+    CompactTPCDataContainer<T> makeCompactTPCData() const
+    {
+      return CompactTPCDataContainer<T>{CompactTPCIDmapper<>{Iterate<TPCID>()}};
+    }
+
+    /**
+     * @brief Returns a container with one entry per existing TPC.
+     * @tparam T type of data in the container
+     * @param defValue the initial value of all elements in the container
+     * @return a container with a copy of `defValue` per TPC
+     * @see `makeCompactTPCData()`
+     */
+    template <typename T>
+    CompactTPCDataContainer<T> makeCompactTPCData(T const& defValue) const
+    {
+      return CompactTPCDataContainer<T>{CompactTPCIDmapper<>{Iterate<TPCID>()}, defValue};
+    }
+
     //@{
     /**
      * @brief Returns the total number of TPCs in the specified cryostat
@@ -753,6 +834,13 @@ namespace geo {
      * @brief Returns the TPC at specified location.
      * @param point the location [cm]
      * @return the `geo::TPCGeo` including `point`, or `nullptr` if none
+     *
+     * The tolerance used here is the one returned by DefaultWiggle().
+     * After the channel mapping is applied (`ApplyChannelMap()`), the lookup
+     * is performed via a spatial index (`geo::TPCPositionIndex`), which takes
+     * constant time on average, or via the drift partitions of the cryostat
+     * (`GetDriftPartitions()`) if so configured (*DriftPartitionLookup*);
+     * before that, all cryostats and TPCs are scanned linearly.
      */
     TPCGeo const* PositionToTPCptr(Point_t const& point) const;
 
@@ -774,6 +862,19 @@ namespace geo {
      */
     TPCID PositionToTPCID(Point_t const& point) const;
 
+    /**
+     * @brief Returns the drift partitions of all the cryostats.
+     * @return the drift partitions of all the cryostats
+     * @throw cet::exception ("GeometryCore" category) if geometry is not sorted
+     * @throw cet::exception if the partitions can't be built
+     * @see `geo::DetectorDriftPartitions`, `geo::buildDriftVolumes()`
+     *
+     * The partitions are built on the first call, which is safe also when
+     * concurrent, and they are kept until the geometry is sorted again or
+     * cleared.
+     */
+    DetectorDriftPartitions const& GetDriftPartitions() const;
+
     ///
     /// iterators
     ///
@@ -963,6 +1064,35 @@ namespace geo {
       return {Ncryostats(), MaxTPCs(), MaxPlanes(), defValue};
     }
 
+    /**
+     * @brief Returns a container with one entry per existing wire plane.
+     * @tparam T type of data in the container
+     * @return a container with one default-constructed `T` per plane
+     * @see `makePlaneData()`, `geo::CompactPlaneIDmapper`
+     *
+     * Unlike `makePlaneData()`, the container has room only for the planes
+     * that are actually present in each TPC, and its iteration visits only
+     * them. The container is not updated if the geometry changes.
+     */
+    template <typename T>
+    CompactPlaneDataContainer<T> makeCompactPlaneData() const
+    {
+      return CompactPlaneDataContainer<T>{CompactPlaneIDmapper<>{Iterate<PlaneID>()}};
+    }
+
+    /**
+     * @brief Returns a container with one entry per existing wire plane.
+     * @tparam T type of data in the container
+     * @param defValue the initial value of all elements in the container
+     * @return a container with a copy of `defValue` per plane
+     * @see `makeCompactPlaneData()`
+     */
+    template <typename T>
+    CompactPlaneDataContainer<T> makeCompactPlaneData(T const& defValue) const
+    {
+      return CompactPlaneDataContainer<T>{CompactPlaneIDmapper<>{Iterate<PlaneID>()}, defValue};
+    }
+
     //@{
     /**
      * @brief Returns the total number of planes in the specified TPC
@@ -1159,6 +1289,65 @@ namespace geo {
     /// Returns the largest number of wires among all planes in this detector
     unsigned int MaxWires() const;
 
+    /**
+     * @brief Returns the index of the wire among all the wires in the detector.
+     * @param wireid ID of the wire
+     * @return index of the wire, from `0` to the number of wires minus one
+     * @throws cet::exception (category: "GeometryCore") if wire not present
+     * @see `WireIDfromIndex()`, `GetWireIDmapper()`
+     *
+     * Wires are counted in `geo::WireID` order (cryostat, TPC, plane, wire)
+     * with no gaps, according to the actual number of wires in each plane.
+     */
+    std::size_t WireIndex(WireID const& wireid) const;
+
+    /// Returns the ID of the wire with the specified `index` (invalid if none).
+    /// @see `WireIndex()`
+    WireID WireIDfromIndex(std::size_t index) const { return GetWireIDmapper().ID(index); }
+
+    /// Returns the mapping between wire IDs and wire indices (`WireIndex()`).
+    WireIDmapper const& GetWireIDmapper() const { return fWireTable.mapper(); }
+
+    /**
+     * @brief Returns a container with one entry per wire.
+     * @tparam T type of data in the container
+     * @return a container with one default-constructed `T` per wire
+     * @see `geo::WireDataContainer`
+     *
+     * The container has room for exactly the wires in the detector, with no
+     * padding for planes with fewer wires than others. Example:
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+     * auto const* geom = lar::providerFrom<geo::GeometryCore>();
+     * auto hitsPerWire
+     *   = geom->makeWireData<std::vector<recob::Hit const*>>();
+     *
+     * for (recob::Hit const& hit: hits) {
+     *   if (hit.WireID()) hitsPerWire[hit.WireID()].push_back(&hit);
+     * } // for
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+     */
+    template <typename T>
+    WireDataContainer<T> makeWireData() const
+    {
+      return {GetWireIDmapper()};
+    }
+
+    /**
+     * @brief Returns a container with one entry per wire.
+     * @tparam T type of data in the container
+     * @param defValue the initial value of all elements in the container
+     * @return a container with a value `defValue` per each wire
+     * @see `geo::WireDataContainer`
+     *
+     * This function operates as `makeWireData() const`, except that it copies
+     * the specified value into all the entries of the container.
+     */
+    template <typename T>
+    WireDataContainer<T> makeWireData(T const& defValue) const
+    {
+      return {GetWireIDmapper(), defValue};
+    }
+
     //@}
 
     //
@@ -1351,6 +1540,8 @@ namespace geo {
      *
      * The start and end are assigned as returned from the geo::WireGeo object.
      * The rules for this assignment are documented in that class.
+     * The ends are read from the wire table (see `GetWireTable()`), which
+     * holds copies of the ones of `geo::WireGeo`.
      *
      * @deprecated use the wire ID interface instead (but note that it does not
      *             sort the ends)
@@ -1359,6 +1550,15 @@ namespace geo {
 
     //@}
 
+    /**
+     * @brief Returns the table of center, ends, direction and length of all wires.
+     * @see `geo::WireTable`
+     *
+     * The table covers all the wires in the detector, in `geo::WireID` order,
+     * and it is available as soon as the geometry is sorted.
+     */
+    WireTable const& GetWireTable() const { return fWireTable; }
+
     //
     // closest wire
     //
@@ -1403,6 +1603,21 @@ namespace geo {
      */
     WireID NearestWireID(Point_t const& point, PlaneID const& planeid) const;
 
+    /**
+     * @brief Returns the ID of the existing wire closest to the position.
+     * @param point the point to be tested [cm]
+     * @param planeid ID of the plane
+     * @param[out] outOfRange set to whether the nearest wire does not exist
+     * @return the ID of the nearest wire, capped to the existing ones
+     * @see `geo::PlaneGeo::NearestWireID(Point_t const&, bool&) const`
+     *
+     * This version does not throw when the point is outside the plane: in that
+     * case, `outOfRange` is set to `true` and the closest existing wire (first
+     * or last in the plane) is returned.
+     * The plane must exist.
+     */
+    WireID NearestWireID(Point_t const& point, PlaneID const& planeid, bool& outOfRange) const;
+
     //@{
     /**
      * @brief Returns the index of the nearest wire to the specified position
@@ -1418,6 +1633,51 @@ namespace geo {
     Length_t WireCoordinate(Point_t const& pos, PlaneID const& planeid) const;
     //@}
 
+    /**
+     * @brief Computes the wire coordinates of many points on a plane.
+     * @param planeid ID of the plane
+     * @param YPos the _y_ coordinate of each point [cm]
+     * @param ZPos the _z_ coordinate of each point [cm]
+     * @param[out] wireCoords filled with the wire coordinate of each point
+     * @throw cet::exception (category: `"GeometryCore"`) if `YPos` and `ZPos`
+     *        have different sizes
+     * @see `ChannelMapAlg::WireCoordinates()`, `NearestWireNumbers()`
+     *
+     * This is the batch version of the wire coordinate computed by the
+     * channel mapping (`ChannelMapAlg::WireCoordinate()`), which, like it,
+     * assumes the drift direction to be along _x_. `wireCoords` is resized
+     * to the number of points, and reusing it avoids any allocation.
+     */
+    void WireCoordinates(PlaneID const& planeid,
+                         std::vector<double> const& YPos,
+                         std::vector<double> const& ZPos,
+                         std::vector<double>& wireCoords) const;
+
+    /**
+     * @brief Finds the number of the nearest wire for many points on a plane.
+     * @param planeid ID of the plane (must exist)
+     * @param YPos the _y_ coordinate of each point [cm]
+     * @param ZPos the _z_ coordinate of each point [cm]
+     * @param[out] wireNos filled with the nearest existing wire of each point
+     * @param[out] outOfRange filled with whether each nearest wire is missing
+     * @return the number of points whose nearest wire does not exist
+     * @throw cet::exception (category: `"GeometryCore"`) if `YPos` and `ZPos`
+     *        have different sizes
+     * @see `WireCoordinates()`,
+     *      `NearestWireID(Point_t const&, PlaneID const&, bool&) const`
+     *
+     * This is the batch version of the non-throwing `NearestWireID()`, using
+     * the wire coordinates from `WireCoordinates()`: for the points whose
+     * nearest wire does not exist, the `outOfRange` flag is set and the
+     * closest existing wire number is written in `wireNos`. The output
+     * vectors are resized to the number of points.
+     */
+    std::size_t NearestWireNumbers(PlaneID const& planeid,
+                                   std::vector<double> const& YPos,
+                                   std::vector<double> const& ZPos,
+                                   std::vector<WireID::WireID_t>& wireNos,
+                                   std::vector<bool>& outOfRange) const;
+
     //
     // wire intersections
     //
@@ -1452,6 +1712,16 @@ namespace geo {
      * To test that the result is not infinity (nor NaN), use
      * `geo::vect::isfinite(intersection)` etc.
      *
+     * The intersection is computed from the precomputed kernels of
+     * `GetWireIntersectionTable()` when available, or from the wire table.
+     * The result agrees with the one from the `geo::WireGeo` objects
+     * (`geo::WiresIntersectionAndOffsets()`) only within rounding: the
+     * difference is expected below 10^-5 cm (`geometry_wire_table_test` checks
+     * this for the first wire of each plane against all the wires of the other
+     * planes of the same TPC). For the same reason,
+     * the return value may differ from the one from the `geo::WireGeo` objects
+     * when the intersection is that close to the end of one of the wires.
+     *
      * @note If `geo::WireGeo` objects are already available, using instead
      *       the free function `geo::WiresIntersection()` or the method
      *       `geo::WireGeo::IntersectionWith()` is faster (and _recommended_).
@@ -1461,6 +1731,49 @@ namespace geo {
     bool WireIDsIntersect(WireID const& wid1, WireID const& wid2, Point_t& intersection) const;
     //@}
 
+    /**
+     * @brief Computes the intersections of many pairs of wires.
+     * @param wires1 IDs of the first wire of each pair
+     * @param wires2 IDs of the second wire of each pair
+     * @param[out] intersections filled with the intersection of each pair
+     * @param[out] within filled with whether each intersection is on both wires
+     * @throw cet::exception (category: `"GeometryCore"`) if `wires1` and
+     *        `wires2` have different sizes
+     * @see `WireIDsIntersect(WireID const&, WireID const&, Point_t&) const`
+     *
+     * Each intersection and flag is the same as the point and the return value
+     * of `WireIDsIntersect(WireID const&, WireID const&, Point_t&) const`,
+     * except that no message is logged for pairs which can't intersect
+     * (see `WireIDsCanIntersect()`). The output vectors are resized to the
+     * number of pairs.
+     */
+    void WireIDsIntersect(std::vector<WireID> const& wires1,
+                          std::vector<WireID> const& wires2,
+                          std::vector<Point_t>& intersections,
+                          std::vector<bool>& within) const;
+
+    /**
+     * @brief Returns whether the intersection of two wires can be computed.
+     * @param wid1 ID of the first wire
+     * @param wid2 ID of the other wire
+     * @return whether both wires exist, in different planes of the same TPC
+     * @see `WireIDsIntersect()`
+     *
+     * This is the check `WireIDsIntersect()` performs, without logging any
+     * message on failure.
+     */
+    bool WireIDsCanIntersect(WireID const& wid1, WireID const& wid2) const;
+
+    /**
+     * @brief Returns the intersection kernels of all pairs of planes.
+     * @see `geo::WireIntersectionTable`
+     *
+     * `WireIDsIntersect()` uses these kernels when available, and it falls
+     * back to the intersection of the single wires otherwise. The two agree
+     * within rounding (see `WireIDsIntersect()`).
+     */
+    WireIntersectionTable const& GetWireIntersectionTable() const { return fWireIntersections; }
+
     //@{
     /**
      * @brief Computes the intersection between two wires.
@@ -1739,6 +2052,17 @@ namespace geo {
     unsigned int GetClosestOpDet(Point_t const& point) const;
     //@}
 
+    /**
+     * @brief Finds the nearest OpChannel to each of the points
+     * @param nPoints number of points
+     * @param points array of `nPoints` locations, in world coordinates
+     * @param[out] opDets array of `nPoints` OpChannels to be filled
+     * @see `GetClosestOpDet(Point_t const&) const`
+     *
+     * Each of the results is the same as from `GetClosestOpDet(Point_t const&)`.
+     */
+    void GetClosestOpDet(std::size_t nPoints, Point_t const* points, unsigned int* opDets) const;
+
     //
     // object description
     //
@@ -1802,8 +2126,9 @@ namespace geo {
      * @param tolerance tolerance (cm) for matches. Default 0
      * @return the index of the detector, or
      *        `std::numeric_limits<unsigned int>::max()` if no detector is there
+     * @see `PositionToAuxDetPtr()`
      *
-     * @bug Actually, an exception is thrown.
+     * @bug Actually, an exception is thrown; `PositionToAuxDetPtr()` does not.
      */
     unsigned int FindAuxDetAtPosition(Point_t const& point, double tolerance = 0) const;
 
@@ -1847,6 +2172,46 @@ namespace geo {
                                                         size_t& sv,
                                                         double tolerance = 0) const;
 
+    /**
+     * @brief Returns the auxiliary detector at specified location, if any
+     * @param point location to be tested
+     * @param ad _(output)_ the auxiliary detector index
+     * @param tolerance tolerance (cm) for matches. Default 0.
+     * @return pointer to the auxiliary detector, `nullptr` if none is there
+     * @see `FindAuxDetAtPosition()`, `PositionToAuxDet()`
+     *
+     * This is the non-throwing version of `FindAuxDetAtPosition()`.
+     * If no detector is found, `ad` is set to
+     * `std::numeric_limits<unsigned int>::max()`.
+     * The detector is looked for by the channel mapping algorithm, via
+     * `geo::ChannelMapAlg::FindAuxDet()`.
+     */
+    AuxDetGeo const* PositionToAuxDetPtr(Point_t const& point,
+                                         unsigned int& ad,
+                                         double tolerance = 0) const;
+
+    /**
+     * @brief Returns the sensitive auxiliary detector at location, if any
+     * @param point location to be tested
+     * @param ad _(output)_ the auxiliary detector index
+     * @param sv _(output)_ the auxiliary detector sensitive volume index
+     * @param tolerance tolerance (cm) for matches. Default 0.
+     * @return pointer to the sensitive volume, `nullptr` if none is there
+     * @see `FindAuxDetSensitiveAtPosition()`, `PositionToAuxDetSensitive()`
+     *
+     * This is the non-throwing version of `FindAuxDetSensitiveAtPosition()`.
+     * If no auxiliary detector is found, both `ad` and `sv` are set to
+     * `std::numeric_limits<std::size_t>::max()`; if the detector is found but
+     * none of its sensitive volumes contains `point`, only `sv` is.
+     * The volume is looked for by the channel mapping algorithm, via
+     * `geo::ChannelMapAlg::FindAuxDet()` and
+     * `geo::ChannelMapAlg::FindSensitiveAuxDet()`.
+     */
+    AuxDetSensitiveGeo const* PositionToAuxDetSensitivePtr(Point_t const& point,
+                                                           std::size_t& ad,
+                                                           std::size_t& sv,
+                                                           double tolerance = 0) const;
+
     const AuxDetGeo& ChannelToAuxDet(
       std::string const& auxDetName,
       uint32_t const& channel) const; // return the AuxDetGeo for the given detector
@@ -1872,8 +2237,93 @@ namespace geo {
     /// @return number of channels in the specified ROP, 0 if non-existent
     unsigned int Nchannels(readout::ROPID const& ropid) const;
 
-    /// @brief Returns an std::vector<ChannelID_t> in all TPCs in a TPCSet
-    std::vector<raw::ChannelID_t> ChannelsInTPCs() const;
+    /**
+     * @brief Returns a container with one entry per readout channel.
+     * @tparam T type of data in the container
+     * @return a container with one default-constructed `T` per channel
+     * @see `readout::ChannelDataContainer`
+     *
+     * The container is indexed by channel number:
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+     * auto const* geom = lar::providerFrom<geo::GeometryCore>();
+     * auto hitsPerChannel
+     *   = geom->makeChannelData<std::vector<recob::Hit const*>>();
+     *
+     * for (recob::Hit const& hit: hits)
+     *   hitsPerChannel[hit.Channel()].push_back(&hit);
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+     */
+    template <typename T>
+    readout::ChannelDataContainer<T> makeChannelData() const
+    {
+      return readout::ChannelDataContainer<T>(Nchannels());
+    }
+
+    /**
+     * @brief Returns a container with one entry per readout channel.
+     * @tparam T type of data in the container
+     * @param defValue the initial value of all elements in the container
+     * @return a container with a value `defValue` per each channel
+     * @see `readout::ChannelDataContainer`
+     *
+     * This function operates as `makeChannelData() const`, except that it
+     * copies the specified value into all the entries of the container.
+     */
+    template <typename T>
+    readout::ChannelDataContainer<T> makeChannelData(T const& defValue) const
+    {
+      return {Nchannels(), defValue};
+    }
+
+    /**
+     * @brief Returns the sorted list of the channels of the wires in the TPCs
+     *        of all TPC sets.
+     *
+     * The list is computed once, when the channel mapping is applied, and a
+     * reference to it is returned (it used to be a new vector on each call).
+     * TPCs which are not in any TPC set do not contribute.
+     */
+    std::vector<raw::ChannelID_t> const& ChannelsInTPCs() const
+    {
+      return fChannelRanges.channelsInTPCs();
+    }
+
+    /**
+     * @brief Returns the ranges of the readout channels of the specified TPC.
+     * @param tpcid ID of the TPC
+     * @return sorted, disjoint ranges of channels (empty if TPC is not present)
+     * @see `GetChannelRangeTable()`
+     *
+     * The ranges include all the channels of the readout planes covering the
+     * TPC. They are computed when the channel mapping is applied, and
+     * returned with no allocation:
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+     * for (geo::ChannelRange const& range: geom->ChannelRangesInTPC(tpcid)) {
+     *   if (range.contains(digit.Channel())) // ...
+     * }
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+     */
+    ChannelRangeTable::Ranges_t ChannelRangesInTPC(TPCID const& tpcid) const
+    {
+      return fChannelRanges.TPCchannels(tpcid);
+    }
+
+    /// Returns the ranges of the readout channels of the specified TPC set.
+    /// @see `ChannelRangesInTPC()`
+    ChannelRangeTable::Ranges_t ChannelRangesInTPCset(readout::TPCsetID const& tpcsetid) const
+    {
+      return fChannelRanges.TPCsetChannels(tpcsetid);
+    }
+
+    /// Returns the range of the readout channels of the specified readout plane.
+    /// @see `ChannelRangesInTPC()`
+    ChannelRangeTable::Ranges_t ChannelRangesInROP(readout::ROPID const& ropid) const
+    {
+      return fChannelRanges.ROPchannels(ropid);
+    }
+
+    /// Returns the table of channel ranges of all TPCs, TPC sets and ROPs.
+    ChannelRangeTable const& GetChannelRangeTable() const { return fChannelRanges; }
     //
     /**
      * @brief Returns a list of possible views in the detector.
@@ -1941,6 +2391,30 @@ namespace geo {
      */
     std::vector<WireID> ChannelToWire(raw::ChannelID_t const channel) const;
 
+    /**
+     * @brief Writes the wires connected to a TPC channel into a buffer
+     * @param channel TPC channel ID
+     * @param wires pointer to the first element of the buffer to be filled
+     * @param maxWires number of wire IDs the buffer can hold
+     * @return the number of wires connected to `channel`
+     * @throws cet::exception (category: "Geometry") if non-existent channel
+     * @see ChannelToWire()
+     *
+     * This is the same as `ChannelToWire()`, but it does not allocate memory
+     * if the channel mapping supports it; see
+     * `geo::ChannelMapAlg::ChannelToWireIDs()` for the details.
+     * Example:
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+     * geo::WireID wire;
+     * if (geom.ChannelToWireIDs(channel, &wire, 1U) == 1U) {
+     *   // the channel has exactly one wire, `wire`
+     * }
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+     */
+    std::size_t ChannelToWireIDs(raw::ChannelID_t channel,
+                                 WireID* wires,
+                                 std::size_t maxWires) const;
+
     /// Returns the ID of the ROP the channel belongs to
     /// @throws cet::exception (category: "Geometry") if non-existent channel
     readout::ROPID ChannelToROP(raw::ChannelID_t channel) const;
@@ -1959,6 +2433,22 @@ namespace geo {
      */
     raw::ChannelID_t NearestChannel(Point_t const& worldLoc, PlaneID const& planeid) const;
 
+    /**
+     * @brief Returns the ID of the channel nearest to the specified position
+     * @param worldLoc 3D coordinates of the point (world reference frame)
+     * @param planeid ID of the wire plane the channel must belong to
+     * @param[out] outOfRange set to whether the nearest wire does not exist
+     * @return the ID of the channel of the nearest existing wire
+     * @see `NearestWireID(Point_t const&, PlaneID const&, bool&) const`
+     *
+     * This version does not throw when the point is outside the plane: in that
+     * case, `outOfRange` is set to `true` and the channel of the closest
+     * existing wire is returned.
+     */
+    raw::ChannelID_t NearestChannel(Point_t const& worldLoc,
+                                    PlaneID const& planeid,
+                                    bool& outOfRange) const;
+
     /**
      * @brief Returns an intersection point of two channels
      * @param c1 one channel ID
@@ -2402,6 +2892,11 @@ namespace geo {
      * This legacy version of `LoadGeometryFile()` uses a standard
      * `geo::GeometryBuilder` implementation.
      * Do not rely on it if you can avoid it.
+     *
+     * If a snapshot file is configured (*SnapshotFile*), the geometry objects
+     * are built from it when its key matches the hash of the content of both
+     * files and of the builder configuration; otherwise, they are built by
+     * the standard builder and the snapshot is written for the next time.
      */
     void LoadGeometryFile(std::string gdmlfile, std::string rootfile, bool bForceReload = false);
 
@@ -2438,6 +2933,18 @@ namespace geo {
                                ///< to look for the closest wire
     double fPositionWiggle;    ///< accounting for rounding errors when testing positions
 
+    /// Number of threads with their own ROOT navigator (0: shared navigator).
+    unsigned int fNavigationThreads;
+
+    /// Path of the geometry snapshot file (empty: no snapshot).
+    std::string fSnapshotFile;
+
+    /// Whether wire objects are released, and rebuilt on first access.
+    bool fReleaseWires;
+
+    /// Whether TPCs are looked up via the drift partitions.
+    bool fDriftPartitionLookup;
+
     /// Configuration for the geometry builder
     /// (needed since builder is created after construction).
     fhicl::ParameterSet fBuilderParameters;
@@ -2447,6 +2954,27 @@ namespace geo {
     // cached values
     std::set<View_t> allViews; ///< All views in the detector.
 
+    /// Index of cryostats and TPCs by position (built after sorting).
+    TPCPositionIndex fTPCindex;
+
+    /// Table of the wires of the detector (built after sorting).
+    WireTable fWireTable;
+
+    /// Intersection kernels of pairs of planes (built with the wire table).
+    WireIntersectionTable fWireIntersections;
+
+    /// Table of the channel ranges (built after channel mapping initialization).
+    ChannelRangeTable fChannelRanges;
+
+    /// Drift partitions of the cryostats, built on first use.
+    struct DriftPartitionsCache_t {
+      std::once_flag built;               ///< Whether the partitions have been built.
+      DetectorDriftPartitions partitions; ///< The partitions.
+    };
+
+    /// Drift partitions (`nullptr` until the geometry is sorted).
+    std::unique_ptr<DriftPartitionsCache_t> fDriftPartitions;
+
     std::vector<TGeoNode const*> FindDetectorEnclosure(
       std::string const& name = "volDetEnclosure") const;
 
@@ -2459,12 +2987,18 @@ namespace geo {
     /// Wire ID check for WireIDsIntersect methods
     bool WireIDIntersectionCheck(const WireID& wid1, const WireID& wid2) const;
 
+    /// Computes the intersection of two wires which can intersect.
+    bool WireIDsIntersectImpl(WireID const& wid1, WireID const& wid2, Point_t& intersection) const;
+
     /// Runs the sorting of geometry with the sorter provided by channel mapping
     void SortGeometry(GeoObjectSorter const& sorter);
 
     /// Performs all the updates needed after sorting
     void UpdateAfterSorting();
 
+    /// Releases the wire objects of all planes, to be rebuilt on first access.
+    void ReleaseWires();
+
     /// Deletes the detector geometry structures
     void ClearGeometry();
 
@@ -2507,9 +3041,8 @@ inline bool geo::GeometryCore::IncrementID(PlaneID& id) const
 
 inline bool geo::GeometryCore::IncrementID(WireID& id) const
 {
-  // this implementation is non-optimal, in that the TPC lookup is
-  // performed both here and, potentially, in IncrementID(PlaneID)
-  unsigned int const nWiresInPlane = Nwires(id);
+  // the wire table answers without looking up the plane object
+  unsigned int const nWiresInPlane = fWireTable.empty() ? Nwires(id) : fWireTable.nWires(id);
   if (++id.Wire < nWiresInPlane) return bool(id); // if was invalid, stays so
   // no more wires in this plane
   id.Wire = 0;
@@ -2668,7 +3201,11 @@ namespace geo {
 inline geo::GeometryCore::Segment<geo::Point_t> geo::GeometryCore::WireEndPoints(
   WireID const& wireid) const
 {
-  WireGeo const& wire = Wire(wireid);
+  if (fWireTable.hasWire(wireid)) {
+    auto const iWire = fWireTable.index(wireid);
+    return {fWireTable.start(iWire), fWireTable.end(iWire)};
+  }
+  WireGeo const& wire = Wire(wireid); // throws if the wire is not present
   return {wire.GetStart(), wire.GetEnd()};
 }
 
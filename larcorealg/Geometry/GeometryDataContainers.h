@@ -26,7 +26,7 @@
 #include <initializer_list>
 #include <stdexcept> // std::out_of_range
 #include <string>
-#include <utility> // std::forward()
+#include <utility> // std::forward(), std::move()
 #include <vector>
 
 namespace geo {
@@ -34,12 +34,20 @@ namespace geo {
   template <typename T, typename Mapper>
   class GeoIDdataContainer;
 
-  template <typename T>
+  template <typename T, typename Mapper = TPCIDmapper<>>
   class TPCDataContainer;
 
-  template <typename T>
+  template <typename T, typename Mapper = PlaneIDmapper<>>
   class PlaneDataContainer;
 
+  /// Container with one element per existing TPC (see `geo::CompactTPCIDmapper`).
+  template <typename T>
+  using CompactTPCDataContainer = TPCDataContainer<T, CompactTPCIDmapper<>>;
+
+  /// Container with one element per existing plane (see `geo::CompactPlaneIDmapper`).
+  template <typename T>
+  using CompactPlaneDataContainer = PlaneDataContainer<T, CompactPlaneIDmapper<>>;
+
   // ---------------------------------------------------------------------------
   namespace details {
 
@@ -184,6 +192,25 @@ public:
    */
   GeoIDdataContainer(std::initializer_list<unsigned int> dims, value_type const& defValue);
 
+  /**
+   * @brief Prepares the container with default-constructed data.
+   * @param mapper the mapping of the IDs to be covered
+   *
+   * The container is sized to host data for all the elements in `mapper`.
+   * Each element in the container is default-constructed.
+   */
+  GeoIDdataContainer(Mapper_t mapper);
+
+  /**
+   * @brief Prepares the container initializing all its data.
+   * @param mapper the mapping of the IDs to be covered
+   * @param defValue the value copied to fill all entries in the container
+   *
+   * The container is sized to host data for all the elements in `mapper`.
+   * Each element in the container is constructed as copy of `defValue`.
+   */
+  GeoIDdataContainer(Mapper_t mapper, value_type const& defValue);
+
   // --- BEGIN Container status query ----------------------------------------
   /// @name Container status query
   /// @{
@@ -522,14 +549,20 @@ private:
  *   geometry or not
  * * at least one element is expected to be present
  *
+ * These assumptions do not apply when the container uses the mapping
+ * `geo::CompactTPCIDmapper` (`geo::CompactTPCDataContainer`), built from
+ * the actual TPCs: then each cryostat has room for just its own TPCs, and
+ * iterations visit only existing TPCs.
+ *
  */
-template <typename T>
-class geo::TPCDataContainer : public geo::GeoIDdataContainer<T, geo::TPCIDmapper<>> {
+template <typename T, typename Mapper /* = geo::TPCIDmapper<> */>
+class geo::TPCDataContainer : public geo::GeoIDdataContainer<T, Mapper> {
 
-  using BaseContainer_t = geo::GeoIDdataContainer<T, geo::TPCIDmapper<>>;
+  using BaseContainer_t = geo::GeoIDdataContainer<T, Mapper>;
 
 public:
   using value_type = typename BaseContainer_t::value_type;
+  using Mapper_t = typename BaseContainer_t::Mapper_t;
 
   /**
    * @brief Default constructor: empty container.
@@ -571,6 +604,14 @@ public:
     : BaseContainer_t({nCryo, nTPCs}, defValue)
   {}
 
+  /// Prepares the container with default-constructed data for `mapper` TPCs.
+  TPCDataContainer(Mapper_t mapper) : BaseContainer_t(std::move(mapper)) {}
+
+  /// Prepares the container with copies of `defValue` for `mapper` TPCs.
+  TPCDataContainer(Mapper_t mapper, value_type const& defValue)
+    : BaseContainer_t(std::move(mapper), defValue)
+  {}
+
   // --- BEGIN Container modification ------------------------------------------
   /// @name Container modification
   /// @{
@@ -666,14 +707,22 @@ public:
  *   TPC actually exists in the geometry or not
  * * at least one element is expected to be present
  *
+ * These assumptions do not apply when the container uses the mapping
+ * `geo::CompactPlaneIDmapper` (`geo::CompactPlaneDataContainer`), built
+ * from the actual planes: then each TPC has room for just its own planes, and
+ * iterations visit only existing planes.
+ *
  */
-template <typename T>
-class geo::PlaneDataContainer : public geo::GeoIDdataContainer<T, geo::PlaneIDmapper<>> {
+template <typename T, typename Mapper /* = geo::PlaneIDmapper<> */>
+class geo::PlaneDataContainer : public geo::GeoIDdataContainer<T, Mapper> {
 
   /// Base class.
-  using BaseContainer_t = geo::GeoIDdataContainer<T, geo::PlaneIDmapper<>>;
+  using BaseContainer_t = geo::GeoIDdataContainer<T, Mapper>;
 
 public:
+  using value_type = typename BaseContainer_t::value_type;
+  using Mapper_t = typename BaseContainer_t::Mapper_t;
+
   /**
    * @brief Default constructor: empty container.
    * @see `resize()`
@@ -721,6 +770,14 @@ public:
     : BaseContainer_t{{nCryo, nTPCs, nPlanes}, defValue}
   {}
 
+  /// Prepares the container with default-constructed data for `mapper` planes.
+  PlaneDataContainer(Mapper_t mapper) : BaseContainer_t(std::move(mapper)) {}
+
+  /// Prepares the container with copies of `defValue` for `mapper` planes.
+  PlaneDataContainer(Mapper_t mapper, value_type const& defValue)
+    : BaseContainer_t(std::move(mapper), defValue)
+  {}
+
   // --- BEGIN Container modification ------------------------------------------
   /// @name Container modification
   /// @{
@@ -1165,11 +1222,23 @@ geo::GeoIDdataContainer<T, Mapper>::GeoIDdataContainer(std::initializer_list<uns
 template <typename T, typename Mapper>
 geo::GeoIDdataContainer<T, Mapper>::GeoIDdataContainer(std::initializer_list<unsigned int> dims,
                                                        value_type const& defValue)
-  : fMapper(dims), fData(fMapper.computeSize(), defValue)
+  : fMapper(dims), fData(fMapper.size(), defValue)
 {
   assert(!fData.empty());
 }
 
+//------------------------------------------------------------------------------
+template <typename T, typename Mapper>
+geo::GeoIDdataContainer<T, Mapper>::GeoIDdataContainer(Mapper_t mapper)
+  : fMapper(std::move(mapper)), fData(fMapper.size())
+{}
+
+//------------------------------------------------------------------------------
+template <typename T, typename Mapper>
+geo::GeoIDdataContainer<T, Mapper>::GeoIDdataContainer(Mapper_t mapper, value_type const& defValue)
+  : fMapper(std::move(mapper)), fData(fMapper.size(), defValue)
+{}
+
 //------------------------------------------------------------------------------
 template <typename T, typename Mapper>
 auto geo::GeoIDdataContainer<T, Mapper>::size() const -> size_type
@@ -15,12 +15,16 @@
 #include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
 
 // C/C++ standard libraries
-#include <algorithm> // std::copy()
+#include <algorithm> // std::copy(), std::upper_bound(), std::max()
 #include <array>
 #include <cassert>
 #include <cstdlib> // std::size_t
 #include <initializer_list>
+#include <iterator>    // std::distance()
+#include <numeric>     // std::partial_sum()
 #include <type_traits> // std::index_sequence
+#include <utility>     // std::declval()
+#include <vector>
 
 namespace geo {
 
@@ -33,6 +37,17 @@ namespace geo {
   template <typename Index = std::size_t>
   class PlaneIDmapper;
 
+  template <typename IDType, typename Index = std::size_t>
+  class CompactGeoIDmapper;
+
+  /// Mapping for TPC identifiers covering only the existing TPCs.
+  template <typename Index = std::size_t>
+  using CompactTPCIDmapper = CompactGeoIDmapper<geo::TPCID, Index>;
+
+  /// Mapping for plane identifiers covering only the existing planes.
+  template <typename Index = std::size_t>
+  using CompactPlaneIDmapper = CompactGeoIDmapper<geo::PlaneID, Index>;
+
   // ---------------------------------------------------------------------------
   namespace details {
 
@@ -383,6 +398,183 @@ public:
 
 }; // geo::PlaneIDmapper<>
 
+/** ****************************************************************************
+ * @brief Mapping between geometry ID and flat index with no padding.
+ * @tparam IDType the geometry or readout ID to be managed
+ * @tparam Index (default: `std::size_t`) type of flat index
+ * @see `geo::GeoIDmapper`
+ *
+ * This mapping has the same interface as `geo::GeoIDmapper`, and it also keeps
+ * the indices ordered like their respective IDs with no gaps, but each element
+ * may have a different number of sub-elements: for example, cryostats may
+ * have different number of TPCs, and TPCs may have different number of
+ * planes. Only the existing elements are mapped, which is useful on
+ * asymmetric detectors, where `geo::GeoIDmapper` would reserve room for the
+ * largest element everywhere.
+ *
+ * The layout is learnt from the list of all the existing IDs, e.g.:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * geo::CompactPlaneIDmapper<> const mapper{ geom->Iterate<geo::PlaneID>() };
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * For each level, the mapping stores the index of the first sub-element of
+ * each element of the level above (prefix sums of the number of
+ * sub-elements). `index()` takes constant time, while `ID()` takes a binary
+ * search for each level.
+ *
+ * Constructed from dimension sizes, the mapping has the same layout as
+ * `geo::GeoIDmapper` (a "hyperbox").
+ */
+template <typename IDType, typename Index /* = std::size_t */>
+class geo::CompactGeoIDmapper {
+
+public:
+  using ID_t = IDType;      ///< Type used as ID for this mapping.
+  using index_type = Index; ///< Type of flat index.
+
+  /// Default constructor: no elements at all.
+  CompactGeoIDmapper() = default;
+
+  /**
+   * @brief Prepares the mapping with the same sizes for all elements.
+   * @param dims number of elements on all levels of the mapping
+   * @see `resize()`
+   */
+  CompactGeoIDmapper(std::initializer_list<unsigned int> dims) { resize(dims); }
+
+  /**
+   * @brief Prepares the mapping for exactly the specified elements.
+   * @tparam IDs type of collection of IDs
+   * @param ids all the existing IDs (`ID_t` or deeper)
+   *
+   * The number of sub-elements of each element is learnt as the largest one
+   * in `ids`, plus one: all the elements before it are also mapped.
+   */
+  template <typename IDs, typename = decltype(std::begin(std::declval<IDs const&>()))>
+  explicit CompactGeoIDmapper(IDs const& ids)
+  {
+    fillLevels<0U>(ids);
+  }
+
+  // --- BEGIN Indexer status query --------------------------------------------
+  /// @name Indexer status query
+  /// @{
+
+  /// Returns the number of elements in the mapping.
+  index_type size() const { return computeSize(); }
+
+  /// Returns whether the mapping has no elements.
+  bool empty() const { return size() == index_type{0}; }
+
+  /// Largest number of elements of the `Level` dimension of this mapping.
+  template <std::size_t Level>
+  unsigned int dimSize() const;
+
+  /// Dimensions of the ID of this mapping.
+  static constexpr unsigned int dimensions() { return IDType::Level + 1; }
+
+  /// Returns whether this mapping hosts data for the specified ID.
+  template <typename GeoID = ID_t>
+  bool hasElement(GeoID const& id) const
+  {
+    return hasElementLevel<GeoID::Level>(id);
+  }
+
+  /// Returns the ID of the first element with `GeoID` type.
+  template <typename GeoID = ID_t>
+  GeoID firstID() const;
+
+  /// Returns the ID of the last covered element with `GeoID` type.
+  template <typename GeoID = ID_t>
+  GeoID lastID() const;
+
+  /// @}
+  // --- END Indexer status query ----------------------------------------------
+
+  // --- BEGIN Mapping transformations -----------------------------------------
+  /// @name Mapping transformations
+  /// @{
+
+  /// Returns the linear index corresponding to the specified ID.
+  index_type index(ID_t const& id) const { return indexLevel<ID_t::Level>(id); }
+
+  /// Returns the ID corresponding to the specified linear `index`.
+  ID_t ID(index_type const index) const;
+
+  /// Returns the linear index corresponding to the specified ID.
+  index_type operator()(ID_t const& id) const { return index(id); }
+
+  /// Returns the ID corresponding to the specified linear `index`.
+  ID_t operator()(index_type const index) const { return ID(index); }
+
+  /// @}
+  // --- END Mapping transformations -------------------------------------------
+
+  // --- BEGIN Mapping modification --------------------------------------------
+  /// @name Mapping modification
+  /// @{
+
+  /**
+   * @brief Resizes the mapping to the same sizes for all elements.
+   * @param dims number of elements on all levels of the mapping
+   *
+   * The size of each dimension is specified by the corresponding number,
+   * starting from the size of the outer dimension (cryostat).
+   */
+  void resize(std::initializer_list<unsigned int> dims);
+
+  /**
+   * @brief Copies the layout of another compact mapping.
+   * @param other ID mapping to take the layout from
+   *
+   * The layout of each level is taken by the matching one in `other`.
+   */
+  template <typename OIDType, typename OIndex>
+  void resizeAs(geo::CompactGeoIDmapper<OIDType, OIndex> const& other);
+
+  /// Removes all the elements.
+  void clear();
+
+  /// @}
+  // --- END Mapping modification ----------------------------------------------
+
+private:
+  template <typename OIDType, typename OIndex>
+  friend class geo::CompactGeoIDmapper;
+
+  /// Type of the list of the first sub-element of each element of a level.
+  using Offsets_t = std::vector<index_type>;
+
+  /// For each level, index of the first sub-element of each parent element,
+  /// plus the total number of elements at that level at the end.
+  std::array<Offsets_t, dimensions()> fFirst;
+
+  /// Returns the index of `id` among all the elements at `Level`.
+  template <std::size_t Level, typename GeoID>
+  index_type indexLevel(GeoID const& id) const;
+
+  /// Fills the `Level` index of `id` from the `index` among its level.
+  template <std::size_t Level, typename GeoID>
+  void fillID(GeoID& id, index_type index) const;
+
+  /// Returns whether all levels of `id` up to `Level` are within range.
+  template <std::size_t Level, typename GeoID>
+  bool hasElementLevel(GeoID const& id) const;
+
+  /// Learns the layout of `Level` and the following ones from `ids`.
+  template <std::size_t Level, typename IDs>
+  void fillLevels(IDs const& ids);
+
+  /// Returns the number of elements at `Level`.
+  index_type levelSize(std::size_t level) const
+  {
+    return fFirst[level].empty() ? index_type{0} : fFirst[level].back();
+  }
+
+  /// Computes the expected size of this mapping.
+  index_type computeSize() const { return levelSize(dimensions() - 1U); }
+
+}; // class geo::CompactGeoIDmapper<>
+
 /// @}
 // --- END Geometry ID mappers -------------------------------------------------
 //------------------------------------------------------------------------------
@@ -598,6 +790,157 @@ auto geo::GeoIDmapper<IDType, Index>::sizeLevel(Dims const& dimSizes) -> index_t
     return sizeLevel<(Level + 1U)>(dimSizes) * dimSizes[Level];
 } // geo::GeoIDmapper<>::sizeLevel()
 
+//------------------------------------------------------------------------------
+//--- geo::CompactGeoIDmapper
+//------------------------------------------------------------------------------
+template <typename IDType, typename Index>
+template <std::size_t Level>
+unsigned int geo::CompactGeoIDmapper<IDType, Index>::dimSize() const
+{
+  if constexpr (Level >= dimensions())
+    return 0U;
+  else {
+    Offsets_t const& first = fFirst[Level];
+    index_type maxSize{0};
+    for (std::size_t i = 1U; i < first.size(); ++i)
+      maxSize = std::max(maxSize, first[i] - first[i - 1U]);
+    return static_cast<unsigned int>(maxSize);
+  }
+} // geo::CompactGeoIDmapper<>::dimSize()
+
+//------------------------------------------------------------------------------
+template <typename IDType, typename Index>
+template <typename GeoID /* = ID_t */>
+GeoID geo::CompactGeoIDmapper<IDType, Index>::firstID() const
+{
+  GeoID id;
+  fillID<GeoID::Level>(id, index_type{0});
+  return id;
+} // geo::CompactGeoIDmapper<>::firstID()
+
+//------------------------------------------------------------------------------
+template <typename IDType, typename Index>
+template <typename GeoID /* = ID_t */>
+GeoID geo::CompactGeoIDmapper<IDType, Index>::lastID() const
+{
+  GeoID id;
+  fillID<GeoID::Level>(id, levelSize(GeoID::Level) - 1U);
+  return id;
+} // geo::CompactGeoIDmapper<>::lastID()
+
+//------------------------------------------------------------------------------
+template <typename IDType, typename Index>
+auto geo::CompactGeoIDmapper<IDType, Index>::ID(index_type const index) const -> ID_t
+{
+  ID_t ID;
+  fillID<ID_t::Level>(ID, index);
+  return ID;
+} // geo::CompactGeoIDmapper<>::ID()
+
+//------------------------------------------------------------------------------
+template <typename IDType, typename Index>
+void geo::CompactGeoIDmapper<IDType, Index>::resize(std::initializer_list<unsigned int> dims)
+{
+  assert(dims.size() == dimensions());
+  index_type nParents{1};
+  auto iDim = dims.begin();
+  for (Offsets_t& first : fFirst) {
+    index_type const n = *(iDim++);
+    first.resize(nParents + 1U);
+    for (index_type i{0}; i <= nParents; ++i)
+      first[i] = i * n;
+    nParents *= n;
+  }
+} // geo::CompactGeoIDmapper<>::resize()
+
+//------------------------------------------------------------------------------
+template <typename IDType, typename Index>
+template <typename OIDType, typename OIndex>
+void geo::CompactGeoIDmapper<IDType, Index>::resizeAs(
+  geo::CompactGeoIDmapper<OIDType, OIndex> const& other)
+{
+  static_assert(geo::CompactGeoIDmapper<OIDType, OIndex>::dimensions() >= dimensions(),
+                "Can't resize a deeper mapping to a shallower one.");
+  for (std::size_t level = 0; level < dimensions(); ++level)
+    fFirst[level].assign(other.fFirst[level].begin(), other.fFirst[level].end());
+} // geo::CompactGeoIDmapper<>::resizeAs()
+
+//------------------------------------------------------------------------------
+template <typename IDType, typename Index>
+void geo::CompactGeoIDmapper<IDType, Index>::clear()
+{
+  for (Offsets_t& first : fFirst)
+    first.clear();
+} // geo::CompactGeoIDmapper<>::clear()
+
+//------------------------------------------------------------------------------
+template <typename IDType, typename Index>
+template <std::size_t Level, typename GeoID>
+auto geo::CompactGeoIDmapper<IDType, Index>::indexLevel(GeoID const& id) const -> index_type
+{
+  if constexpr (Level == 0U)
+    return fFirst[0U][0U] + id.template getIndex<0U>();
+  else
+    return fFirst[Level][indexLevel<(Level - 1U)>(id)] + id.template getIndex<Level>();
+} // geo::CompactGeoIDmapper<>::indexLevel()
+
+//------------------------------------------------------------------------------
+template <typename IDType, typename Index>
+template <std::size_t Level, typename GeoID>
+void geo::CompactGeoIDmapper<IDType, Index>::fillID(GeoID& id, index_type index) const
+{
+  Offsets_t const& first = fFirst[Level];
+  if (index >= levelSize(Level)) { // out of range: invalid ID
+    id.template writeIndex<Level>() = index;
+    id.setValidity(false);
+    return;
+  }
+  // the last parent whose first sub-element is not after `index`;
+  // parents with no sub-elements are skipped
+  auto const itNext = std::upper_bound(first.begin(), first.end(), index);
+  auto const iParent = static_cast<index_type>(std::distance(first.begin(), itNext) - 1);
+  id.template writeIndex<Level>() = index - first[iParent];
+  if constexpr (Level == 0U)
+    id.setValidity(true);
+  else
+    fillID<(Level - 1U)>(id, iParent);
+} // geo::CompactGeoIDmapper<>::fillID()
+
+//------------------------------------------------------------------------------
+template <typename IDType, typename Index>
+template <std::size_t Level, typename GeoID>
+bool geo::CompactGeoIDmapper<IDType, Index>::hasElementLevel(GeoID const& id) const
+{
+  index_type parent{0};
+  if constexpr (Level > 0U) {
+    if (!hasElementLevel<(Level - 1U)>(id)) return false;
+    parent = indexLevel<(Level - 1U)>(id);
+  }
+  Offsets_t const& first = fFirst[Level];
+  if (first.empty()) return false;
+  auto const i = static_cast<index_type>(id.template getIndex<Level>());
+  return i < first[parent + 1U] - first[parent];
+} // geo::CompactGeoIDmapper<>::hasElementLevel()
+
+//------------------------------------------------------------------------------
+template <typename IDType, typename Index>
+template <std::size_t Level, typename IDs>
+void geo::CompactGeoIDmapper<IDType, Index>::fillLevels(IDs const& ids)
+{
+  // count the sub-elements of each element in the level above
+  Offsets_t& first = fFirst[Level];
+  first.assign(((Level == 0U) ? index_type{1} : levelSize(Level - 1U)) + 1U, index_type{0});
+  for (auto const& id : ids) {
+    index_type parent{0};
+    if constexpr (Level > 0U) parent = indexLevel<(Level - 1U)>(id);
+    index_type const n = static_cast<index_type>(id.template getIndex<Level>()) + 1U;
+    first[parent + 1U] = std::max(first[parent + 1U], n);
+  }
+  std::partial_sum(first.begin(), first.end(), first.begin());
+
+  if constexpr (Level + 1U < dimensions()) fillLevels<(Level + 1U)>(ids);
+} // geo::CompactGeoIDmapper<>::fillLevels()
+
 //------------------------------------------------------------------------------
 
 #endif // LARCOREALG_GEOMETRY_GEOMETRYIDMAPPER_H
@@ -0,0 +1,198 @@
+/**
+ * @file   larcorealg/Geometry/GeometrySnapshot.cxx
+ * @brief  Binary record of how the geometry objects were built from ROOT.
+ * @see    larcorealg/Geometry/GeometrySnapshot.h
+ */
+
+// class header
+#include "larcorealg/Geometry/GeometrySnapshot.h"
+
+// framework libraries
+#include "cetlib_except/exception.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <cstdio> // std::rename(), std::remove()
+#include <fstream>
+#include <random>
+#include <type_traits> // std::is_trivially_copyable_v
+
+namespace {
+
+  /// Reads `n` objects of type `T` from `in` into `data`; returns success.
+  template <typename T>
+  bool readArray(std::istream& in, T* data, std::size_t n)
+  {
+    static_assert(std::is_trivially_copyable_v<T>);
+    in.read(reinterpret_cast<char*>(data), n * sizeof(T));
+    return static_cast<bool>(in);
+  }
+
+  /// Writes `n` objects of type `T` from `data` into `out`.
+  template <typename T>
+  void writeArray(std::ostream& out, T const* data, std::size_t n)
+  {
+    static_assert(std::is_trivially_copyable_v<T>);
+    out.write(reinterpret_cast<char const*>(data), n * sizeof(T));
+  }
+
+  // the file layout is the memory layout of these structures
+  static_assert(sizeof(geo::GeometrySnapshot::Header_t) == 48U);
+  static_assert(sizeof(geo::GeometrySnapshot::Record_t) == 120U);
+
+} // local namespace
+
+namespace geo {
+
+  //----------------------------------------------------------------------------
+  std::size_t GeometrySnapshot::addRecord(ObjectType type,
+                                          std::uint32_t parent,
+                                          std::vector<PathIndex_t> const& path,
+                                          std::string_view nodeName,
+                                          std::array<double, 12U> const& matrix)
+  {
+    Record_t record{};
+    record.type = type;
+    record.parent = parent;
+    record.firstPathIndex = fPathIndices.size();
+    record.nPathIndices = static_cast<std::uint32_t>(path.size());
+    record.nameHash = static_cast<std::uint32_t>(hash(nodeName));
+    record.matrix = matrix;
+
+    fPathIndices.insert(fPathIndices.end(), path.begin(), path.end());
+    fRecords.push_back(record);
+    return fRecords.size() - 1;
+  } // GeometrySnapshot::addRecord()
+
+  //----------------------------------------------------------------------------
+  void GeometrySnapshot::write(std::string const& fileName) const
+  {
+    Header_t header{};
+    header.magic = Magic;
+    header.version = FormatVersion;
+    header.byteOrder = ByteOrderMark;
+    header.key = fKey;
+    header.checksum = checksum();
+    header.nRecords = fRecords.size();
+    header.nPathIndices = fPathIndices.size();
+
+    // several jobs may be writing the same snapshot at the same time:
+    // each one writes its own temporary file
+    std::string const tempName = fileName + ".tmp" + std::to_string(std::random_device{}());
+    {
+      std::ofstream out{tempName, std::ios::binary | std::ios::trunc};
+      writeArray(out, &header, 1U);
+      writeArray(out, fRecords.data(), fRecords.size());
+      writeArray(out, fPathIndices.data(), fPathIndices.size());
+      out.close();
+      if (!out) {
+        std::remove(tempName.c_str());
+        throw cet::exception("GeometrySnapshot")
+          << "Failed to write the geometry snapshot into '" << tempName << "'\n";
+      }
+    }
+    if (std::rename(tempName.c_str(), fileName.c_str()) != 0) {
+      std::remove(tempName.c_str());
+      throw cet::exception("GeometrySnapshot")
+        << "Failed to move the geometry snapshot into '" << fileName << "'\n";
+    }
+
+    mf::LogInfo("GeometrySnapshot") << "Geometry snapshot with " << fRecords.size()
+                                    << " objects written into '" << fileName << "'";
+  } // GeometrySnapshot::write()
+
+  //----------------------------------------------------------------------------
+  std::optional<GeometrySnapshot> GeometrySnapshot::read(std::string const& fileName, Hash_t key)
+  {
+    std::ifstream in{fileName, std::ios::binary};
+    if (!in) {
+      mf::LogInfo("GeometrySnapshot") << "No geometry snapshot found in '" << fileName << "'";
+      return std::nullopt;
+    }
+
+    auto const reject = [&fileName](char const* reason) {
+      mf::LogInfo("GeometrySnapshot")
+        << "Geometry snapshot in '" << fileName << "' not used: " << reason;
+      return std::nullopt;
+    };
+
+    Header_t header;
+    if (!readArray(in, &header, 1U)) return reject("file too short");
+    if (header.magic != Magic) return reject("not a geometry snapshot");
+    if (header.byteOrder != ByteOrderMark) return reject("different byte order");
+    if (header.version != FormatVersion) return reject("different format version");
+    if (header.key != key) return reject("written for different geometry or configuration");
+
+    // check the size before allocating anything
+    in.seekg(0, std::ios::end);
+    auto const fileSize = static_cast<std::uint64_t>(in.tellg());
+    in.seekg(sizeof(Header_t), std::ios::beg);
+    std::uint64_t const payloadSize = fileSize - sizeof(Header_t);
+    if ((header.nRecords > payloadSize / sizeof(Record_t)) ||
+        (header.nPathIndices > payloadSize / sizeof(PathIndex_t)) ||
+        (header.nRecords * sizeof(Record_t) + header.nPathIndices * sizeof(PathIndex_t) !=
+         payloadSize)) {
+      return reject("wrong file size");
+    }
+
+    GeometrySnapshot snapshot{key};
+    snapshot.fRecords.resize(header.nRecords);
+    snapshot.fPathIndices.resize(header.nPathIndices);
+    if (!readArray(in, snapshot.fRecords.data(), snapshot.fRecords.size()) ||
+        !readArray(in, snapshot.fPathIndices.data(), snapshot.fPathIndices.size())) {
+      return reject("read error");
+    }
+    if (snapshot.checksum() != header.checksum) return reject("wrong checksum");
+
+    for (Record_t const& record : snapshot.fRecords) {
+      if ((record.firstPathIndex + record.nPathIndices > snapshot.fPathIndices.size()) ||
+          ((record.parent != NoParent) && (record.parent >= snapshot.fRecords.size()))) {
+        return reject("inconsistent content");
+      }
+    }
+
+    return snapshot;
+  } // GeometrySnapshot::read()
+
+  //----------------------------------------------------------------------------
+  auto GeometrySnapshot::hash(void const* data, std::size_t size, Hash_t seed) -> Hash_t
+  {
+    // 64-bit FNV-1a
+    constexpr Hash_t Prime = 0x100000001b3ULL;
+    auto const* bytes = static_cast<unsigned char const*>(data);
+    Hash_t h = seed;
+    for (std::size_t i = 0; i < size; ++i) {
+      h ^= bytes[i];
+      h *= Prime;
+    }
+    return h;
+  } // GeometrySnapshot::hash()
+
+  //----------------------------------------------------------------------------
+  auto GeometrySnapshot::hashFile(std::string const& fileName, Hash_t seed) -> Hash_t
+  {
+    std::ifstream in{fileName, std::ios::binary};
+    if (!in) {
+      throw cet::exception("GeometrySnapshot")
+        << "Can't read '" << fileName << "' to compute its hash\n";
+    }
+
+    Hash_t h = seed;
+    std::vector<char> buffer(1U << 20U);
+    while (in) {
+      in.read(buffer.data(), buffer.size());
+      h = hash(buffer.data(), static_cast<std::size_t>(in.gcount()), h);
+    }
+    return h;
+  } // GeometrySnapshot::hashFile()
+
+  //----------------------------------------------------------------------------
+  auto GeometrySnapshot::checksum() const -> Hash_t
+  {
+    Hash_t const h = hash(fRecords.data(), fRecords.size() * sizeof(Record_t));
+    return hash(fPathIndices.data(), fPathIndices.size() * sizeof(PathIndex_t), h);
+  } // GeometrySnapshot::checksum()
+
+  //----------------------------------------------------------------------------
+
+} // namespace geo
@@ -0,0 +1,216 @@
+/**
+ * @file   larcorealg/Geometry/GeometrySnapshot.h
+ * @brief  Binary record of how the geometry objects were built from ROOT.
+ * @see    larcorealg/Geometry/GeometrySnapshot.cxx,
+ *         larcorealg/Geometry/GeometryBuilderSnapshot.h
+ * @ingroup Geometry
+ */
+
+#ifndef LARCOREALG_GEOMETRY_GEOMETRYSNAPSHOT_H
+#define LARCOREALG_GEOMETRY_GEOMETRYSNAPSHOT_H
+
+// C/C++ standard libraries
+#include <array>
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t, std::uint64_t
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace geo {
+
+  /**
+   * @brief Record of the geometry objects built out of a ROOT geometry.
+   * @ingroup Geometry
+   * @see `geo::GeometryBuilderSnapshot`, `geo::GeometrySnapshotRecorder`
+   *
+   * A snapshot lists all the geometry objects (cryostats, TPCs, wire planes,
+   * wires, optical detectors, auxiliary detectors and their sensitive volumes)
+   * in the order they were built, each with:
+   *  * the object which contains it (e.g. the wire plane of a wire);
+   *  * the position of its ROOT geometry node, as the sequence of the indices
+   *    of the daughter nodes to follow starting from the node of its container
+   *    (or from the top node of the geometry);
+   *  * a hash of the name of that node, used as consistency check;
+   *  * its complete local-to-world transformation.
+   *
+   * This information is enough to reconstruct all the geometry objects from
+   * the ROOT geometry without searching its node tree and without composing
+   * the transformations of the nodes (see `geo::GeometryBuilderSnapshot`).
+   * All derived quantities (wire ends, plane frames, TPC boxes...) are then
+   * computed by the geometry object constructors exactly as in the original
+   * build, and the IDs are assigned by the sorting as usual.
+   *
+   * What a snapshot saves is only the search of the ROOT node tree for the
+   * geometry objects and the composition of the node transformations.
+   * Everything else still happens when loading the geometry from a snapshot:
+   * the ROOT geometry is imported from its file (the geometry objects keep
+   * pointers to its nodes and volumes), the geometry objects are constructed,
+   * then sorted, and the channel mapping is initialized.
+   *
+   * The snapshot is associated with a `key()`, which is expected to be a hash
+   * of everything that determines the result of the build: typically, the
+   * content of the geometry files and the configuration of the builder
+   * (see `hashFile()` and `hash()`).
+   *
+   *
+   * File format
+   * ------------
+   *
+   * The snapshot can be written into a binary file and read back.
+   * The file is a flat, fixed-layout image of the data, read back with plain
+   * stream reads: a `Header_t`, followed by `Header_t::nRecords` records
+   * (`Record_t`) and then by `Header_t::nPathIndices` path indices
+   * (`PathIndex_t`). The data is written in the native byte order, which is
+   * verified on reading.
+   * The header contains the version of the format (`FormatVersion`), the key
+   * of the snapshot and a checksum of the rest of the file.
+   * A file with a different version, byte order or key, or with a wrong
+   * checksum, is not loaded.
+   */
+  class GeometrySnapshot {
+  public:
+    /// Version of the file format; increase it at every change of layout.
+    static constexpr std::uint32_t FormatVersion = 1U;
+
+    /// Type of a hash value.
+    using Hash_t = std::uint64_t;
+
+    /// Type of the index of a daughter node.
+    using PathIndex_t = std::uint32_t;
+
+    /// Type of object in a record.
+    enum class ObjectType : std::uint32_t {
+      Cryostat,
+      TPC,
+      Plane,
+      Wire,
+      OpDet,
+      AuxDet,
+      AuxDetSensitive
+    }; // ObjectType
+
+    /// Value of `Record_t::parent` for objects with no container.
+    static constexpr std::uint32_t NoParent = std::numeric_limits<std::uint32_t>::max();
+
+    /// Information about a single geometry object.
+    struct Record_t {
+      ObjectType type;                ///< Type of the object.
+      std::uint32_t parent;           ///< Index of the record of the container.
+      std::uint64_t firstPathIndex;   ///< First of the node path indices.
+      std::uint32_t nPathIndices;     ///< Number of the node path indices.
+      std::uint32_t nameHash;         ///< Hash of the name of the node.
+      std::array<double, 12U> matrix; ///< Components of the transformation.
+    }; // Record_t
+
+    /// Header of the snapshot file.
+    struct Header_t {
+      std::array<char, 8U> magic; ///< File signature (`Magic`).
+      std::uint32_t version;      ///< Format version (`FormatVersion`).
+      std::uint32_t byteOrder;    ///< Byte order mark (`ByteOrderMark`).
+      Hash_t key;                 ///< Key of the snapshot.
+      Hash_t checksum;            ///< Hash of the records and path indices.
+      std::uint64_t nRecords;     ///< Number of records.
+      std::uint64_t nPathIndices; ///< Number of path indices.
+    }; // Header_t
+
+    /// Constructor: an empty snapshot with the specified key.
+    explicit GeometrySnapshot(Hash_t key = 0) : fKey(key) {}
+
+    /// Returns the key of this snapshot.
+    Hash_t key() const { return fKey; }
+
+    /// Returns whether the snapshot contains no object.
+    bool empty() const { return fRecords.empty(); }
+
+    /// Returns the number of objects in the snapshot.
+    std::size_t size() const { return fRecords.size(); }
+
+    /// Returns all the records, in the order they were added.
+    std::vector<Record_t> const& records() const { return fRecords; }
+
+    /// Returns the record with the specified index.
+    Record_t const& record(std::size_t index) const { return fRecords[index]; }
+
+    /// Returns a pointer to the node path indices of the specified record.
+    PathIndex_t const* pathIndices(Record_t const& record) const
+    {
+      return fPathIndices.data() + record.firstPathIndex;
+    }
+
+    /**
+     * @brief Adds a record for a new object.
+     * @param type the type of the object
+     * @param parent index of the record of the container of the object
+     * @param path indices of the daughters from the container node to the node
+     * @param nodeName name of the ROOT geometry node of the object
+     * @param matrix the 12 components of the local-to-world transformation
+     * @return the index of the new record
+     */
+    std::size_t addRecord(ObjectType type,
+                          std::uint32_t parent,
+                          std::vector<PathIndex_t> const& path,
+                          std::string_view nodeName,
+                          std::array<double, 12U> const& matrix);
+
+    /**
+     * @brief Writes the snapshot into the specified file.
+     * @param fileName path of the file to be written
+     * @throw cet::exception (category: `"GeometrySnapshot"`) on I/O errors
+     *
+     * The file is first written under a temporary name, then renamed, so that
+     * readers never see a partially written file.
+     */
+    void write(std::string const& fileName) const;
+
+    /**
+     * @brief Reads a snapshot from a file.
+     * @param fileName path of the file to be read
+     * @param key the key the snapshot is required to have
+     * @return the snapshot, or no value if the file can't be used
+     *
+     * The snapshot is not returned if the file does not exist, or if it has an
+     * unsupported format, a different key or a wrong checksum; the reason is
+     * reported in the log.
+     */
+    static std::optional<GeometrySnapshot> read(std::string const& fileName, Hash_t key);
+
+    /// Signature at the start of each snapshot file.
+    static constexpr std::array<char, 8U> Magic = {'L', 'A', 'r', 'G', 'e', 'o', 'S', 'n'};
+
+    /// Byte order mark, written in the native byte order.
+    static constexpr std::uint32_t ByteOrderMark = 0x01020304U;
+
+    /// Initial value of the hash functions.
+    static constexpr Hash_t HashSeed = 0xcbf29ce484222325ULL;
+
+    /// Returns the hash of `size` bytes from `data`, continuing from `seed`.
+    static Hash_t hash(void const* data, std::size_t size, Hash_t seed = HashSeed);
+
+    /// Returns the hash of `s`, continuing from `seed`.
+    static Hash_t hash(std::string_view s, Hash_t seed = HashSeed)
+    {
+      return hash(s.data(), s.size(), seed);
+    }
+
+    /**
+     * @brief Returns the hash of the content of a file, continuing from `seed`.
+     * @throw cet::exception (category: `"GeometrySnapshot"`) if not readable
+     */
+    static Hash_t hashFile(std::string const& fileName, Hash_t seed = HashSeed);
+
+  private:
+    Hash_t fKey;                           ///< Key of this snapshot.
+    std::vector<Record_t> fRecords;        ///< All the objects.
+    std::vector<PathIndex_t> fPathIndices; ///< Node paths of all the objects.
+
+    /// Returns the checksum of records and path indices.
+    Hash_t checksum() const;
+
+  }; // class GeometrySnapshot
+
+} // namespace geo
+
+#endif // LARCOREALG_GEOMETRY_GEOMETRYSNAPSHOT_H
@@ -0,0 +1,166 @@
+/**
+ * @file   larcorealg/Geometry/OpDetPositionIndex.cxx
+ * @brief  Spatial index to find the optical detectors closest to a point.
+ * @see    larcorealg/Geometry/OpDetPositionIndex.h
+ */
+
+// class header
+#include "larcorealg/Geometry/OpDetPositionIndex.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::nth_element(), std::push_heap(), std::sort_heap() ...
+
+namespace geo {
+
+  //----------------------------------------------------------------------------
+  OpDetPositionIndex::OpDetPositionIndex(std::vector<Point_t> const& centers)
+  {
+    fNodes.reserve(centers.size());
+    for (std::size_t i = 0; i < centers.size(); ++i) {
+      Point_t const& center = centers[i];
+      fNodes.push_back({{center.X(), center.Y(), center.Z()}, static_cast<unsigned int>(i), 0U});
+    }
+    build(0, fNodes.size());
+  } // OpDetPositionIndex::OpDetPositionIndex()
+
+  //----------------------------------------------------------------------------
+  unsigned int OpDetPositionIndex::nearest(Point_t const& point) const
+  {
+    Candidate_t best{std::numeric_limits<double>::max(), NoOpDet};
+    searchNearest(0, fNodes.size(), {point.X(), point.Y(), point.Z()}, best);
+    return best.second;
+  } // OpDetPositionIndex::nearest()
+
+  //----------------------------------------------------------------------------
+  std::vector<unsigned int> OpDetPositionIndex::nearest(Point_t const& point, std::size_t k) const
+  {
+    std::vector<Candidate_t> best; // max-heap: the farthest candidate on top
+    if (k > 0) {
+      best.reserve(std::min(k, fNodes.size()) + 1);
+      searchNearest(0, fNodes.size(), {point.X(), point.Y(), point.Z()}, k, best);
+    }
+    std::sort_heap(best.begin(), best.end());
+
+    std::vector<unsigned int> opDets;
+    opDets.reserve(best.size());
+    for (Candidate_t const& candidate : best)
+      opDets.push_back(candidate.second);
+    return opDets;
+  } // OpDetPositionIndex::nearest(k)
+
+  //----------------------------------------------------------------------------
+  void OpDetPositionIndex::nearest(std::size_t nPoints,
+                                   Point_t const* points,
+                                   unsigned int* opDets) const
+  {
+    for (std::size_t i = 0; i < nPoints; ++i)
+      opDets[i] = nearest(points[i]);
+  } // OpDetPositionIndex::nearest(batch)
+
+  //----------------------------------------------------------------------------
+  void OpDetPositionIndex::build(std::size_t begin, std::size_t end)
+  {
+    if (end - begin < 2) return;
+
+    // split on the axis with the largest spread
+    std::array<double, 3U> min = fNodes[begin].center, max = min;
+    for (std::size_t i = begin + 1; i < end; ++i) {
+      for (std::size_t axis = 0; axis < 3; ++axis) {
+        min[axis] = std::min(min[axis], fNodes[i].center[axis]);
+        max[axis] = std::max(max[axis], fNodes[i].center[axis]);
+      }
+    }
+    unsigned int axis = 0;
+    for (unsigned int a = 1; a < 3; ++a)
+      if (max[a] - min[a] > max[axis] - min[axis]) axis = a;
+
+    std::size_t const middle = begin + (end - begin) / 2;
+    std::nth_element(fNodes.begin() + begin,
+                     fNodes.begin() + middle,
+                     fNodes.begin() + end,
+                     [axis](Node_t const& a, Node_t const& b) {
+                       return a.center[axis] < b.center[axis];
+                     });
+    fNodes[middle].axis = axis;
+
+    build(begin, middle);
+    build(middle + 1, end);
+  } // OpDetPositionIndex::build()
+
+  //----------------------------------------------------------------------------
+  void OpDetPositionIndex::searchNearest(std::size_t begin,
+                                         std::size_t end,
+                                         std::array<double, 3U> const& point,
+                                         Candidate_t& best) const
+  {
+    if (begin >= end) return;
+
+    std::size_t const middle = begin + (end - begin) / 2;
+    Node_t const& node = fNodes[middle];
+    Candidate_t const candidate{distance2(node, point), node.opDet};
+    if (candidate < best) best = candidate;
+    if (end - begin == 1) return;
+
+    // the side of the point first; then the other one, unless it is too far
+    // (a detector at the same distance may still win by a lower index)
+    double const offset = point[node.axis] - node.center[node.axis];
+    bool const left = offset < 0.0;
+    if (left)
+      searchNearest(begin, middle, point, best);
+    else
+      searchNearest(middle + 1, end, point, best);
+    if (offset * offset > best.first) return;
+    if (left)
+      searchNearest(middle + 1, end, point, best);
+    else
+      searchNearest(begin, middle, point, best);
+  } // OpDetPositionIndex::searchNearest()
+
+  //----------------------------------------------------------------------------
+  void OpDetPositionIndex::searchNearest(std::size_t begin,
+                                         std::size_t end,
+                                         std::array<double, 3U> const& point,
+                                         std::size_t k,
+                                         std::vector<Candidate_t>& best) const
+  {
+    if (begin >= end) return;
+
+    std::size_t const middle = begin + (end - begin) / 2;
+    Node_t const& node = fNodes[middle];
+    Candidate_t const candidate{distance2(node, point), node.opDet};
+    if (best.size() < k) {
+      best.push_back(candidate);
+      std::push_heap(best.begin(), best.end());
+    }
+    else if (candidate < best.front()) {
+      std::pop_heap(best.begin(), best.end());
+      best.back() = candidate;
+      std::push_heap(best.begin(), best.end());
+    }
+    if (end - begin == 1) return;
+
+    double const offset = point[node.axis] - node.center[node.axis];
+    bool const left = offset < 0.0;
+    if (left)
+      searchNearest(begin, middle, point, k, best);
+    else
+      searchNearest(middle + 1, end, point, k, best);
+    if ((best.size() == k) && (offset * offset > best.front().first)) return;
+    if (left)
+      searchNearest(middle + 1, end, point, k, best);
+    else
+      searchNearest(begin, middle, point, k, best);
+  } // OpDetPositionIndex::searchNearest(k)
+
+  //----------------------------------------------------------------------------
+  double OpDetPositionIndex::distance2(Node_t const& node, std::array<double, 3U> const& point)
+  {
+    double const dx = point[0] - node.center[0];
+    double const dy = point[1] - node.center[1];
+    double const dz = point[2] - node.center[2];
+    return dx * dx + dy * dy + dz * dz;
+  } // OpDetPositionIndex::distance2()
+
+  //----------------------------------------------------------------------------
+
+} // namespace geo
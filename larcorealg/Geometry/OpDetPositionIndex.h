@@ -0,0 +1,119 @@
+/**
+ * @file   larcorealg/Geometry/OpDetPositionIndex.h
+ * @brief  Spatial index to find the optical detectors closest to a point.
+ * @see    larcorealg/Geometry/OpDetPositionIndex.cxx
+ * @ingroup Geometry
+ */
+
+#ifndef LARCOREALG_GEOMETRY_OPDETPOSITIONINDEX_H
+#define LARCOREALG_GEOMETRY_OPDETPOSITIONINDEX_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h" // geo::Point_t
+
+// C/C++ standard libraries
+#include <array>
+#include <cstddef> // std::size_t
+#include <limits>
+#include <utility> // std::pair
+#include <vector>
+
+namespace geo {
+
+  /**
+   * @brief k-d tree of the centers of optical detectors.
+   * @ingroup Geometry
+   *
+   * The index is built from the list of the centers of the optical detectors,
+   * and it answers queries about the detectors closest to a point, identified
+   * by their position in that list.
+   * Distances are compared by their square, and detectors at the same distance
+   * are sorted by their position in the list: the result of `nearest()` is the
+   * same as the one of a linear scan of the list picking the first detector
+   * with the smallest distance (like `geo::CryostatGeo::GetClosestOpDet()`).
+   *
+   * The tree is balanced, and it is stored in a single array, where each
+   * subtree occupies a contiguous range with its root in the middle.
+   */
+  class OpDetPositionIndex {
+  public:
+    /// Value returned when no detector is found.
+    static constexpr unsigned int NoOpDet = std::numeric_limits<unsigned int>::max();
+
+    /// Constructor: an empty index, which does not find anything.
+    OpDetPositionIndex() = default;
+
+    /**
+     * @brief Constructor: indexes the specified detector centers.
+     * @param centers the center of each of the optical detectors [cm]
+     */
+    explicit OpDetPositionIndex(std::vector<Point_t> const& centers);
+
+    /// Returns whether the index contains no detector at all.
+    bool empty() const { return fNodes.empty(); }
+
+    /// Returns the number of detectors in the index.
+    std::size_t size() const { return fNodes.size(); }
+
+    /**
+     * @brief Returns the detector closest to the specified point.
+     * @param point the location [cm]
+     * @return the index of the closest detector, `NoOpDet` if index is empty
+     */
+    unsigned int nearest(Point_t const& point) const;
+
+    /**
+     * @brief Returns the detectors closest to the specified point.
+     * @param point the location [cm]
+     * @param k the number of detectors to be returned
+     * @return the indices of up to `k` closest detectors, the closest first
+     */
+    std::vector<unsigned int> nearest(Point_t const& point, std::size_t k) const;
+
+    /**
+     * @brief Finds the detector closest to each of the specified points.
+     * @param nPoints number of points
+     * @param points array of `nPoints` locations [cm]
+     * @param[out] opDets array of `nPoints` indices to be filled
+     *
+     * The result for each point is the same as from `nearest(Point_t const&)`.
+     */
+    void nearest(std::size_t nPoints, Point_t const* points, unsigned int* opDets) const;
+
+  private:
+    /// A node of the tree: a detector and how its subtree is split.
+    struct Node_t {
+      std::array<double, 3U> center; ///< Center of the detector [cm].
+      unsigned int opDet;            ///< Index of the detector.
+      unsigned int axis;             ///< Axis the subtree is split on.
+    }; // Node_t
+
+    /// A candidate: squared distance and detector index (sorted in this order).
+    using Candidate_t = std::pair<double, unsigned int>;
+
+    std::vector<Node_t> fNodes; ///< The tree.
+
+    /// Builds the subtree in the range [ `begin`, `end` [ of the nodes.
+    void build(std::size_t begin, std::size_t end);
+
+    /// Updates `best` with the closest detector in the subtree.
+    void searchNearest(std::size_t begin,
+                       std::size_t end,
+                       std::array<double, 3U> const& point,
+                       Candidate_t& best) const;
+
+    /// Updates the heap `best` with the `k` closest detectors in the subtree.
+    void searchNearest(std::size_t begin,
+                       std::size_t end,
+                       std::array<double, 3U> const& point,
+                       std::size_t k,
+                       std::vector<Candidate_t>& best) const;
+
+    /// Returns the squared distance of `point` from the detector in `node`.
+    static double distance2(Node_t const& node, std::array<double, 3U> const& point);
+
+  }; // class OpDetPositionIndex
+
+} // namespace geo
+
+#endif // LARCOREALG_GEOMETRY_OPDETPOSITIONINDEX_H
@@ -11,6 +11,7 @@
 #include "larcorealg/CoreUtils/RealComparisons.h"
 #include "larcorealg/Geometry/Exceptions.h" // geo::InvalidWireError
 #include "larcorealg/Geometry/WireGeo.h"
+#include "larcorealg/Geometry/details/cappedNearestWire.h"
 #include "larcorealg/Geometry/geo_vectors_utils.h"                // geo::vect::convertTo()
 #include "larcoreobj/SimpleTypesAndConstants/PhysicalConstants.h" // util::pi()
 
@@ -32,6 +33,7 @@
 #include <cassert>
 #include <functional>  // std::less<>, std::greater<>, std::transform()
 #include <iterator>    // std::back_inserter()
+#include <mutex>       // std::call_once()
 #include <sstream>     // std::ostringstream
 #include <type_traits> // std::is_same<>, std::decay_t<>
 
@@ -405,6 +407,7 @@ namespace geo {
     , fOrientation(geo::kVertical)
     , fWire(std::move(wires))
     , fWirePitch(0.)
+    , fThetaZ(0.)
     , fSinPhiZ(0.)
     , fCosPhiZ(0.)
     , fDecompWire()
@@ -422,6 +425,7 @@ namespace geo {
 
     DetectGeometryDirections();
     UpdateWirePitchSlow();
+    UpdateThetaZ();
 
   } // PlaneGeo::PlaneGeo()
 
@@ -474,7 +478,40 @@ namespace geo {
   //......................................................................
 
   // sort the WireGeo objects
-  void PlaneGeo::SortWires(geo::GeoObjectSorter const& sorter) { sorter.SortWires(fWire); }
+  void PlaneGeo::SortWires(geo::GeoObjectSorter const& sorter)
+  {
+    RestoreWires();
+    sorter.SortWires(fWire);
+    UpdateThetaZ();
+  } // PlaneGeo::SortWires()
+
+  //......................................................................
+  bool PlaneGeo::ReleaseWires()
+  {
+    if (!fReleasedWires.empty() || (fWire.size() < 2)) return false;
+
+    //
+    // the wires can be released only if they can be rebuilt exactly:
+    // rebuild them once, and compare them with the existing ones
+    //
+    std::vector<TGeoNode const*> nodes;
+    nodes.reserve(fWire.size());
+    for (geo::WireGeo const& wire : fWire)
+      nodes.push_back(wire.Node());
+
+    WireCollection_t const rebuilt = MakeWires(nodes);
+    for (std::size_t iWire = 0; iWire < fWire.size(); ++iWire) {
+      geo::WireGeo const& wire = fWire[iWire];
+      geo::WireGeo const& copy = rebuilt[iWire];
+      if ((copy.GetStart() != wire.GetStart()) || (copy.GetCenter() != wire.GetCenter()) ||
+          (copy.GetEnd() != wire.GetEnd()))
+        return false;
+    } // for
+
+    fReleasedWires = ReleasedWires{std::move(nodes)};
+    fWire = WireCollection_t{}; // this actually frees the memory
+    return true;
+  } // PlaneGeo::ReleaseWires()
 
   //......................................................................
   bool PlaneGeo::WireIDincreasesWithZ() const
@@ -598,6 +635,56 @@ namespace geo {
 
   } // PlaneGeo::NearestWireID()
 
+  //......................................................................
+  geo::WireID PlaneGeo::NearestWireID(geo::Point_t const& pos, bool& outOfRange) const noexcept
+  {
+    return {ID(), details::cappedNearestWire(WireCoordinate(pos), Nwires(), outOfRange)};
+  } // PlaneGeo::NearestWireID(bool&)
+
+  //......................................................................
+  std::size_t PlaneGeo::NearestWireNumbers(std::size_t n,
+                                           double const* x,
+                                           double const* y,
+                                           double const* z,
+                                           geo::WireID::WireID_t* wireNos,
+                                           bool* outOfRange) const
+  {
+    geo::Point_t const ref = fDecompWire.ReferencePoint();
+    geo::Vector_t const& dir = fDecompWire.SecondaryDir();
+    double const rx = ref.X(), ry = ref.Y(), rz = ref.Z();
+    double const dx = dir.X(), dy = dir.Y(), dz = dir.Z();
+    double const pitch = WirePitch();
+    double const nWires = Nwires();
+
+    std::size_t nOutOfRange = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      double const wireCoord = ((x[i] - rx) * dx + (y[i] - ry) * dy + (z[i] - rz) * dz) / pitch;
+      bool bad;
+      wireNos[i] = details::cappedNearestWire(wireCoord, nWires, bad);
+      outOfRange[i] = bad;
+      nOutOfRange += bad;
+    } // for
+    return nOutOfRange;
+  } // PlaneGeo::NearestWireNumbers()
+
+  //......................................................................
+  void PlaneGeo::WireCoordinates(std::size_t n,
+                                 double const* x,
+                                 double const* y,
+                                 double const* z,
+                                 double* wireCoords) const
+  {
+    // same as PlaneCoordinate(point) / WirePitch(), unrolled
+    geo::Point_t const ref = fDecompWire.ReferencePoint();
+    geo::Vector_t const& dir = fDecompWire.SecondaryDir();
+    double const rx = ref.X(), ry = ref.Y(), rz = ref.Z();
+    double const dx = dir.X(), dy = dir.Y(), dz = dir.Z();
+    double const pitch = WirePitch();
+
+    for (std::size_t i = 0; i < n; ++i)
+      wireCoords[i] = ((x[i] - rx) * dx + (y[i] - ry) * dy + (z[i] - rz) * dz) / pitch;
+  } // PlaneGeo::WireCoordinates()
+
   //......................................................................
   geo::WireGeo const& PlaneGeo::NearestWire(geo::Point_t const& point) const
   {
@@ -639,9 +726,6 @@ namespace geo {
 
   } // PlaneGeo::InterWireDistance()
 
-  //......................................................................
-  double PlaneGeo::ThetaZ() const { return FirstWire().ThetaZ(); }
-
   //......................................................................
   void PlaneGeo::UpdateAfterSorting(geo::PlaneID planeid, geo::BoxBoundedGeo const& TPCbox)
   {
@@ -650,6 +734,8 @@ namespace geo {
     // reset our ID
     fID = planeid;
 
+    RestoreWires();
+
     UpdatePlaneNormal(TPCbox);
     UpdateWidthDepthDir();
     UpdateIncreasingWireDir();
@@ -804,10 +890,10 @@ namespace geo {
     //
 
     // sanity check
-    if (fWire.size() < 2) {
+    if (Nwires() < 2) {
       // this likely means construction is not complete yet
       throw cet::exception("NoWireInPlane")
-        << "PlaneGeo::UpdateOrientation(): only " << fWire.size() << " wires!\n";
+        << "PlaneGeo::UpdateOrientation(): only " << Nwires() << " wires!\n";
     } // if
 
     auto normal = GetNormalDirection();
@@ -847,6 +933,12 @@ namespace geo {
     fSinPhiZ = wire_coord_dir.Y();
   } // PlaneGeo::UpdatePhiZ()
 
+  //......................................................................
+  void PlaneGeo::UpdateThetaZ()
+  {
+    if (!fWire.empty()) fThetaZ = fWire.front().ThetaZ();
+  } // PlaneGeo::UpdateThetaZ()
+
   void PlaneGeo::UpdateView()
   {
     /*
@@ -1126,6 +1218,45 @@ namespace geo {
   } // PlaneGeo::shouldFlipWire()
 
   //......................................................................
+  void PlaneGeo::RestoreWires()
+  {
+    if (fReleasedWires.empty()) return;
+    fWire = Wires();
+    fReleasedWires = ReleasedWires{};
+  } // PlaneGeo::RestoreWires()
+
+  //......................................................................
+  geo::TransformationMatrix PlaneGeo::WireTransformation(TGeoNode const& node) const
+  {
+    // same composition as in `geo::GeoNodePath`, for the same result
+    geo::TransformationMatrix trans = fTrans.Matrix();
+    trans *= convertTransformationMatrix<geo::TransformationMatrix>(*node.GetMatrix());
+    return trans;
+  } // PlaneGeo::WireTransformation()
+
+  //......................................................................
+  PlaneGeo::WireCollection_t PlaneGeo::MakeWires(std::vector<TGeoNode const*> const& nodes) const
+  {
+    // this reproduces construction, sorting and `UpdateAfterSorting()`
+    WireCollection_t wires;
+    wires.reserve(nodes.size());
+    geo::WireID::WireID_t wireNo = 0;
+    for (TGeoNode const* node : nodes) {
+      geo::WireGeo& wire = wires.emplace_back(*node, WireTransformation(*node));
+      wire.UpdateAfterSorting(geo::WireID(fID, wireNo), shouldFlipWire(wire));
+      ++wireNo;
+    } // for
+    return wires;
+  } // PlaneGeo::MakeWires()
+
+  //......................................................................
+  PlaneGeo::WireCollection_t const& PlaneGeo::ReleasedWires::wires(PlaneGeo const& plane) const
+  {
+    std::call_once(fCache->built, [this, &plane]() { fCache->wires = plane.MakeWires(fNodes); });
+    return fCache->wires;
+  } // PlaneGeo::ReleasedWires::wires()
+
+  //......................................................................
 
 } // namespace geo
 ////////////////////////////////////////////////////////////////////////
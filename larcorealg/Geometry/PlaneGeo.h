@@ -28,7 +28,10 @@
 #include "TGeoMatrix.h" // TGeoHMatrix
 
 // C/C++ standard libraries
-#include <cmath> // std::atan2()
+#include <cmath>   // std::atan2()
+#include <cstddef> // std::size_t
+#include <memory>  // std::unique_ptr
+#include <mutex>   // std::once_flag
 #include <string>
 #include <vector>
 
@@ -71,6 +74,14 @@ namespace geo {
    * available. This coordinate system is also positive defined.
    * These components are all measured in centimeters.
    *
+   * After the geometry is set up, the wire objects can be released
+   * (`ReleaseWires()`) to save memory; they are all built beforehand, so this
+   * does not save setup time. The plane keeps all its own properties
+   * (including the number of wires, their direction, pitch and the center of
+   * the first wire), and all the wire objects are rebuilt, identical to the
+   * original ones, the first time any of them is accessed (e.g. via `Wire()`,
+   * `WirePtr()` or `IterateWires()`). Rebuilding is thread-safe.
+   *
    */
   // Note: SignalType() and SetSignalType() have been removed.
   //       Use `geo::GeometryCore::SignalType` instead.
@@ -169,7 +180,7 @@ namespace geo {
     Orient_t Orientation() const { return fOrientation; }
 
     /// Angle of the wires from positive z axis; @f$ \theta_{z} \in [ 0, \pi ]@f$.
-    double ThetaZ() const;
+    double ThetaZ() const { return fThetaZ; }
 
     /// Angle from positive z axis of the wire coordinate axis, in radians
     double PhiZ() const { return std::atan2(fSinPhiZ, fCosPhiZ); }
@@ -239,7 +250,10 @@ namespace geo {
 
     //@{
     /// Number of wires in this plane
-    unsigned int Nwires() const { return fWire.size(); }
+    unsigned int Nwires() const
+    {
+      return fReleasedWires.empty() ? fWire.size() : fReleasedWires.size();
+    }
     unsigned int NElements() const { return Nwires(); }
     //@}
 
@@ -292,7 +306,7 @@ namespace geo {
      */
     geo::WirePtr WirePtr(unsigned int iwire) const
     {
-      return HasWire(iwire) ? &(fWire[iwire]) : nullptr;
+      return HasWire(iwire) ? &(Wires()[iwire]) : nullptr;
     }
 
     //@{
@@ -317,6 +331,15 @@ namespace geo {
     /// Return the last wire in the plane.
     const WireGeo& LastWire() const { return Wire(Nwires() - 1); }
 
+    /**
+     * @brief Returns the center of the first wire in the plane.
+     * @return the center of the first wire, in world coordinates [cm]
+     *
+     * This is the same as `FirstWire().GetCenter()`, but it does not need the
+     * wire objects (see `ReleaseWires()`).
+     */
+    Point_t FirstWireCenter() const { return fDecompWire.ReferencePoint(); }
+
     // @{
     /**
      * @brief Allows range-for iteration on all wires in this plane.
@@ -365,7 +388,7 @@ namespace geo {
      * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
      *
      */
-    ElementIteratorBox IterateElements() const { return fWire; }
+    ElementIteratorBox IterateElements() const { return Wires(); }
     ElementIteratorBox IterateWires() const { return IterateElements(); }
     // @}
 
@@ -485,8 +508,50 @@ namespace geo {
      *       non-existing wire which _would_ be the nearest to `pos`.
      */
     geo::WireID NearestWireID(geo::Point_t const& pos) const;
+
+    /**
+     * @brief Returns the ID of the existing wire closest to the position.
+     * @param pos world coordinates of the point [cm]
+     * @param[out] outOfRange set to whether the nearest wire does not exist
+     * @return the ID of the nearest wire, capped to the existing ones
+     * @see `NearestWireID(geo::Point_t const&) const`
+     *
+     * This version never throws. If the nearest wire exists, its ID is returned
+     * and `outOfRange` is set to `false`. Otherwise, `outOfRange` is set to
+     * `true` and the returned ID is the one of the closest existing wire (the
+     * one `InvalidWireError::suggestedWireID()` would report), which is either
+     * the first or the last wire in the plane.
+     */
+    geo::WireID NearestWireID(geo::Point_t const& pos, bool& outOfRange) const noexcept;
     //@}
 
+    /**
+     * @brief Finds the number of the nearest wire for many points.
+     * @param n number of points
+     * @param x array with the _x_ world coordinate of each point [cm]
+     * @param y array with the _y_ world coordinate of each point [cm]
+     * @param z array with the _z_ world coordinate of each point [cm]
+     * @param[out] wireNos array to be filled with `n` wire numbers
+     * @param[out] outOfRange array to be filled with `n` status flags
+     * @return the number of points whose nearest wire does not exist
+     * @see `NearestWireID()`
+     *
+     * This is the batch version of `NearestWireID()`, working on arrays of
+     * coordinates ("structure of arrays") so that the compiler can vectorize
+     * the loop. No exception is thrown: for each point whose nearest wire would
+     * not exist, the corresponding `outOfRange` flag is set, and the number of
+     * the closest existing wire is written into `wireNos` instead (like
+     * `InvalidWireError::suggestedWireID()` would report).
+     * For all the other points, the flag is unset and the wire number is the
+     * same as `NearestWireID()` returns.
+     */
+    std::size_t NearestWireNumbers(std::size_t n,
+                                   double const* x,
+                                   double const* y,
+                                   double const* z,
+                                   geo::WireID::WireID_t* wireNos,
+                                   bool* outOfRange) const;
+
     /**
      * @brief Returns the wire closest to the specified position.
      * @param pos world coordinates of the point [cm]
@@ -799,6 +864,25 @@ namespace geo {
       return PlaneCoordinate(point) / WirePitch();
     }
 
+    /**
+     * @brief Computes the wire coordinate of many points, in wire units.
+     * @param n number of points
+     * @param x array with the _x_ world coordinate of each point [cm]
+     * @param y array with the _y_ world coordinate of each point [cm]
+     * @param z array with the _z_ world coordinate of each point [cm]
+     * @param[out] wireCoords array to be filled with `n` wire coordinates
+     * @see `WireCoordinate()`
+     *
+     * The result is the same as calling `WireCoordinate()` on each point, but
+     * the coordinates are in separate arrays ("structure of arrays") so that
+     * the compiler can vectorize the loop.
+     */
+    void WireCoordinates(std::size_t n,
+                         double const* x,
+                         double const* y,
+                         double const* z,
+                         double* wireCoords) const;
+
     //@{
     /**
      * @brief Decomposes a 3D point in two components.
@@ -1261,6 +1345,22 @@ namespace geo {
     /// Performs all needed updates after the TPC has sorted the planes.
     void UpdateAfterSorting(geo::PlaneID planeid, geo::BoxBoundedGeo const& TPCbox);
 
+    /**
+     * @brief Releases the wire objects, which are rebuilt on first access.
+     * @return whether the wires have been released
+     *
+     * Only the node of each wire is kept, and the wire objects are rebuilt
+     * from it and from the transformation of the plane. That is possible only
+     * if each wire node is a direct daughter of the plane node, and if the
+     * transformation of each wire was composed as
+     * `geo::GeometryBuilderStandard` does. To verify that, the wires are
+     * rebuilt once here and compared with the existing ones (start, center
+     * and end of each wire): if any differs, the wires are kept.
+     * This must be called after `UpdateAfterSorting()`, since sorting and
+     * updating need the wires (and rebuild them if they have been released).
+     */
+    bool ReleaseWires();
+
     /// Returns the name of the specified view.
     static std::string ViewName(geo::View_t view);
 
@@ -1310,13 +1410,75 @@ namespace geo {
     /// Updates the internally used active area.
     void UpdateActiveArea();
 
+    /// Updates the stored @f$ \theta_{z} @f$ from the first wire.
+    void UpdateThetaZ();
+
     /// Whether the specified wire should have start and end swapped.
     bool shouldFlipWire(geo::WireGeo const& wire) const;
 
+    /// Returns all the wires, rebuilding them if they have been released.
+    WireCollection_t const& Wires() const
+    {
+      return fReleasedWires.empty() ? fWire : fReleasedWires.wires(*this);
+    }
+
+    /// Puts the wires back into `fWire`, if they have been released.
+    void RestoreWires();
+
+    /// Returns the transformation of a wire with the specified `node`.
+    geo::TransformationMatrix WireTransformation(TGeoNode const& node) const;
+
+    /// Builds the wires with the specified nodes, ready for use.
+    WireCollection_t MakeWires(std::vector<TGeoNode const*> const& nodes) const;
+
   private:
     using LocalTransformation_t =
       geo::LocalTransformationGeo<ROOT::Math::Transform3D, LocalPoint_t, LocalVector_t>;
 
+    /// Nodes of released wires, and the wires rebuilt from them on demand.
+    class ReleasedWires {
+    public:
+      ReleasedWires() = default;
+      ReleasedWires(std::vector<TGeoNode const*>&& nodes)
+        : fNodes(std::move(nodes)), fCache(makeCache())
+      {}
+
+      // copies do not share the rebuilt wires, and rebuild them on their own
+      ReleasedWires(ReleasedWires const& other) : fNodes(other.fNodes), fCache(makeCache()) {}
+      ReleasedWires(ReleasedWires&&) = default;
+      ReleasedWires& operator=(ReleasedWires const& other)
+      {
+        fNodes = other.fNodes;
+        fCache = makeCache();
+        return *this;
+      }
+      ReleasedWires& operator=(ReleasedWires&&) = default;
+
+      /// Returns whether there are no released wires.
+      bool empty() const { return fNodes.empty(); }
+
+      /// Returns the number of released wires.
+      std::size_t size() const { return fNodes.size(); }
+
+      /// Returns the wires, rebuilding them for `plane` on the first call.
+      WireCollection_t const& wires(PlaneGeo const& plane) const;
+
+    private:
+      struct Cache_t {
+        std::once_flag built;    ///< Whether the wires have been rebuilt.
+        WireCollection_t wires;  ///< The rebuilt wires.
+      };
+
+      std::vector<TGeoNode const*> fNodes; ///< Node of each wire, in order.
+      std::unique_ptr<Cache_t> fCache;     ///< Rebuilt wires (only if released).
+
+      /// Returns a new cache if there are wires to be rebuilt, none otherwise.
+      std::unique_ptr<Cache_t> makeCache() const
+      {
+        return fNodes.empty() ? nullptr : std::make_unique<Cache_t>();
+      }
+    }; // ReleasedWires
+
     struct RectSpecs {
       double halfWidth;
       double halfDepth;
@@ -1332,7 +1494,9 @@ namespace geo {
     View_t fView;                 ///< Does this plane measure U, V, or W?
     Orient_t fOrientation;        ///< Is the plane vertical or horizontal?
     WireCollection_t fWire;       ///< List of wires in this plane.
+    ReleasedWires fReleasedWires; ///< Wire nodes, if wires were released.
     double fWirePitch;            ///< Pitch of wires in this plane.
+    double fThetaZ;               ///< @f$ \theta_{z} @f$ of the wires.
     double fSinPhiZ;              ///< Sine of @f$ \phi_{z} @f$.
     double fCosPhiZ;              ///< Cosine of @f$ \phi_{z} @f$.
 
@@ -1,6 +1,6 @@
 /**
  * @file   larcorealg/Geometry/ReadoutDataContainers.h
- * @brief  Containers to hold one datum per TPC set or readout plane.
+ * @brief  Containers to hold one datum per TPC set, readout plane or channel.
  * @author Gianluca Petrillo (petrillo@slac.stanford.edu)
  * @date   September 7, 2019
  * @ingroup Geometry
@@ -14,8 +14,16 @@
 // LArSoft libraries
 #include "larcorealg/Geometry/GeometryDataContainers.h"
 #include "larcorealg/Geometry/ReadoutIDmapper.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
 #include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
 
+// C/C++ standard libraries
+#include <algorithm> // std::fill()
+#include <cstddef>   // std::size_t
+#include <stdexcept> // std::out_of_range
+#include <string>    // std::to_string()
+#include <vector>
+
 namespace readout {
 
   template <typename T>
@@ -24,6 +32,9 @@ namespace readout {
   template <typename T>
   class ROPDataContainer;
 
+  template <typename T>
+  class ChannelDataContainer;
+
 } // namespace geo
 
 // --- BEGIN Readout data containers -------------------------------------------
@@ -311,6 +322,160 @@ public:
 
 }; // class readout::ROPDataContainer<>
 
+//------------------------------------------------------------------------------
+/**
+ * @brief Container with one element per readout channel.
+ * @tparam T type of the contained datum
+ * @see `geo::GeometryCore::makeChannelData`
+ *
+ * The container is indexed by channel number (`raw::ChannelID_t`), and it
+ * covers all the channels from `0` to the number of channels minus one.
+ * The data is stored contiguously in channel order.
+ *
+ * This example collects the pedestal of each channel:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * auto const* geom = lar::providerFrom<geo::GeometryCore>();
+ * auto pedestals = geom->makeChannelData(0.0);
+ *
+ * for (raw::RawDigit const& digits: rawDigits)
+ *   pedestals[digits.Channel()] = digits.GetPedestal();
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+template <typename T>
+class readout::ChannelDataContainer {
+
+  using Container_t = std::vector<T>; ///< Type of data storage.
+
+public:
+  using ID_t = raw::ChannelID_t; ///< Type used as ID for this container.
+
+  /// @{
+  /// @name STL container types.
+
+  using value_type = typename Container_t::value_type;
+  using reference = typename Container_t::reference;
+  using const_reference = typename Container_t::const_reference;
+  using pointer = typename Container_t::pointer;
+  using const_pointer = typename Container_t::const_pointer;
+  using iterator = typename Container_t::iterator;
+  using const_iterator = typename Container_t::const_iterator;
+  using difference_type = typename Container_t::difference_type;
+  using size_type = typename Container_t::size_type;
+
+  /// @}
+
+  /// Default constructor: container has no room at all.
+  ChannelDataContainer() = default;
+
+  /// Prepares the container with default-constructed data for `nChannels`.
+  explicit ChannelDataContainer(std::size_t nChannels) : fData(nChannels) {}
+
+  /// Prepares the container with copies of `defValue` for `nChannels`.
+  ChannelDataContainer(std::size_t nChannels, value_type const& defValue)
+    : fData(nChannels, defValue)
+  {}
+
+  // --- BEGIN Container status query ------------------------------------------
+  /// @name Container status query
+  /// @{
+
+  /// Returns the number of elements in the container (one per channel).
+  size_type size() const { return fData.size(); }
+
+  /// Returns whether the container has no elements.
+  bool empty() const { return fData.empty(); }
+
+  /// Returns whether this container hosts data for the specified channel.
+  bool hasChannel(ID_t channel) const { return channel < size(); }
+
+  /// @}
+  // --- END Container status query --------------------------------------------
+
+  // --- BEGIN Element access --------------------------------------------------
+  /// @name Element access
+  /// @{
+
+  /// Returns the element for the specified channel.
+  reference operator[](ID_t channel) { return fData[channel]; }
+
+  /// Returns the element for the specified channel (read-only).
+  const_reference operator[](ID_t channel) const { return fData[channel]; }
+
+  /// Returns the element for the specified channel.
+  /// @throw std::out_of_range if `channel` is not within the container range
+  reference at(ID_t channel)
+  {
+    if (hasChannel(channel)) return fData[channel];
+    throw std::out_of_range("No data for channel " + std::to_string(channel));
+  }
+
+  /// Returns the element for the specified channel (read-only).
+  /// @throw std::out_of_range if `channel` is not within the container range
+  const_reference at(ID_t channel) const
+  {
+    if (hasChannel(channel)) return fData[channel];
+    throw std::out_of_range("No data for channel " + std::to_string(channel));
+  }
+
+  /// Returns the elements in channel order, as a contiguous array.
+  pointer data() { return fData.data(); }
+
+  /// Returns the elements in channel order, as a contiguous array.
+  const_pointer data() const { return fData.data(); }
+
+  /// @}
+  // --- END Element access ----------------------------------------------------
+
+  // --- BEGIN Iterators -------------------------------------------------------
+  /// @name Iterators (in channel order)
+  /// @{
+
+  iterator begin() { return fData.begin(); }
+  iterator end() { return fData.end(); }
+  const_iterator begin() const { return fData.begin(); }
+  const_iterator end() const { return fData.end(); }
+  const_iterator cbegin() const { return fData.cbegin(); }
+  const_iterator cend() const { return fData.cend(); }
+
+  /// @}
+  // --- END Iterators ---------------------------------------------------------
+
+  // --- BEGIN Data modification -----------------------------------------------
+  /// @name Data modification
+  /// @{
+
+  /// Sets all elements to the specified `value` (copied).
+  void fill(value_type value) { std::fill(fData.begin(), fData.end(), value); }
+
+  /// Sets all the elements to a default-constructed `value_type`.
+  void reset() { fill(value_type{}); }
+
+  /// Applies the unary operation `op` to all elements; returns `op`.
+  template <typename Op>
+  Op apply(Op&& op)
+  {
+    for (auto& data : fData)
+      op(data);
+    return op;
+  }
+
+  /// Applies the unary operation `op` to all elements; returns `op`.
+  template <typename Op>
+  Op apply(Op&& op) const
+  {
+    for (auto const& data : fData)
+      op(data);
+    return op;
+  }
+
+  /// @}
+  // --- END Data modification -------------------------------------------------
+
+private:
+  Container_t fData; ///< Data, in channel order.
+
+}; // class readout::ChannelDataContainer<>
+
 /// @}
 // --- END Readout data containers ---------------------------------------------
 //------------------------------------------------------------------------------
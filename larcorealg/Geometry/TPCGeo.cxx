@@ -228,6 +228,15 @@ namespace geo {
 
   } // TPCGeo::UpdateAfterSorting()
 
+  //......................................................................
+  unsigned int TPCGeo::ReleaseWires()
+  {
+    unsigned int nPlanes = 0;
+    for (geo::PlaneGeo& plane : fPlanes)
+      if (plane.ReleaseWires()) ++nPlanes;
+    return nPlanes;
+  } // TPCGeo::ReleaseWires()
+
   //......................................................................
   std::string TPCGeo::TPCInfo(std::string indent /* = "" */, unsigned int verbosity /* = 1 */) const
   {
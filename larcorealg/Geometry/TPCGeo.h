@@ -529,6 +529,10 @@ namespace geo {
     /// Performs all updates after cryostat has sorted TPCs
     void UpdateAfterSorting(geo::TPCID tpcid);
 
+    /// Releases the wire objects of all planes (see `PlaneGeo::ReleaseWires()`);
+    /// returns the number of planes whose wires have been released.
+    unsigned int ReleaseWires();
+
     /**
      * @brief Prints information about this TPC.
      * @tparam Stream type of output stream to use
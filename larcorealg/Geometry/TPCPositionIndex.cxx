@@ -0,0 +1,205 @@
+/**
+ * @file   larcorealg/Geometry/TPCPositionIndex.cxx
+ * @brief  Spatial index to find the cryostat and TPC containing a point.
+ * @see    larcorealg/Geometry/TPCPositionIndex.h
+ */
+
+// class header
+#include "larcorealg/Geometry/TPCPositionIndex.h"
+
+// LArSoft libraries
+#include "larcorealg/Geometry/BoxBoundedGeo.h"
+#include "larcorealg/Geometry/CryostatGeo.h"
+#include "larcorealg/Geometry/TPCGeo.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::min(), std::max()
+#include <cmath>     // std::ceil()
+#include <numeric>   // std::partial_sum()
+
+namespace {
+
+  /// Box boundaries, expanded by the wiggle factor: { min, max } per axis.
+  using ExpandedBox_t = std::array<std::array<double, 2U>, 3U>;
+
+  /// Returns the range of `box` as `geo::BoxBoundedGeo::CoordinateContained()`
+  /// accepts it with the specified `wiggle` factor.
+  ExpandedBox_t expandedBox(geo::BoxBoundedGeo const& box, double wiggle)
+  {
+    auto const expand = [wiggle](double min, double max) -> std::array<double, 2U> {
+      return {(min > 0) ? min / wiggle : min * wiggle, (max < 0) ? max / wiggle : max * wiggle};
+    };
+    return {expand(box.MinX(), box.MaxX()),
+            expand(box.MinY(), box.MaxY()),
+            expand(box.MinZ(), box.MaxZ())};
+  } // expandedBox()
+
+} // local namespace
+
+namespace geo {
+
+  //----------------------------------------------------------------------------
+  TPCPositionIndex::TPCPositionIndex(CryostatList_t const& cryostats, double wiggle)
+    : fWiggle(wiggle)
+  {
+    if (cryostats.empty()) return;
+
+    //
+    // grid boundaries: all cryostats and TPCs, with tolerance
+    //
+    fMin.fill(std::numeric_limits<double>::max());
+    fMax.fill(std::numeric_limits<double>::lowest());
+    auto const includeBox = [this](ExpandedBox_t const& box) {
+      for (std::size_t axis = 0; axis < 3; ++axis) {
+        fMin[axis] = std::min(fMin[axis], box[axis][0]);
+        fMax[axis] = std::max(fMax[axis], box[axis][1]);
+      }
+    };
+
+    std::array<double, 3U> sizeSum{0.0, 0.0, 0.0};
+    std::size_t nTPCs = 0;
+    for (CryostatGeo const& cryo : cryostats) {
+      includeBox(expandedBox(cryo.BoundingBox(), fWiggle));
+      for (TPCGeo const& tpc : cryo.IterateTPCs()) {
+        includeBox(expandedBox(tpc.BoundingBox(), fWiggle));
+        sizeSum[0] += tpc.SizeX();
+        sizeSum[1] += tpc.SizeY();
+        sizeSum[2] += tpc.SizeZ();
+        ++nTPCs;
+      }
+    } // for cryostats
+
+    //
+    // cell size: about the size of a TPC (cells are not used without TPCs)
+    //
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+      double const extent = fMax[axis] - fMin[axis];
+      double const typicalSize = (nTPCs > 0) ? sizeSum[axis] / nTPCs : extent;
+      std::size_t nCells = 1U;
+      if ((extent > 0.0) && (typicalSize > 0.0)) {
+        nCells = static_cast<std::size_t>(std::ceil(extent / typicalSize));
+        nCells = std::min(std::max(nCells, std::size_t{1U}), MaxCellsPerAxis);
+      }
+      fNCells[axis] = nCells;
+      fInvCellSize[axis] = (extent > 0.0) ? nCells / extent : 0.0;
+    } // for axis
+
+    std::size_t const totalCells = fNCells[0] * fNCells[1] * fNCells[2];
+
+    //
+    // fill the cells with the candidates, in two passes (count, then fill);
+    // candidates are added in ID order, so that each cell is sorted
+    //
+    auto const forEachCell = [this](ExpandedBox_t const& box, auto&& action) {
+      std::size_t const ixMin = axisCell(0, box[0][0]), ixMax = axisCell(0, box[0][1]);
+      std::size_t const iyMin = axisCell(1, box[1][0]), iyMax = axisCell(1, box[1][1]);
+      std::size_t const izMin = axisCell(2, box[2][0]), izMax = axisCell(2, box[2][1]);
+      for (std::size_t ix = ixMin; ix <= ixMax; ++ix)
+        for (std::size_t iy = iyMin; iy <= iyMax; ++iy)
+          for (std::size_t iz = izMin; iz <= izMax; ++iz)
+            action(flatIndex(ix, iy, iz));
+    };
+
+    fCryoOffsets.assign(totalCells + 1, 0U);
+    fTPCoffsets.assign(totalCells + 1, 0U);
+    for (CryostatGeo const& cryo : cryostats) {
+      forEachCell(expandedBox(cryo.BoundingBox(), fWiggle),
+                  [this](std::size_t cell) { ++fCryoOffsets[cell + 1]; });
+      for (TPCGeo const& tpc : cryo.IterateTPCs()) {
+        forEachCell(expandedBox(tpc.BoundingBox(), fWiggle),
+                    [this](std::size_t cell) { ++fTPCoffsets[cell + 1]; });
+      }
+    } // for cryostats
+    std::partial_sum(fCryoOffsets.begin(), fCryoOffsets.end(), fCryoOffsets.begin());
+    std::partial_sum(fTPCoffsets.begin(), fTPCoffsets.end(), fTPCoffsets.begin());
+
+    fCryoCandidates.resize(fCryoOffsets.back(), nullptr);
+    fTPCcandidates.resize(fTPCoffsets.back(), nullptr);
+    std::vector<std::size_t> nextCryo(fCryoOffsets.begin(), fCryoOffsets.end() - 1);
+    std::vector<std::size_t> nextTPC(fTPCoffsets.begin(), fTPCoffsets.end() - 1);
+    for (CryostatGeo const& cryo : cryostats) {
+      forEachCell(expandedBox(cryo.BoundingBox(), fWiggle),
+                  [this, &nextCryo, &cryo](std::size_t cell) {
+                    fCryoCandidates[nextCryo[cell]++] = &cryo;
+                  });
+      for (TPCGeo const& tpc : cryo.IterateTPCs()) {
+        forEachCell(expandedBox(tpc.BoundingBox(), fWiggle),
+                    [this, &nextTPC, &tpc](std::size_t cell) {
+                      fTPCcandidates[nextTPC[cell]++] = &tpc;
+                    });
+      }
+    } // for cryostats
+
+  } // TPCPositionIndex::TPCPositionIndex()
+
+  //----------------------------------------------------------------------------
+  CryostatGeo const* TPCPositionIndex::findCryostat(Point_t const& point) const
+  {
+    std::size_t const cell = cellIndex(point);
+    if (cell == NoCell) return nullptr;
+
+    for (std::size_t i = fCryoOffsets[cell]; i < fCryoOffsets[cell + 1]; ++i) {
+      CryostatGeo const* cryo = fCryoCandidates[i];
+      if (cryo->ContainsPosition(point, fWiggle)) return cryo;
+    }
+    return nullptr;
+  } // TPCPositionIndex::findCryostat()
+
+  //----------------------------------------------------------------------------
+  TPCGeo const* TPCPositionIndex::findTPC(Point_t const& point) const
+  {
+    std::size_t const cell = cellIndex(point);
+    if (cell == NoCell) return nullptr;
+
+    for (std::size_t i = fCryoOffsets[cell]; i < fCryoOffsets[cell + 1]; ++i) {
+      CryostatGeo const* cryo = fCryoCandidates[i];
+      if (cryo->ContainsPosition(point, fWiggle)) return findTPCinCell(cell, point, *cryo);
+    }
+    return nullptr;
+  } // TPCPositionIndex::findTPC()
+
+  //----------------------------------------------------------------------------
+  TPCGeo const* TPCPositionIndex::findTPC(Point_t const& point, CryostatGeo const& cryo) const
+  {
+    std::size_t const cell = cellIndex(point);
+    return (cell == NoCell) ? nullptr : findTPCinCell(cell, point, cryo);
+  } // TPCPositionIndex::findTPC(CryostatGeo)
+
+  //----------------------------------------------------------------------------
+  std::size_t TPCPositionIndex::cellIndex(Point_t const& point) const
+  {
+    if (empty()) return NoCell;
+
+    double const coords[3] = {point.X(), point.Y(), point.Z()};
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+      // written to reject also NaN coordinates
+      if (!((coords[axis] >= fMin[axis]) && (coords[axis] <= fMax[axis]))) return NoCell;
+    }
+    return flatIndex(axisCell(0, coords[0]), axisCell(1, coords[1]), axisCell(2, coords[2]));
+  } // TPCPositionIndex::cellIndex()
+
+  //----------------------------------------------------------------------------
+  std::size_t TPCPositionIndex::axisCell(std::size_t axis, double coord) const
+  {
+    // the same function is used when filling and when querying the cells:
+    // being monotonic, it preserves the containment of a point in a box
+    auto const cell = static_cast<std::size_t>((coord - fMin[axis]) * fInvCellSize[axis]);
+    return std::min(cell, fNCells[axis] - 1);
+  } // TPCPositionIndex::axisCell()
+
+  //----------------------------------------------------------------------------
+  TPCGeo const* TPCPositionIndex::findTPCinCell(std::size_t cell,
+                                                Point_t const& point,
+                                                CryostatGeo const& cryo) const
+  {
+    for (std::size_t i = fTPCoffsets[cell]; i < fTPCoffsets[cell + 1]; ++i) {
+      TPCGeo const* tpc = fTPCcandidates[i];
+      if (tpc->ID().asCryostatID() != cryo.ID()) continue;
+      if (tpc->ContainsPosition(point, fWiggle)) return tpc;
+    }
+    return nullptr;
+  } // TPCPositionIndex::findTPCinCell()
+
+  //----------------------------------------------------------------------------
+
+} // namespace geo
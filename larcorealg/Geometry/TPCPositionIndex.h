@@ -0,0 +1,147 @@
+/**
+ * @file   larcorealg/Geometry/TPCPositionIndex.h
+ * @brief  Spatial index to find the cryostat and TPC containing a point.
+ * @see    larcorealg/Geometry/TPCPositionIndex.cxx
+ * @ingroup Geometry
+ */
+
+#ifndef LARCOREALG_GEOMETRY_TPCPOSITIONINDEX_H
+#define LARCOREALG_GEOMETRY_TPCPOSITIONINDEX_H
+
+// LArSoft libraries
+#include "larcorealg/Geometry/GeometryData.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h" // geo::Point_t
+
+// C/C++ standard libraries
+#include <array>
+#include <cstddef> // std::size_t
+#include <limits>
+#include <vector>
+
+namespace geo {
+
+  class CryostatGeo;
+  class TPCGeo;
+
+  /**
+   * @brief Uniform grid accelerating the lookup of the TPC at a position.
+   * @ingroup Geometry
+   *
+   * The volume enclosing all the cryostats of the detector is split into a
+   * regular grid of cells. Each cell records the cryostats and the TPCs whose
+   * box (expanded by the wiggle factor) overlaps with it. A query locates the
+   * cell containing the point (constant time) and tests only the candidates
+   * registered in it.
+   *
+   * Candidates are stored in ID order, so that the result is exactly the same
+   * as the one of the linear scan:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * for (geo::CryostatGeo const& cryo: cryostats) {
+   *   if (!cryo.ContainsPosition(point, wiggle)) continue;
+   *   return cryo.PositionToTPCptr(point, wiggle);
+   * }
+   * return nullptr;
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * including the treatment of the `wiggle` tolerance factor
+   * (see `geo::BoxBoundedGeo::ContainsPosition()`).
+   *
+   * The index keeps pointers to the geometry objects: it must be rebuilt
+   * whenever the cryostat list is changed or sorted.
+   */
+  class TPCPositionIndex {
+  public:
+    /// Type of list of cryostats the index is built from.
+    using CryostatList_t = GeometryData_t::CryostatList_t;
+
+    /// Number of grid cells on each direction.
+    using CellCounts_t = std::array<std::size_t, 3U>;
+
+    /// Largest number of grid cells on each direction.
+    static constexpr std::size_t MaxCellsPerAxis = 128U;
+
+    /// Constructor: an empty index, which does not find anything.
+    TPCPositionIndex() = default;
+
+    /**
+     * @brief Constructor: indexes all the cryostats and TPCs.
+     * @param cryostats the list of cryostats to be indexed
+     * @param wiggle tolerance factor as in `geo::BoxBoundedGeo::ContainsPosition()`
+     *
+     * The cryostats must be already sorted (their TPCs too), and must not be
+     * moved for the whole lifetime of the index.
+     */
+    TPCPositionIndex(CryostatList_t const& cryostats, double wiggle);
+
+    /// Returns whether the index contains no cryostat at all.
+    bool empty() const { return fCryoOffsets.empty(); }
+
+    /// Returns the tolerance factor the index was built with.
+    double wiggle() const { return fWiggle; }
+
+    /// Returns the number of cells in the grid on each direction.
+    CellCounts_t const& cellCounts() const { return fNCells; }
+
+    /**
+     * @brief Returns the cryostat containing the specified point.
+     * @param point the location [cm]
+     * @return the first cryostat containing `point`, `nullptr` if none
+     */
+    CryostatGeo const* findCryostat(Point_t const& point) const;
+
+    /**
+     * @brief Returns the TPC containing the specified point.
+     * @param point the location [cm]
+     * @return the TPC containing `point`, `nullptr` if none
+     *
+     * The TPC is looked for only in the cryostat returned by `findCryostat()`.
+     */
+    TPCGeo const* findTPC(Point_t const& point) const;
+
+    /**
+     * @brief Returns the TPC of the specified cryostat containing a point.
+     * @param point the location [cm]
+     * @param cryo the cryostat the TPC is looked for in
+     * @return the TPC of `cryo` containing `point`, `nullptr` if none
+     */
+    TPCGeo const* findTPC(Point_t const& point, CryostatGeo const& cryo) const;
+
+  private:
+    /// Value of cell index denoting a point outside the grid.
+    static constexpr std::size_t NoCell = std::numeric_limits<std::size_t>::max();
+
+    double fWiggle = 1.0;                  ///< Tolerance factor on containment.
+    std::array<double, 3U> fMin{};         ///< Lower corner of the grid.
+    std::array<double, 3U> fMax{};         ///< Upper corner of the grid.
+    std::array<double, 3U> fInvCellSize{}; ///< Inverse of cell size on each axis.
+    CellCounts_t fNCells{};                ///< Number of cells on each axis.
+
+    /// Cell `i` has cryostats from `fCryoOffsets[i]` to `fCryoOffsets[i+1]`.
+    std::vector<std::size_t> fCryoOffsets;
+    std::vector<CryostatGeo const*> fCryoCandidates; ///< Cryostats in each cell.
+
+    /// Cell `i` has TPCs from `fTPCoffsets[i]` to `fTPCoffsets[i+1]`.
+    std::vector<std::size_t> fTPCoffsets;
+    std::vector<TPCGeo const*> fTPCcandidates; ///< TPCs in each cell.
+
+    /// Returns the index of the cell containing `point`, or `NoCell`.
+    std::size_t cellIndex(Point_t const& point) const;
+
+    /// Returns the index of the cell on the specified axis (no range check).
+    std::size_t axisCell(std::size_t axis, double coord) const;
+
+    /// Returns the flat index of the cell with the specified axis indices.
+    std::size_t flatIndex(std::size_t ix, std::size_t iy, std::size_t iz) const
+    {
+      return (ix * fNCells[1] + iy) * fNCells[2] + iz;
+    }
+
+    /// Returns the TPC of cryostat `cryo` containing `point` within `cell`.
+    TPCGeo const* findTPCinCell(std::size_t cell,
+                                Point_t const& point,
+                                CryostatGeo const& cryo) const;
+
+  }; // class TPCPositionIndex
+
+} // namespace geo
+
+#endif // LARCOREALG_GEOMETRY_TPCPOSITIONINDEX_H
@@ -0,0 +1,261 @@
+/**
+ * @file   larcorealg/Geometry/WireDataContainer.h
+ * @brief  Container to hold one datum per wire, with no padding.
+ * @ingroup Geometry
+ */
+
+#ifndef LARCOREALG_GEOMETRY_WIREDATACONTAINER_H
+#define LARCOREALG_GEOMETRY_WIREDATACONTAINER_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/span.h"
+#include "larcorealg/Geometry/GeometryDataContainers.h" // geo::details iterators
+#include "larcorealg/Geometry/WireIDmapper.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::fill()
+#include <stdexcept> // std::out_of_range
+#include <string>
+#include <utility> // std::pair
+#include <vector>
+
+namespace geo {
+
+  template <typename T>
+  class WireDataContainer;
+
+} // namespace geo
+
+// --- BEGIN Geometry data containers ----------------------------------------
+/// @name Geometry data containers
+/// @ingroup Geometry
+/// @{
+
+/** **************************************************************************
+ * @brief Container with one element per geometry wire.
+ * @tparam T type of the contained datum
+ * @see `geo::GeometryCore::makeWireData`, `geo::WireIDmapper`
+ *
+ * Unlike the other geometry containers, this one is not sized for the largest
+ * plane of the detector: it holds exactly one element for each existing wire,
+ * as described by a `geo::WireIDmapper` built from the geometry.
+ * The data is stored contiguously in `geo::WireID` order, so the data of all
+ * the wires of a plane is also contiguous (see `planeData()`), and iterating
+ * through the container runs through memory sequentially.
+ *
+ * This example collects the hits on each wire:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * auto const* geom = lar::providerFrom<geo::GeometryCore>();
+ * auto hitsPerWire = geom->makeWireData<std::vector<recob::Hit const*>>();
+ *
+ * for (recob::Hit const& hit: hits) {
+ *   if (hit.WireID()) hitsPerWire[hit.WireID()].push_back(&hit);
+ * } // for
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * The container is of fixed size and can't be resized.
+ */
+template <typename T>
+class geo::WireDataContainer {
+
+  using Container_t = std::vector<T>; ///< Type of data storage.
+
+public:
+  /// Type of mapper between IDs and index.
+  using Mapper_t = geo::WireIDmapper;
+
+  using ID_t = typename Mapper_t::ID_t; ///< Type used as ID for this container.
+
+  /// @{
+  /// @name STL container types.
+
+  using value_type = typename Container_t::value_type;
+  using reference = typename Container_t::reference;
+  using const_reference = typename Container_t::const_reference;
+  using pointer = typename Container_t::pointer;
+  using const_pointer = typename Container_t::const_pointer;
+  using iterator =
+    details::GeoIDdataContainerIterator<Mapper_t, typename Container_t::iterator>;
+  using const_iterator =
+    details::GeoIDdataContainerIterator<Mapper_t, typename Container_t::const_iterator>;
+  using difference_type = typename Container_t::difference_type;
+  using size_type = typename Container_t::size_type;
+
+  /// Special iterator dereferencing to pairs ( ID, value ) (see `items()`).
+  using item_iterator = details::GeoIDdataContainerItemIterator<iterator>;
+
+  /// Special iterator dereferencing to pairs ( ID, value ) (see `items()`).
+  using item_const_iterator = details::GeoIDdataContainerItemIterator<const_iterator>;
+
+  /// @}
+
+  /// Default constructor: container has no room at all.
+  WireDataContainer() = default;
+
+  /**
+   * @brief Prepares the container with default-constructed data.
+   * @param mapper mapping of all the wires, as from the geometry
+   */
+  WireDataContainer(Mapper_t const& mapper) : fMapper(mapper), fData(fMapper.size()) {}
+
+  /**
+   * @brief Prepares the container with copies of the specified default value.
+   * @param mapper mapping of all the wires, as from the geometry
+   * @param defValue the value copied to fill all entries in the container
+   */
+  WireDataContainer(Mapper_t const& mapper, value_type const& defValue)
+    : fMapper(mapper), fData(fMapper.size(), defValue)
+  {}
+
+  // --- BEGIN Container status query ------------------------------------------
+  /// @name Container status query
+  /// @{
+
+  /// Returns the number of elements in the container (one per wire).
+  size_type size() const { return fData.size(); }
+
+  /// Returns whether the container has no elements.
+  bool empty() const { return fData.empty(); }
+
+  /// Returns whether this container hosts data for the specified plane.
+  bool hasPlane(geo::PlaneID const& planeid) const { return fMapper.nWires(planeid) > 0U; }
+
+  /// Returns whether this container hosts data for the specified wire.
+  bool hasWire(geo::WireID const& wireid) const { return fMapper.hasWire(wireid); }
+
+  /// Returns the mapper object used to convert ID's and container positions.
+  Mapper_t const& mapper() const { return fMapper; }
+
+  /// @}
+  // --- END Container status query --------------------------------------------
+
+  // --- BEGIN Element access --------------------------------------------------
+  /// @name Element access
+  /// @{
+
+  /// Returns the element for the specified wire.
+  reference operator[](ID_t const& id) { return fData[fMapper.index(id)]; }
+
+  /// Returns the element for the specified wire (read-only).
+  const_reference operator[](ID_t const& id) const { return fData[fMapper.index(id)]; }
+
+  /// Returns the element for the specified wire.
+  /// @throw std::out_of_range if wire `id` is not within the container range
+  reference at(ID_t const& id)
+  {
+    if (hasWire(id)) return operator[](id);
+    throw std::out_of_range("No data for " + std::string(id));
+  }
+
+  /// Returns the element for the specified wire (read-only).
+  /// @throw std::out_of_range if wire `id` is not within the container range
+  const_reference at(ID_t const& id) const
+  {
+    if (hasWire(id)) return operator[](id);
+    throw std::out_of_range("No data for " + std::string(id));
+  }
+
+  /// Returns the elements of all the wires in the plane (empty if no plane).
+  auto planeData(geo::PlaneID const& planeid)
+  {
+    auto const [first, n] = planeRange(planeid);
+    return util::make_span(fData.begin() + first, fData.begin() + first + n);
+  }
+
+  /// Returns the elements of all the wires in the plane (empty if no plane).
+  auto planeData(geo::PlaneID const& planeid) const
+  {
+    auto const [first, n] = planeRange(planeid);
+    return util::make_span(fData.cbegin() + first, fData.cbegin() + first + n);
+  }
+
+  /// Returns the elements in wire ID order, as a contiguous array.
+  pointer data() { return fData.data(); }
+
+  /// Returns the elements in wire ID order, as a contiguous array.
+  const_pointer data() const { return fData.data(); }
+
+  /// @}
+  // --- END Element access ----------------------------------------------------
+
+  // --- BEGIN Iterators -------------------------------------------------------
+  /**
+   * @name Iterators
+   *
+   * Iterators run through the data in wire ID order, which is also their
+   * order in memory. Like for `geo::GeoIDdataContainer`, both iterators to
+   * the values (with an additional `ID()` method) and item iterators
+   * dereferencing to ( ID, value ) pairs (`items()`) are provided.
+   */
+  /// @{
+
+  iterator begin() { return {fMapper, fData.begin(), fData.begin()}; }
+  iterator end() { return {fMapper, fData.begin(), fData.end()}; }
+  const_iterator begin() const { return cbegin(); }
+  const_iterator end() const { return cend(); }
+  const_iterator cbegin() const { return {fMapper, fData.cbegin(), fData.cbegin()}; }
+  const_iterator cend() const { return {fMapper, fData.cbegin(), fData.cend()}; }
+
+  /// Returns an object suitable for a range-for loop with `item_iterator`.
+  auto items() { return util::span{item_iterator{begin()}, item_iterator{end()}}; }
+
+  /// Returns an object suitable for a range-for loop with `item_const_iterator`.
+  auto items() const
+  {
+    return util::span{item_const_iterator{cbegin()}, item_const_iterator{cend()}};
+  }
+
+  /// @}
+  // --- END Iterators ---------------------------------------------------------
+
+  // --- BEGIN Data modification -----------------------------------------------
+  /// @name Data modification
+  /// @{
+
+  /// Sets all elements to the specified `value` (copied).
+  void fill(value_type value) { std::fill(fData.begin(), fData.end(), value); }
+
+  /// Sets all the elements to a default-constructed `value_type`.
+  void reset() { fill(value_type{}); }
+
+  /// Applies the unary operation `op` to all elements; returns `op`.
+  template <typename Op>
+  Op apply(Op&& op)
+  {
+    for (auto& data : fData)
+      op(data);
+    return op;
+  }
+
+  /// Applies the unary operation `op` to all elements; returns `op`.
+  template <typename Op>
+  Op apply(Op&& op) const
+  {
+    for (auto const& data : fData)
+      op(data);
+    return op;
+  }
+
+  /// @}
+  // --- END Data modification -------------------------------------------------
+
+private:
+  Mapper_t fMapper;   ///< Mapping of the wires into data positions.
+  Container_t fData; ///< Data, in wire ID order.
+
+  /// Returns position of the first wire of `planeid` and the number of wires.
+  std::pair<difference_type, difference_type> planeRange(geo::PlaneID const& planeid) const
+  {
+    if (!hasPlane(planeid)) return {0, 0};
+    return {static_cast<difference_type>(fMapper.firstIndex(planeid)),
+            static_cast<difference_type>(fMapper.nWires(planeid))};
+  }
+
+}; // class geo::WireDataContainer<>
+
+/// @}
+// --- END Geometry data containers --------------------------------------------
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_WIREDATACONTAINER_H
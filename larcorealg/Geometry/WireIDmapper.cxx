@@ -0,0 +1,64 @@
+/**
+ * @file   larcorealg/Geometry/WireIDmapper.cxx
+ * @brief  Mapping between wire ID and dense flat index, from the geometry.
+ * @see    larcorealg/Geometry/WireIDmapper.h
+ */
+
+// class header
+#include "larcorealg/Geometry/WireIDmapper.h"
+
+// LArSoft libraries
+#include "larcorealg/Geometry/CryostatGeo.h"
+#include "larcorealg/Geometry/PlaneGeo.h"
+#include "larcorealg/Geometry/TPCGeo.h"
+#include "larcorealg/Geometry/details/extractMaxGeometryElements.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::upper_bound()
+#include <iterator>  // std::distance()
+#include <numeric>   // std::partial_sum()
+
+namespace geo {
+
+  //----------------------------------------------------------------------------
+  WireIDmapper::WireIDmapper(CryostatList_t const& cryostats)
+  {
+    auto const [nCryo, nTPCs, nPlanes] = details::extractMaxGeometryElements<3U>(cryostats);
+    fPlaneMapper.resize(nCryo, nTPCs, nPlanes);
+
+    // slots of missing planes have no wires
+    fFirstWire.assign(fPlaneMapper.size() + 1U, 0U);
+    for (CryostatGeo const& cryo : cryostats) {
+      for (TPCGeo const& tpc : cryo.IterateTPCs()) {
+        for (PlaneGeo const& plane : tpc.IteratePlanes())
+          fFirstWire[fPlaneMapper.index(plane.ID()) + 1U] = plane.Nwires();
+      }
+    }
+    std::partial_sum(fFirstWire.begin(), fFirstWire.end(), fFirstWire.begin());
+
+  } // WireIDmapper::WireIDmapper()
+
+  //----------------------------------------------------------------------------
+  unsigned int WireIDmapper::nWires(PlaneID const& planeid) const
+  {
+    if (!hasPlane(planeid)) return 0U;
+    auto const iPlane = fPlaneMapper.index(planeid);
+    return fFirstWire[iPlane + 1U] - fFirstWire[iPlane];
+  } // WireIDmapper::nWires()
+
+  //----------------------------------------------------------------------------
+  WireID WireIDmapper::ID(index_type index) const
+  {
+    if (index >= size()) return {};
+
+    // the last plane slot starting at or before `index` is the one with the
+    // wire: slots of missing planes, which are empty, are skipped
+    auto const itNext = std::upper_bound(fFirstWire.begin(), fFirstWire.end(), index);
+    auto const iPlane = static_cast<index_type>(std::distance(fFirstWire.begin(), itNext) - 1);
+    return {fPlaneMapper.ID(iPlane),
+            static_cast<WireID::WireID_t>(index - fFirstWire[iPlane])};
+  } // WireIDmapper::ID()
+
+  //----------------------------------------------------------------------------
+
+} // namespace geo
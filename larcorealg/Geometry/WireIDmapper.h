@@ -0,0 +1,117 @@
+/**
+ * @file   larcorealg/Geometry/WireIDmapper.h
+ * @brief  Mapping between wire ID and dense flat index, from the geometry.
+ * @see    larcorealg/Geometry/WireIDmapper.cxx
+ * @ingroup Geometry
+ */
+
+#ifndef LARCOREALG_GEOMETRY_WIREIDMAPPER_H
+#define LARCOREALG_GEOMETRY_WIREIDMAPPER_H
+
+// LArSoft libraries
+#include "larcorealg/Geometry/GeometryData.h"
+#include "larcorealg/Geometry/GeometryIDmapper.h" // geo::PlaneIDmapper
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <vector>
+
+namespace geo {
+
+  /**
+   * @brief Mapping between wire IDs and a dense flat index.
+   * @ingroup Geometry
+   * @see `geo::GeoIDmapper`
+   *
+   * Unlike `geo::GeoIDmapper`, which reserves the same number of elements for
+   * each plane, this mapping is built from the actual geometry and covers
+   * exactly the existing wires: the flat indices go from `0` to `size() - 1`
+   * with no gap, following the `geo::WireID` order (cryostat, TPC, plane,
+   * wire). Data containers indexed by it need no padding when planes have
+   * different number of wires.
+   *
+   * The index of the first wire of each plane is precomputed (as prefix sum
+   * of the number of wires of all planes), so that `index()` takes constant
+   * time. `ID()`, converting back, takes a binary search among the planes.
+   *
+   * The mapping must be rebuilt whenever the cryostat list is changed or
+   * sorted.
+   */
+  class WireIDmapper {
+  public:
+    using ID_t = WireID;            ///< Type used as ID for this mapping.
+    using index_type = std::size_t; ///< Type of flat index.
+
+    /// Type of list of cryostats the mapping is built from.
+    using CryostatList_t = GeometryData_t::CryostatList_t;
+
+    /// Constructor: an empty mapping, with no wires.
+    WireIDmapper() = default;
+
+    /**
+     * @brief Constructor: maps all the wires in the cryostats.
+     * @param cryostats the list of cryostats with the wires
+     *
+     * The cryostats must be already sorted (including all their content).
+     */
+    explicit WireIDmapper(CryostatList_t const& cryostats);
+
+    // --- BEGIN Mapping status query ------------------------------------------
+    /// @name Mapping status query
+    /// @{
+
+    /// Returns the number of wires in the mapping.
+    index_type size() const { return fFirstWire.empty() ? 0U : fFirstWire.back(); }
+
+    /// Returns whether the mapping has no wires.
+    bool empty() const { return size() == 0U; }
+
+    /// Returns whether the mapping covers the specified plane.
+    bool hasPlane(PlaneID const& planeid) const { return fPlaneMapper.hasPlane(planeid); }
+
+    /// Returns whether the mapping covers the specified wire.
+    bool hasWire(WireID const& wireid) const { return wireid.Wire < nWires(wireid); }
+
+    /// Returns the number of wires in the plane (`0` if not covered).
+    unsigned int nWires(PlaneID const& planeid) const;
+
+    /// @}
+    // --- END Mapping status query --------------------------------------------
+
+    // --- BEGIN Mapping transformations ---------------------------------------
+    /// @name Mapping transformations
+    /// @{
+
+    /// Returns the index of the first wire of the plane (must be covered).
+    index_type firstIndex(PlaneID const& planeid) const
+    {
+      return fFirstWire[fPlaneMapper.index(planeid)];
+    }
+
+    /// Returns the flat index of the wire (must be covered, see `hasWire()`).
+    index_type index(WireID const& wireid) const { return firstIndex(wireid) + wireid.Wire; }
+
+    /// Returns the ID of the wire at `index` (invalid if out of range).
+    WireID ID(index_type index) const;
+
+    /// Returns the flat index of the wire (must be covered, see `hasWire()`).
+    index_type operator()(WireID const& wireid) const { return index(wireid); }
+
+    /// Returns the ID of the wire at `index` (invalid if out of range).
+    WireID operator()(index_type index) const { return ID(index); }
+
+    /// @}
+    // --- END Mapping transformations -----------------------------------------
+
+  private:
+    PlaneIDmapper<> fPlaneMapper; ///< Mapping of the planes, with all their slots.
+
+    /// Index of the first wire of each plane slot, plus the total at the end.
+    std::vector<index_type> fFirstWire;
+
+  }; // class WireIDmapper
+
+} // namespace geo
+
+#endif // LARCOREALG_GEOMETRY_WIREIDMAPPER_H
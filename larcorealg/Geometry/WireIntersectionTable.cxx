@@ -0,0 +1,134 @@
+/**
+ * @file   larcorealg/Geometry/WireIntersectionTable.cxx
+ * @brief  Precomputed intersections of the wires of each pair of planes.
+ * @see    larcorealg/Geometry/WireIntersectionTable.h
+ */
+
+// class header
+#include "larcorealg/Geometry/WireIntersectionTable.h"
+
+// LArSoft libraries
+#include "larcorealg/Geometry/CryostatGeo.h"
+#include "larcorealg/Geometry/PlaneGeo.h"
+#include "larcorealg/Geometry/TPCGeo.h"
+#include "larcorealg/Geometry/geo_vectors_utils.h" // geo::vect::dot()
+
+// C/C++ standard libraries
+#include <cmath>    // std::abs()
+#include <optional>
+
+namespace {
+
+  /// Reference wire, spacing and direction of a plane with uniform wires.
+  struct UniformPlane {
+    geo::Point_t firstCenter; ///< Center of the first wire.
+    geo::Vector_t pitch;      ///< Shift of the center from one wire to the next.
+    geo::Vector_t direction;  ///< Direction of all the wires.
+  };
+
+  /// Returns the uniform description of the plane, if its wires are uniform.
+  std::optional<UniformPlane> uniformPlane(geo::WireTable const& wires,
+                                           geo::PlaneID const& planeid,
+                                           double tolerance)
+  {
+    unsigned int const nWires = wires.nWires(planeid);
+    if (nWires == 0U) return std::nullopt;
+
+    auto const first = wires.firstWire(planeid);
+    auto const last = first + nWires - 1U;
+    UniformPlane plane{wires.center(first), {}, wires.direction(first)};
+    if (nWires > 1U)
+      plane.pitch = (wires.center(last) - plane.firstCenter) / static_cast<double>(nWires - 1U);
+
+    // all the wires must be where the model expects them, ends included
+    double const tolerance2 = tolerance * tolerance;
+    for (unsigned int w = 0; w < nWires; ++w) {
+      auto const i = first + w;
+      geo::Point_t const expected = plane.firstCenter + static_cast<double>(w) * plane.pitch;
+      if ((wires.center(i) - expected).Mag2() > tolerance2) return std::nullopt;
+      double const halfL2 = wires.halfLength(i) * wires.halfLength(i);
+      if ((wires.direction(i) - plane.direction).Mag2() * halfL2 > tolerance2) return std::nullopt;
+    }
+    return plane;
+  } // uniformPlane()
+
+  /// Returns the kernel for the two planes (no value if wires are parallel).
+  std::optional<geo::WireIntersectionKernel> makeKernel(UniformPlane const& plane1,
+                                                        UniformPlane const& plane2)
+  {
+    /*
+     * Same as geo::LineClosestPointAndOffsetsWithUnitVectors(): with the wire
+     * centers c1 = a1 + w1 p1, c2 = a2 + w2 p2 and directions d1, d2, the
+     * offsets are
+     *
+     *     t = (c2 - c1) . (d2 cos - d1) / (cos^2 - 1)
+     *     u = (c2 - c1) . (d2 - d1 cos) / (cos^2 - 1)
+     *
+     * (cos = d1 . d2), and the point is c1 + t d1: all are affine in (w1, w2).
+     */
+    using geo::vect::dot;
+    geo::Vector_t const& d1 = plane1.direction;
+    geo::Vector_t const& d2 = plane2.direction;
+    double const cosAngle = dot(d1, d2);
+    if (std::abs(std::abs(cosAngle) - 1.0) < 1e-10) return std::nullopt; // parallel
+
+    double const inv_den = 1.0 / (cosAngle * cosAngle - 1.0);
+    geo::Vector_t const ut = (cosAngle * d2 - d1) * inv_den;
+    geo::Vector_t const uu = (d2 - cosAngle * d1) * inv_den;
+    geo::Vector_t const dc0 = plane2.firstCenter - plane1.firstCenter;
+
+    geo::WireIntersectionKernel kernel;
+    kernel.offset1 = dot(dc0, ut);
+    kernel.offset1w1 = -dot(plane1.pitch, ut);
+    kernel.offset1w2 = dot(plane2.pitch, ut);
+    kernel.offset2 = dot(dc0, uu);
+    kernel.offset2w1 = -dot(plane1.pitch, uu);
+    kernel.offset2w2 = dot(plane2.pitch, uu);
+    kernel.origin = plane1.firstCenter + kernel.offset1 * d1;
+    kernel.step1 = plane1.pitch + kernel.offset1w1 * d1;
+    kernel.step2 = kernel.offset1w2 * d1;
+    return kernel;
+  } // makeKernel()
+
+} // local namespace
+
+namespace geo {
+
+  //----------------------------------------------------------------------------
+  WireIntersectionTable::WireIntersectionTable(WireTable const& wires,
+                                               CryostatList_t const& cryostats)
+  {
+    std::vector<TPCID> TPCs;
+    for (CryostatGeo const& cryo : cryostats)
+      for (TPCGeo const& tpc : cryo.IterateTPCs())
+        TPCs.push_back(tpc.ID());
+    fTPCmapper = CompactTPCIDmapper<>{TPCs};
+
+    fFirst.assign(1U, 0U);
+    for (CryostatGeo const& cryo : cryostats) {
+      for (TPCGeo const& tpc : cryo.IterateTPCs()) {
+        unsigned int const nPlanes = tpc.Nplanes();
+        fNPlanes.push_back(nPlanes);
+        fFirst.push_back(fFirst.back() + nPlanes * nPlanes);
+
+        std::vector<std::optional<UniformPlane>> planes;
+        for (PlaneGeo const& plane : tpc.IteratePlanes())
+          planes.push_back(uniformPlane(wires, plane.ID(), Tolerance));
+
+        for (unsigned int p1 = 0; p1 < nPlanes; ++p1) {
+          for (unsigned int p2 = 0; p2 < nPlanes; ++p2) {
+            std::optional<WireIntersectionKernel> kernel;
+            if ((p1 != p2) && planes[p1] && planes[p2])
+              kernel = makeKernel(*planes[p1], *planes[p2]);
+            fHasKernel.push_back(kernel.has_value());
+            fKernels.push_back(kernel.value_or(WireIntersectionKernel{}));
+          } // plane 2
+        }   // plane 1
+      }     // TPCs
+    }       // cryostats
+
+  } // WireIntersectionTable::WireIntersectionTable()
+
+  //----------------------------------------------------------------------------
+
+} // namespace geo
@@ -0,0 +1,132 @@
+/**
+ * @file   larcorealg/Geometry/WireIntersectionTable.h
+ * @brief  Precomputed intersections of the wires of each pair of planes.
+ * @see    larcorealg/Geometry/WireIntersectionTable.cxx
+ * @ingroup Geometry
+ */
+
+#ifndef LARCOREALG_GEOMETRY_WIREINTERSECTIONTABLE_H
+#define LARCOREALG_GEOMETRY_WIREINTERSECTIONTABLE_H
+
+// LArSoft libraries
+#include "larcorealg/Geometry/GeometryData.h"
+#include "larcorealg/Geometry/GeometryIDmapper.h" // geo::CompactTPCIDmapper
+#include "larcorealg/Geometry/LineClosestPoint.h" // geo::IntersectionPointAndOffsets
+#include "larcorealg/Geometry/WireTable.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <vector>
+
+namespace geo {
+
+  /**
+   * @brief Affine map from a pair of wire numbers to their intersection.
+   * @ingroup Geometry
+   *
+   * When all the wires of a plane are parallel and equally spaced, the point
+   * of a wire of one plane closest to a wire of another plane, and its offsets
+   * from the centers of the two wires, are affine functions of the two wire
+   * numbers. This object stores their coefficients, so that an intersection
+   * takes a handful of multiplications and additions.
+   *
+   * The result is the same as the one of
+   * `geo::LineClosestPointAndOffsetsWithUnitVectors()` on the two wires,
+   * within rounding (see `geo::GeometryCore::WireIDsIntersect()` for the
+   * expected size of the difference).
+   */
+  struct WireIntersectionKernel {
+    Point_t origin;   ///< Intersection point of the first wires of the planes.
+    Vector_t step1;   ///< Shift of the point per wire of the first plane.
+    Vector_t step2;   ///< Shift of the point per wire of the second plane.
+    double offset1;   ///< Offset on the first wire for the first wires.
+    double offset1w1; ///< Shift of the offset on first wire per wire of first plane.
+    double offset1w2; ///< Shift of the offset on first wire per wire of second plane.
+    double offset2;   ///< Offset on the second wire for the first wires.
+    double offset2w1; ///< Shift of the offset on second wire per wire of first plane.
+    double offset2w2; ///< Shift of the offset on second wire per wire of second plane.
+
+    /// Returns the intersection point and the offsets from the wire centers.
+    IntersectionPointAndOffsets<Point_t> operator()(unsigned int wire1, unsigned int wire2) const
+    {
+      double const w1 = wire1;
+      double const w2 = wire2;
+      return {origin + w1 * step1 + w2 * step2,
+              offset1 + w1 * offset1w1 + w2 * offset1w2,
+              offset2 + w1 * offset2w1 + w2 * offset2w2};
+    }
+  }; // struct WireIntersectionKernel
+
+  /**
+   * @brief Intersection kernels for each pair of planes in each TPC.
+   * @ingroup Geometry
+   * @see `geo::WireIntersectionKernel`, `geo::GeometryCore::WireIDsIntersect()`
+   *
+   * For each ordered pair of different planes in the same TPC, a
+   * `geo::WireIntersectionKernel` is precomputed from the wire table.
+   * Kernels are available only when both planes have equally spaced parallel
+   * wires (within a small tolerance), and the wires of the two planes are not
+   * parallel to each other: in all other cases `kernel()` returns `nullptr`,
+   * and the intersection must be computed wire by wire.
+   *
+   * The table must be rebuilt whenever the wire table is.
+   */
+  class WireIntersectionTable {
+  public:
+    /// Type of list of cryostats the table is built from.
+    using CryostatList_t = GeometryData_t::CryostatList_t;
+
+    /// Largest distance [cm] of a wire end from its position in the affine model.
+    static constexpr double Tolerance = 1e-6;
+
+    /// Constructor: an empty table, with no kernels.
+    WireIntersectionTable() = default;
+
+    /**
+     * @brief Constructor: computes the kernels of all the pairs of planes.
+     * @param wires the table of the wires of the cryostats
+     * @param cryostats the list of cryostats with the planes
+     */
+    WireIntersectionTable(WireTable const& wires, CryostatList_t const& cryostats);
+
+    /// Returns whether the table covers no TPC at all.
+    bool empty() const { return fKernels.empty(); }
+
+    /**
+     * @brief Returns the kernel for the pair of planes (`nullptr` if none).
+     * @param planeid1 ID of the first plane
+     * @param plane2 number of the second plane, in the same TPC
+     * @return a pointer to the kernel, or `nullptr` if not available
+     */
+    WireIntersectionKernel const* kernel(PlaneID const& planeid1,
+                                         PlaneID::PlaneID_t plane2) const;
+
+  private:
+    CompactTPCIDmapper<> fTPCmapper;              ///< Index of each TPC.
+    std::vector<std::size_t> fFirst;              ///< First kernel of each TPC, then the total.
+    std::vector<unsigned int> fNPlanes;           ///< Number of planes in each TPC.
+    std::vector<bool> fHasKernel;                 ///< Whether each kernel is available.
+    std::vector<WireIntersectionKernel> fKernels; ///< Kernels of all plane pairs.
+
+  }; // class WireIntersectionTable
+
+} // namespace geo
+
+//------------------------------------------------------------------------------
+inline geo::WireIntersectionKernel const* geo::WireIntersectionTable::kernel(
+  PlaneID const& planeid1,
+  PlaneID::PlaneID_t plane2) const
+{
+  if (!fTPCmapper.hasElement(planeid1.asTPCID())) return nullptr;
+  auto const iTPC = fTPCmapper.index(planeid1.asTPCID());
+  unsigned int const nPlanes = fNPlanes[iTPC];
+  if ((planeid1.Plane >= nPlanes) || (plane2 >= nPlanes)) return nullptr;
+  std::size_t const i = fFirst[iTPC] + planeid1.Plane * nPlanes + plane2;
+  return fHasKernel[i] ? &fKernels[i] : nullptr;
+} // geo::WireIntersectionTable::kernel()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_WIREINTERSECTIONTABLE_H
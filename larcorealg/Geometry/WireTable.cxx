@@ -0,0 +1,69 @@
+/**
+ * @file   larcorealg/Geometry/WireTable.cxx
+ * @brief  Detector-wide table of the wire geometry in structure-of-arrays form.
+ * @see    larcorealg/Geometry/WireTable.h
+ */
+
+// class header
+#include "larcorealg/Geometry/WireTable.h"
+
+// LArSoft libraries
+#include "larcorealg/Geometry/CryostatGeo.h"
+#include "larcorealg/Geometry/PlaneGeo.h"
+#include "larcorealg/Geometry/TPCGeo.h"
+#include "larcorealg/Geometry/WireGeo.h"
+
+namespace geo {
+
+  //----------------------------------------------------------------------------
+  WireTable::WireTable(CryostatList_t const& cryostats) : fMapper(cryostats)
+  {
+    std::size_t const n = fMapper.size();
+    for (auto* values : {&fCenterX,
+                         &fCenterY,
+                         &fCenterZ,
+                         &fStartX,
+                         &fStartY,
+                         &fStartZ,
+                         &fEndX,
+                         &fEndY,
+                         &fEndZ,
+                         &fDirX,
+                         &fDirY,
+                         &fDirZ,
+                         &fHalfL})
+      values->resize(n);
+
+    for (CryostatGeo const& cryo : cryostats) {
+      for (TPCGeo const& tpc : cryo.IterateTPCs()) {
+        for (PlaneGeo const& plane : tpc.IteratePlanes()) {
+          Index_t i = firstWire(plane.ID());
+          for (WireGeo const& wire : plane.IterateWires()) {
+            Point_t const center = wire.GetCenter();
+            Point_t const start = wire.GetStart();
+            Point_t const end = wire.GetEnd();
+            Vector_t const dir = wire.Direction();
+            fCenterX[i] = center.X();
+            fCenterY[i] = center.Y();
+            fCenterZ[i] = center.Z();
+            fStartX[i] = start.X();
+            fStartY[i] = start.Y();
+            fStartZ[i] = start.Z();
+            fEndX[i] = end.X();
+            fEndY[i] = end.Y();
+            fEndZ[i] = end.Z();
+            fDirX[i] = dir.X();
+            fDirY[i] = dir.Y();
+            fDirZ[i] = dir.Z();
+            fHalfL[i] = wire.HalfL();
+            ++i;
+          } // wires
+        }   // planes
+      }     // TPCs
+    }       // cryostats
+
+  } // WireTable::WireTable()
+
+  //----------------------------------------------------------------------------
+
+} // namespace geo
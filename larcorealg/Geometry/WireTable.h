@@ -0,0 +1,150 @@
+/**
+ * @file   larcorealg/Geometry/WireTable.h
+ * @brief  Detector-wide table of the wire geometry in structure-of-arrays form.
+ * @see    larcorealg/Geometry/WireTable.cxx
+ * @ingroup Geometry
+ */
+
+#ifndef LARCOREALG_GEOMETRY_WIRETABLE_H
+#define LARCOREALG_GEOMETRY_WIRETABLE_H
+
+// LArSoft libraries
+#include "larcorealg/Geometry/GeometryData.h"
+#include "larcorealg/Geometry/WireIDmapper.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"    // geo::WireID
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h" // geo::Point_t
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <vector>
+
+namespace geo {
+
+  /**
+   * @brief Table of center, ends, direction and length of all the detector wires.
+   * @ingroup Geometry
+   *
+   * Each coordinate of the center, of the ends and of the direction of the
+   * wires, and their half length, are stored in a separate contiguous array,
+   * with the wires of the whole detector in `geo::WireID` order (cryostat,
+   * TPC, plane, wire).
+   * `index()` converts a wire ID into the position of the wire in the arrays
+   * (see `geo::WireIDmapper`).
+   * Algorithms looping over many wires and needing only their position read a
+   * few compact arrays instead of full `geo::WireGeo` objects.
+   *
+   * All values are copied from `geo::WireGeo` (`GetCenter()`, `GetStart()`,
+   * `GetEnd()`, `Direction()` and `HalfL()`), so they are exactly the same.
+   *
+   * The table holds copies of the values: it must be rebuilt whenever the
+   * cryostat list is changed or sorted.
+   */
+  class WireTable {
+  public:
+    /// Type of list of cryostats the table is built from.
+    using CryostatList_t = GeometryData_t::CryostatList_t;
+
+    /// Type of index of a wire in the table.
+    using Index_t = WireIDmapper::index_type;
+
+    /// Constructor: an empty table, with no wires.
+    WireTable() = default;
+
+    /**
+     * @brief Constructor: records all the wires in the cryostats.
+     * @param cryostats the list of cryostats with the wires
+     *
+     * The cryostats must be already sorted (including all their content).
+     */
+    explicit WireTable(CryostatList_t const& cryostats);
+
+    /// Returns the number of wires in the table.
+    std::size_t size() const { return fHalfL.size(); }
+
+    /// Returns whether the table has no wires at all.
+    bool empty() const { return fHalfL.empty(); }
+
+    /// Returns whether the table covers the specified plane.
+    bool hasPlane(PlaneID const& planeid) const { return fMapper.hasPlane(planeid); }
+
+    /// Returns the number of wires in the plane (`0` if not in the table).
+    unsigned int nWires(PlaneID const& planeid) const { return fMapper.nWires(planeid); }
+
+    /// Returns whether the specified wire is in the table.
+    bool hasWire(WireID const& wireid) const { return fMapper.hasWire(wireid); }
+
+    /// Returns the index of the first wire of the plane (which must be present).
+    Index_t firstWire(PlaneID const& planeid) const { return fMapper.firstIndex(planeid); }
+
+    /// Returns the index of the wire (which must be present, see `hasWire()`).
+    Index_t index(WireID const& wireid) const { return fMapper.index(wireid); }
+
+    /// Returns the mapping between wire IDs and indices in the table.
+    WireIDmapper const& mapper() const { return fMapper; }
+
+    // --- BEGIN Wire information ----------------------------------------------
+    /// @name Wire information
+    /// @{
+
+    /// Returns the center of the wire with index `i` [cm]
+    Point_t center(Index_t i) const { return {fCenterX[i], fCenterY[i], fCenterZ[i]}; }
+
+    /// Returns the direction of the wire with index `i`, from start to end.
+    Vector_t direction(Index_t i) const { return {fDirX[i], fDirY[i], fDirZ[i]}; }
+
+    /// Returns half the length of the wire with index `i` [cm]
+    double halfLength(Index_t i) const { return fHalfL[i]; }
+
+    /// Returns the start of the wire with index `i` [cm]
+    Point_t start(Index_t i) const { return {fStartX[i], fStartY[i], fStartZ[i]}; }
+
+    /// Returns the end of the wire with index `i` [cm]
+    Point_t end(Index_t i) const { return {fEndX[i], fEndY[i], fEndZ[i]}; }
+
+    /// @}
+    // --- END Wire information ------------------------------------------------
+
+    // --- BEGIN Raw arrays ----------------------------------------------------
+    /// @name Raw arrays
+    /// Each array has one entry per wire, in index order.
+    /// @{
+
+    std::vector<double> const& centersX() const { return fCenterX; }
+    std::vector<double> const& centersY() const { return fCenterY; }
+    std::vector<double> const& centersZ() const { return fCenterZ; }
+    std::vector<double> const& startsX() const { return fStartX; }
+    std::vector<double> const& startsY() const { return fStartY; }
+    std::vector<double> const& startsZ() const { return fStartZ; }
+    std::vector<double> const& endsX() const { return fEndX; }
+    std::vector<double> const& endsY() const { return fEndY; }
+    std::vector<double> const& endsZ() const { return fEndZ; }
+    std::vector<double> const& directionsX() const { return fDirX; }
+    std::vector<double> const& directionsY() const { return fDirY; }
+    std::vector<double> const& directionsZ() const { return fDirZ; }
+    std::vector<double> const& halfLengths() const { return fHalfL; }
+
+    /// @}
+    // --- END Raw arrays ------------------------------------------------------
+
+  private:
+    WireIDmapper fMapper; ///< Mapping of wire IDs into table indices.
+
+    std::vector<double> fCenterX; ///< Center of the wires, _x_ coordinate [cm]
+    std::vector<double> fCenterY; ///< Center of the wires, _y_ coordinate [cm]
+    std::vector<double> fCenterZ; ///< Center of the wires, _z_ coordinate [cm]
+    std::vector<double> fStartX;  ///< Start of the wires, _x_ coordinate [cm]
+    std::vector<double> fStartY;  ///< Start of the wires, _y_ coordinate [cm]
+    std::vector<double> fStartZ;  ///< Start of the wires, _z_ coordinate [cm]
+    std::vector<double> fEndX;    ///< End of the wires, _x_ coordinate [cm]
+    std::vector<double> fEndY;    ///< End of the wires, _y_ coordinate [cm]
+    std::vector<double> fEndZ;    ///< End of the wires, _z_ coordinate [cm]
+    std::vector<double> fDirX;    ///< Direction of the wires, _x_ component.
+    std::vector<double> fDirY;    ///< Direction of the wires, _y_ component.
+    std::vector<double> fDirZ;    ///< Direction of the wires, _z_ component.
+    std::vector<double> fHalfL;   ///< Half length of the wires [cm]
+
+  }; // class WireTable
+
+} // namespace geo
+
+#endif // LARCOREALG_GEOMETRY_WIRETABLE_H
@@ -0,0 +1,41 @@
+/**
+ * @file   larcorealg/Geometry/details/cappedNearestWire.h
+ * @brief  Rounding of a wire coordinate into the nearest existing wire.
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_DETAILS_CAPPEDNEARESTWIRE_H
+#define LARCOREALG_GEOMETRY_DETAILS_CAPPEDNEARESTWIRE_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+
+namespace geo::details {
+
+  /**
+   * @brief Returns the number of the existing wire nearest to a wire coordinate.
+   * @param wireCoord the wire coordinate, in wire pitch units
+   * @param nWires the number of wires in the plane
+   * @param[out] outOfRange set to whether the nearest wire does not exist
+   * @return the number of the nearest wire, capped to the existing ones
+   *
+   * This is the rounding of `geo::PlaneGeo::NearestWireID()` and of
+   * `geo::GeometryCore::NearestWireNumbers()`: the wire is
+   * `int(0.5 + wireCoord)`. NaN coordinates are marked out of range.
+   * If the plane has no wire, all coordinates are out of range and wire `0`
+   * is returned.
+   * The function is simple enough to be vectorized in loops.
+   */
+  inline geo::WireID::WireID_t cappedNearestWire(double wireCoord, double nWires, bool& outOfRange)
+  {
+    double const rounded = 0.5 + wireCoord;
+    outOfRange = !((rounded > -1.0) && (rounded < nWires)); // NaN is out of range
+    double const lastWire = (nWires > 1.0) ? nWires - 1.0 : 0.0;
+    double const capped = (rounded > 0.0) ? ((rounded < nWires) ? rounded : lastWire) : 0.0;
+    return static_cast<geo::WireID::WireID_t>(capped);
+  } // cappedNearestWire()
+
+} // namespace geo::details
+
+#endif // LARCOREALG_GEOMETRY_DETAILS_CAPPEDNEARESTWIRE_H
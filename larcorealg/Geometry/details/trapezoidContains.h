@@ -0,0 +1,55 @@
+/**
+ * @file   larcorealg/Geometry/details/trapezoidContains.h
+ * @brief  Containment test of a point in an auxiliary detector volume.
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_DETAILS_TRAPEZOIDCONTAINS_H
+#define LARCOREALG_GEOMETRY_DETAILS_TRAPEZOIDCONTAINS_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h" // geo::Point_t
+
+namespace geo::details {
+
+  /**
+   * @brief Returns whether `point` is inside the trapezoid volume `vol`.
+   * @tparam Volume type of volume (`geo::AuxDetGeo`, `geo::AuxDetSensitiveGeo`)
+   * @param vol the volume to be tested
+   * @param point the location [cm]
+   * @param tolerance tolerance on the volume boundaries [cm]
+   * @return whether `point` is in `vol`, within `tolerance`
+   *
+   * The volume is a trapezoid in its local frame, extending along _z_ for
+   * `Length()`, along _y_ for twice `HalfHeight()`, and along _x_ with a half
+   * width changing linearly with _z_, from `HalfWidth1()` to `HalfWidth2()`.
+   * The tolerance is applied on each local axis.
+   * This is the test of `geo::ChannelMapAlg::FindAuxDet()` and
+   * `geo::ChannelMapAlg::FindSensitiveAuxDet()`.
+   */
+  template <typename Volume>
+  bool trapezoidContains(Volume const& vol, geo::Point_t const& point, double tolerance)
+  {
+    auto const localPoint = vol.toLocalCoords(point);
+
+    double const HalfCenterWidth = 0.5 * (vol.HalfWidth1() + vol.HalfWidth2());
+
+    return localPoint.Z() >= -(vol.Length() / 2 + tolerance) &&
+           localPoint.Z() <= (vol.Length() / 2 + tolerance) &&
+           localPoint.Y() >= -vol.HalfHeight() - tolerance &&
+           localPoint.Y() <= vol.HalfHeight() + tolerance &&
+           // if the volume is a box, then HalfSmallWidth = HalfWidth
+           localPoint.X() >= -HalfCenterWidth +
+                               localPoint.Z() * (HalfCenterWidth - vol.HalfWidth2()) /
+                                 (0.5 * vol.Length()) -
+                               tolerance &&
+           localPoint.X() <= HalfCenterWidth -
+                               localPoint.Z() * (HalfCenterWidth - vol.HalfWidth2()) /
+                                 (0.5 * vol.Length()) +
+                               tolerance;
+  } // trapezoidContains()
+
+} // namespace geo::details
+
+#endif // LARCOREALG_GEOMETRY_DETAILS_TRAPEZOIDCONTAINS_H
@@ -0,0 +1,260 @@
+/**
+ * @file   geoalgo_batch_distance_test.cxx
+ * @brief  Test and benchmark of the batch point-trajectory distance in GeoAlgo3D.
+ * @date   October 16, 2026
+ *
+ * Usage:
+ *
+ *     geoalgo_batch_distance_test [points] [trajectories] [trajectory points]
+ *
+ * Random points ("hits", by default 1000) are matched to random walk
+ * trajectories ("tracks", by default 100 with 50 points each) by finding
+ * the closest segment of each trajectory, and the closest trajectory.
+ * This is done with `geoalgo::GeoAlgo` one query at a time, and with the batch
+ * queries of `geoalgo::GeoAlgo3D` on `geoalgo::PackedTrajectories`: many points
+ * against one trajectory, and one point against many trajectories.
+ * The distances must be the same, and the segments (or trajectories) found
+ * must be at the same distance. The time taken by each is reported.
+ */
+
+// LArSoft libraries
+#include "larcorealg/GeoAlgo/GeoAlgo.h"
+#include "larcorealg/GeoAlgo/GeoAlgo3D.h"
+#include "larcorealg/GeoAlgo/GeoAlgoException.h"
+#include "larcorealg/GeoAlgo/GeoPackedTrajectories.h"
+#include "larcorealg/TestUtils/StopWatch.h"
+
+// C/C++ standard libraries
+#include <cmath>   // std::abs()
+#include <cstddef> // std::size_t
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------------
+//---  The tests
+//---
+
+namespace {
+
+  /// Returns whether the two distances are the same (within rounding).
+  bool sameDistance(double a, double b)
+  {
+    return std::abs(a - b) <= 1e-9 * (1.0 + std::abs(b));
+  }
+
+  /// Checks a distance and the index of the closest element it was found for.
+  /// The index may differ from the expected one only if equally close (ties).
+  unsigned int checkClosest(std::string const& what,
+                            double dist,
+                            int idx,
+                            double expectedDist,
+                            int expectedIdx,
+                            double distOfIdx)
+  {
+    unsigned int nErrors = 0;
+    if (!sameDistance(dist, expectedDist)) {
+      std::cerr << what << ": distance " << dist << ", expected " << expectedDist << std::endl;
+      ++nErrors;
+    }
+    if ((idx != expectedIdx) && !sameDistance(distOfIdx, expectedDist)) {
+      std::cerr << what << ": closest #" << idx << " (distance " << distOfIdx << "), expected #"
+                << expectedIdx << std::endl;
+      ++nErrors;
+    }
+    return nErrors;
+  } // checkClosest()
+
+  /// Prints the time per query of the two versions.
+  void printTimes(std::string const& what, std::size_t n, double dynamicTime, double batchTime)
+  {
+    std::cout << what << " (" << n << " queries): one at a time: " << (dynamicTime / n * 1e6)
+              << " us, batch: " << (batchTime / n * 1e6) << " us per query" << std::endl;
+  }
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+int main(int argc, char const** argv)
+{
+
+  //
+  // parameter parsing
+  //
+  std::size_t const nQueries = (argc > 1) ? std::stoul(argv[1]) : 1000U;
+  std::size_t const nTracks = (argc > 2) ? std::stoul(argv[2]) : 100U;
+  std::size_t const nTrackPoints = (argc > 3) ? std::stoul(argv[3]) : 50U;
+
+  //
+  // input preparation
+  //
+  std::mt19937 engine{12345U};
+  std::uniform_real_distribution<double> uniform{-100.0, 100.0};
+  auto const randomPoint = [&engine, &uniform]() {
+    double const x = uniform(engine), y = uniform(engine), z = uniform(engine);
+    return geoalgo::Point_t{x, y, z};
+  };
+
+  // random walks; the last trajectory is a single point (with no segment)
+  std::vector<geoalgo::Trajectory_t> tracks(nTracks);
+  for (auto& track : tracks) {
+    geoalgo::Point_t pos = randomPoint();
+    std::size_t const nPoints = (&track == &tracks.back()) ? 1U : nTrackPoints;
+    for (std::size_t i = 0; i < nPoints; ++i) {
+      pos += randomPoint() * 0.05;
+      track.push_back(pos);
+    }
+  }
+
+  std::vector<geoalgo::Point_t> points;
+  std::vector<geoalgo::Point3D_t> points3D;
+  for (std::size_t i = 0; i < nQueries; ++i) {
+    points.push_back(randomPoint());
+    points3D.emplace_back(points.back());
+  }
+  // a point exactly on a trajectory point, shared by two segments
+  if (nTrackPoints > 2) {
+    points.front() = tracks.front()[1];
+    points3D.front() = geoalgo::Point3D_t(points.front());
+  }
+
+  geoalgo::PackedTrajectories const packed{tracks};
+
+  //
+  // run the test
+  //
+  geoalgo::GeoAlgo const algo;
+  geoalgo::GeoAlgo3D const algo3D;
+  geoalgo::GeoAlgo3D::BatchWorkspace work; // reused by all the batch queries
+  unsigned int nErrors = 0;
+
+  if ((packed.NTrajectories() != nTracks) || (packed.NPoints(0) != tracks[0].size())) {
+    std::cerr << "Packed " << packed.NTrajectories() << " trajectories, expected " << nTracks
+              << std::endl;
+    ++nErrors;
+  }
+
+  // a trajectory with a point not in 3D is rejected, and nothing of it is added
+  {
+    geoalgo::PackedTrajectories rejecting{std::vector<geoalgo::Trajectory_t>{tracks.front()}};
+    geoalgo::Trajectory_t bad = tracks.front();
+    bad.back() = geoalgo::Point_t(2);
+    bool thrown = false;
+    try {
+      rejecting.Add(bad);
+    }
+    catch (geoalgo::GeoAlgoException const&) {
+      thrown = true;
+    }
+    if (!thrown || (rejecting.NTrajectories() != 1) ||
+        (rejecting.NPoints() != tracks.front().size())) {
+      std::cerr << "Trajectory not in 3D " << (thrown ? "" : "not ") << "rejected, "
+                << rejecting.NTrajectories() << " trajectories with " << rejecting.NPoints()
+                << " points left" << std::endl;
+      ++nErrors;
+    }
+  }
+
+  //
+  // many points against one trajectory
+  //
+  {
+    std::vector<double> dynamicDists(nQueries * nTracks);
+    std::vector<int> dynamicIdx(nQueries * nTracks, -1);
+    std::vector<std::vector<double>> batchDists(nTracks);
+    std::vector<std::vector<int>> batchIdx(nTracks);
+
+    testing::StopWatch<> timer;
+    for (std::size_t t = 0; t < nTracks; ++t) {
+      for (std::size_t i = 0; i < nQueries; ++i) {
+        std::size_t const k = t * nQueries + i;
+        dynamicDists[k] = algo.SqDist(points[i], tracks[t]);
+        if (tracks[t].size() > 1) algo.ClosestPt(points[i], tracks[t], dynamicIdx[k]);
+      }
+    }
+    double const dynamicTime = timer.elapsed();
+    timer.restart();
+    for (std::size_t t = 0; t < nTracks; ++t)
+      algo3D.SqDist(points3D, packed, t, batchDists[t], batchIdx[t], work);
+    double const batchTime = timer.elapsed();
+
+    for (std::size_t t = 0; t < nTracks; ++t) {
+      if ((batchDists[t].size() != nQueries) || (batchIdx[t].size() != nQueries)) {
+        std::cerr << "Trajectory #" << t << ": " << batchDists[t].size() << " distances and "
+                  << batchIdx[t].size() << " segments, " << nQueries << " expected" << std::endl;
+        ++nErrors;
+        continue;
+      }
+      for (std::size_t i = 0; i < nQueries; ++i) {
+        std::size_t const k = t * nQueries + i;
+        double const distOfIdx =
+          (batchIdx[t][i] < 0) ? geoalgo::kINVALID_DOUBLE :
+                                 algo3D.SqDist(points3D[i], packed.Segment(t, batchIdx[t][i]));
+        nErrors += checkClosest("Point #" + std::to_string(i) + " to trajectory #" +
+                                  std::to_string(t),
+                                batchDists[t][i],
+                                batchIdx[t][i],
+                                dynamicDists[k],
+                                dynamicIdx[k],
+                                distOfIdx);
+      }
+    }
+    printTimes("Points-trajectory distance", nQueries * nTracks, dynamicTime, batchTime);
+  }
+
+  //
+  // one point against many trajectories
+  //
+  {
+    std::vector<double> dynamicDists(nQueries), batchDists(nQueries);
+    std::vector<int> dynamicIdx(nQueries, -1), batchIdx(nQueries, -1), batchSegIdx(nQueries);
+
+    testing::StopWatch<> timer;
+    for (std::size_t i = 0; i < nQueries; ++i)
+      dynamicDists[i] = algo.SqDist(points[i], tracks, dynamicIdx[i]);
+    double const dynamicTime = timer.elapsed();
+    timer.restart();
+    for (std::size_t i = 0; i < nQueries; ++i)
+      batchDists[i] = algo3D.SqDist(points3D[i], packed, batchIdx[i], batchSegIdx[i], work);
+    double const batchTime = timer.elapsed();
+
+    std::vector<double> trackDists;
+    std::vector<int> trackSegIdx;
+    for (std::size_t i = 0; i < nQueries; ++i) {
+      std::string const what = "Point #" + std::to_string(i) + " to closest trajectory";
+      double const distOfIdx = algo.SqDist(points[i], tracks[batchIdx[i]]);
+      nErrors +=
+        checkClosest(what, batchDists[i], batchIdx[i], dynamicDists[i], dynamicIdx[i], distOfIdx);
+      double const distOfSeg =
+        algo3D.SqDist(points3D[i], packed.Segment(batchIdx[i], batchSegIdx[i]));
+      if (!sameDistance(distOfSeg, batchDists[i])) {
+        std::cerr << what << ": segment #" << batchSegIdx[i] << " at distance " << distOfSeg
+                  << ", expected " << batchDists[i] << std::endl;
+        ++nErrors;
+      }
+
+      // the distances from each of the trajectories
+      algo3D.SqDist(points3D[i], packed, trackDists, trackSegIdx, work);
+      if (trackDists.size() != nTracks) {
+        std::cerr << "Point #" << i << ": " << trackDists.size() << " trajectory distances, "
+                  << nTracks << " expected" << std::endl;
+        ++nErrors;
+        continue;
+      }
+      for (std::size_t t = 0; t < nTracks; ++t) {
+        double const expected = algo.SqDist(points[i], tracks[t]);
+        if (sameDistance(trackDists[t], expected)) continue;
+        std::cerr << "Point #" << i << " to trajectory #" << t << ": distance " << trackDists[t]
+                  << ", expected " << expected << std::endl;
+        ++nErrors;
+      }
+    }
+    printTimes("Point-closest trajectory distance", nQueries, dynamicTime, batchTime);
+  }
+
+  // and finally we cross fingers
+  if (nErrors > 0) { std::cerr << nErrors << " errors detected!" << std::endl; }
+
+  return nErrors;
+} // main()
@@ -0,0 +1,230 @@
+/**
+ * @file   geoalgo_fixed_size_benchmark_test.cxx
+ * @brief  Benchmark of the fixed-size 3D GeoAlgo against the dynamic one.
+ * @date   October 16, 2026
+ *
+ * Usage:
+ *
+ *     geoalgo_fixed_size_benchmark_test [queries] [points]
+ *
+ * Random trajectories (by default, with 100 points) are queried for the
+ * distance from random points, segments, half lines and other trajectories
+ * (by default, 1000 queries each) with `geoalgo::GeoAlgo` on the dynamic
+ * objects and with `geoalgo::GeoAlgo3D` on the fixed-size ones.
+ * The results must be the same. The time and the number of heap allocations
+ * per query of each are reported; the fixed-size algorithms must not
+ * allocate at all.
+ */
+
+// LArSoft libraries
+#include "larcorealg/GeoAlgo/GeoAlgo.h"
+#include "larcorealg/GeoAlgo/GeoAlgo3D.h"
+#include "larcorealg/TestUtils/StopWatch.h"
+
+// C/C++ standard libraries
+#include <atomic>
+#include <cmath>   // std::abs()
+#include <cstddef> // std::size_t
+#include <cstdlib> // std::malloc(), std::free()
+#include <iostream>
+#include <new> // std::bad_alloc
+#include <random>
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------------
+//---  allocation counting
+//---
+
+namespace {
+  std::atomic<std::size_t> nAllocations{0}; ///< Number of calls to `operator new`.
+}
+
+void* operator new(std::size_t size)
+{
+  ++nAllocations;
+  if (void* p = std::malloc(size ? size : 1)) return p;
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* p) noexcept
+{
+  std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+  std::free(p);
+}
+
+//------------------------------------------------------------------------------
+//---  The tests
+//---
+
+namespace {
+
+  /// Queries of the same kind, on dynamic and fixed-size objects.
+  struct QueryResult {
+    double time = 0.0;           ///< Total time [s].
+    std::size_t allocations = 0; ///< Total number of heap allocations.
+  };
+
+  /// Runs `query` on each index up to `n`, timing it and counting allocations.
+  template <typename Query>
+  QueryResult runQueries(std::size_t n, std::vector<double>& results, Query query)
+  {
+    results.assign(n, 0.0); // allocate before counting
+    std::size_t const nAllocStart = nAllocations;
+    testing::StopWatch<> timer;
+    for (std::size_t i = 0; i < n; ++i)
+      results[i] = query(i);
+    return {timer.elapsed(), nAllocations - nAllocStart};
+  } // runQueries()
+
+  /// Compares the results and prints the performance of the two versions.
+  unsigned int compareQueries(std::string const& what,
+                              std::vector<double> const& dynamicResults,
+                              QueryResult const& dynamic,
+                              std::vector<double> const& fixedResults,
+                              QueryResult const& fixed)
+  {
+    unsigned int nErrors = 0;
+    for (std::size_t i = 0; i < dynamicResults.size(); ++i) {
+      double const expected = dynamicResults[i];
+      if (std::abs(fixedResults[i] - expected) <= 1e-9 * (1.0 + std::abs(expected))) continue;
+      std::cerr << what << " query #" << i << ": " << fixedResults[i] << ", expected " << expected
+                << std::endl;
+      ++nErrors;
+    }
+    if (fixed.allocations > 0) {
+      std::cerr << what << ": " << fixed.allocations << " heap allocations in fixed-size queries"
+                << std::endl;
+      ++nErrors;
+    }
+
+    double const n = dynamicResults.size();
+    std::cout << what << " (" << dynamicResults.size()
+              << " queries): dynamic: " << (dynamic.time / n * 1e6) << " us and "
+              << (dynamic.allocations / n) << " allocations per query; fixed-size: "
+              << (fixed.time / n * 1e6) << " us and " << (fixed.allocations / n)
+              << " allocations per query" << std::endl;
+    return nErrors;
+  } // compareQueries()
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+int main(int argc, char const** argv)
+{
+
+  //
+  // parameter parsing
+  //
+  std::size_t const nQueries = (argc > 1) ? std::stoul(argv[1]) : 1000U;
+  std::size_t const nPoints = (argc > 2) ? std::stoul(argv[2]) : 100U;
+
+  //
+  // input preparation
+  //
+  std::mt19937 engine{12345U};
+  std::uniform_real_distribution<double> uniform{-100.0, 100.0};
+  auto const randomPoint = [&engine, &uniform]() {
+    double const x = uniform(engine), y = uniform(engine), z = uniform(engine);
+    return geoalgo::Point_t{x, y, z};
+  };
+
+  // a random walk
+  geoalgo::Trajectory_t trajectory;
+  geoalgo::Trajectory_t other;
+  geoalgo::Point_t pos{0.0, 0.0, 0.0};
+  for (std::size_t i = 0; i < nPoints; ++i) {
+    pos += randomPoint() * 0.1;
+    trajectory.push_back(pos);
+    other.push_back(randomPoint());
+  }
+
+  std::vector<geoalgo::Point_t> points;
+  std::vector<geoalgo::LineSegment_t> segments;
+  std::vector<geoalgo::HalfLine_t> halfLines;
+  for (std::size_t i = 0; i < nQueries; ++i) {
+    points.push_back(randomPoint());
+    segments.emplace_back(randomPoint(), randomPoint());
+    halfLines.emplace_back(randomPoint(), randomPoint());
+  }
+
+  geoalgo::Trajectory3D_t const trajectory3D = geoalgo::ToTrajectory3D(trajectory);
+  geoalgo::Trajectory3D_t const other3D = geoalgo::ToTrajectory3D(other);
+  std::vector<geoalgo::Point3D_t> points3D;
+  std::vector<geoalgo::LineSegment3D> segments3D;
+  std::vector<geoalgo::HalfLine3D> halfLines3D;
+  for (std::size_t i = 0; i < nQueries; ++i) {
+    points3D.emplace_back(points[i]);
+    segments3D.emplace_back(segments[i]);
+    halfLines3D.emplace_back(halfLines[i]);
+  }
+
+  //
+  // run the test
+  //
+  geoalgo::GeoAlgo const algo;
+  geoalgo::GeoAlgo3D const algo3D;
+  std::vector<double> dynamicResults, fixedResults;
+  unsigned int nErrors = 0;
+
+  {
+    auto const dynamic = runQueries(nQueries, dynamicResults, [&](std::size_t i) {
+      return algo.SqDist(points[i], trajectory);
+    });
+    auto const fixed = runQueries(nQueries, fixedResults, [&](std::size_t i) {
+      return algo3D.SqDist(points3D[i], trajectory3D);
+    });
+    nErrors +=
+      compareQueries("Point-trajectory distance", dynamicResults, dynamic, fixedResults, fixed);
+  }
+  {
+    auto const dynamic = runQueries(nQueries, dynamicResults, [&](std::size_t i) {
+      return algo.ClosestPt(points[i], trajectory)[1];
+    });
+    auto const fixed = runQueries(nQueries, fixedResults, [&](std::size_t i) {
+      return algo3D.ClosestPt(points3D[i], trajectory3D)[1];
+    });
+    nErrors += compareQueries(
+      "Point-trajectory closest point", dynamicResults, dynamic, fixedResults, fixed);
+  }
+  {
+    auto const dynamic = runQueries(nQueries, dynamicResults, [&](std::size_t i) {
+      return algo.SqDist(segments[i], trajectory);
+    });
+    auto const fixed = runQueries(nQueries, fixedResults, [&](std::size_t i) {
+      return algo3D.SqDist(segments3D[i], trajectory3D);
+    });
+    nErrors +=
+      compareQueries("Segment-trajectory distance", dynamicResults, dynamic, fixedResults, fixed);
+  }
+  {
+    auto const dynamic = runQueries(nQueries, dynamicResults, [&](std::size_t i) {
+      return algo.SqDist(halfLines[i], trajectory);
+    });
+    auto const fixed = runQueries(nQueries, fixedResults, [&](std::size_t i) {
+      return algo3D.SqDist(halfLines3D[i], trajectory3D);
+    });
+    nErrors += compareQueries(
+      "Half line-trajectory distance", dynamicResults, dynamic, fixedResults, fixed);
+  }
+  {
+    std::size_t const nTrajQueries = 10U;
+    auto const dynamic = runQueries(nTrajQueries, dynamicResults, [&](std::size_t) {
+      return algo.SqDist(trajectory, other);
+    });
+    auto const fixed = runQueries(nTrajQueries, fixedResults, [&](std::size_t) {
+      return algo3D.SqDist(trajectory3D, other3D);
+    });
+    nErrors += compareQueries(
+      "Trajectory-trajectory distance", dynamicResults, dynamic, fixedResults, fixed);
+  }
+
+  // and finally we cross fingers
+  if (nErrors > 0) { std::cerr << nErrors << " errors detected!" << std::endl; }
+
+  return nErrors;
+} // main()
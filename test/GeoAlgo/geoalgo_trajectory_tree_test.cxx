@@ -0,0 +1,266 @@
+/**
+ * @file   geoalgo_trajectory_tree_test.cxx
+ * @brief  Test and benchmark of the trajectory segment tree of GeoAlgo.
+ * @date   October 16, 2026
+ *
+ * Usage:
+ *
+ *     geoalgo_trajectory_tree_test [queries] [trajectories] [trajectory points]
+ *
+ * Random walk trajectories ("tracks", by default 500 with 20 points each)
+ * are put in a `geoalgo::TrajectoryTree`, which is queried for the segment
+ * closest to random points and to random short segments, and for the segments
+ * within a radius from random points (by default, 200 queries each).
+ * The same queries are run on all the trajectories with `geoalgo::GeoAlgo`
+ * (and with `geoalgo::GeoAlgo3D` for the radius search): the results must be
+ * the same. The time taken by each is reported.
+ */
+
+// LArSoft libraries
+#include "larcorealg/GeoAlgo/GeoAlgo.h"
+#include "larcorealg/GeoAlgo/GeoAlgo3D.h"
+#include "larcorealg/GeoAlgo/GeoTrajectoryTree.h"
+#include "larcorealg/TestUtils/StopWatch.h"
+
+// C/C++ standard libraries
+#include <cmath>   // std::abs()
+#include <cstddef> // std::size_t
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------------
+//---  The tests
+//---
+
+namespace {
+
+  /// Returns whether the two distances are the same (within rounding).
+  bool sameDistance(double a, double b)
+  {
+    return std::abs(a - b) <= 1e-9 * (1.0 + std::abs(b));
+  }
+
+  /// Checks a distance and the trajectory and segment it was found for.
+  unsigned int checkClosest(std::string const& what,
+                            double dist,
+                            int trackIdx,
+                            int segIdx,
+                            double expectedDist,
+                            int expectedTrackIdx,
+                            int expectedSegIdx)
+  {
+    if (sameDistance(dist, expectedDist) && (trackIdx == expectedTrackIdx) &&
+        (segIdx == expectedSegIdx))
+      return 0;
+    std::cerr << what << ": distance " << dist << " from segment #" << segIdx << " of trajectory #"
+              << trackIdx << ", expected " << expectedDist << " from segment #" << expectedSegIdx
+              << " of trajectory #" << expectedTrackIdx << std::endl;
+    return 1;
+  } // checkClosest()
+
+  /// Prints the time per query of the two versions.
+  void printTimes(std::string const& what, std::size_t n, double bruteTime, double treeTime)
+  {
+    std::cout << what << " (" << n << " queries): all segments: " << (bruteTime / n * 1e6)
+              << " us, tree: " << (treeTime / n * 1e6) << " us per query" << std::endl;
+  }
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+int main(int argc, char const** argv)
+{
+
+  //
+  // parameter parsing
+  //
+  std::size_t const nQueries = (argc > 1) ? std::stoul(argv[1]) : 200U;
+  std::size_t const nTracks = (argc > 2) ? std::stoul(argv[2]) : 500U;
+  std::size_t const nTrackPoints = (argc > 3) ? std::stoul(argv[3]) : 20U;
+
+  //
+  // input preparation
+  //
+  std::mt19937 engine{12345U};
+  std::uniform_real_distribution<double> uniform{-100.0, 100.0};
+  auto const randomPoint = [&engine, &uniform]() {
+    double const x = uniform(engine), y = uniform(engine), z = uniform(engine);
+    return geoalgo::Point_t{x, y, z};
+  };
+
+  // random walks; the last trajectory is a single point (with no segment)
+  std::vector<geoalgo::Trajectory_t> tracks(nTracks);
+  for (auto& track : tracks) {
+    geoalgo::Point_t pos = randomPoint();
+    std::size_t const nPoints = (&track == &tracks.back()) ? 1U : nTrackPoints;
+    for (std::size_t i = 0; i < nPoints; ++i) {
+      pos += randomPoint() * 0.05;
+      track.push_back(pos);
+    }
+  }
+  std::vector<geoalgo::Trajectory3D_t> tracks3D;
+  for (auto const& track : tracks)
+    tracks3D.push_back(geoalgo::ToTrajectory3D(track));
+
+  std::vector<geoalgo::Point_t> points;
+  std::vector<geoalgo::LineSegment_t> segments;
+  for (std::size_t i = 0; i < nQueries; ++i) {
+    points.push_back(randomPoint());
+    segments.emplace_back(points.back(), points.back() + randomPoint() * 0.1);
+  }
+  // a point exactly on a trajectory point, shared by two segments
+  if (nTrackPoints > 2) points.front() = tracks.front()[1];
+
+  testing::StopWatch<> timer;
+  geoalgo::TrajectoryTree const tree{tracks};
+  std::cout << "Tree of " << tree.NSegments() << " segments of " << tree.NTrajectories()
+            << " trajectories built in " << (timer.elapsed() * 1e3) << " ms" << std::endl;
+
+  //
+  // run the test
+  //
+  geoalgo::GeoAlgo const algo;
+  geoalgo::GeoAlgo3D const algo3D;
+  unsigned int nErrors = 0;
+
+  if (tree.NTrajectories() != nTracks) {
+    std::cerr << "Tree has " << tree.NTrajectories() << " trajectories, expected " << nTracks
+              << std::endl;
+    ++nErrors;
+  }
+
+  //
+  // closest segment to a point
+  //
+  {
+    std::vector<double> bruteDists(nQueries), treeDists(nQueries);
+    std::vector<int> bruteTrackIdx(nQueries, -1), bruteSegIdx(nQueries, -1);
+    std::vector<int> treeTrackIdx(nQueries, -1), treeSegIdx(nQueries, -1);
+
+    timer.restart();
+    for (std::size_t i = 0; i < nQueries; ++i) {
+      bruteDists[i] = algo.SqDist(points[i], tracks, bruteTrackIdx[i]);
+      algo.ClosestPt(points[i], tracks[bruteTrackIdx[i]], bruteSegIdx[i]);
+    }
+    double const bruteTime = timer.elapsed();
+    timer.restart();
+    for (std::size_t i = 0; i < nQueries; ++i) {
+      treeDists[i] = tree.SqDist(geoalgo::Point3D_t(points[i]), treeTrackIdx[i], treeSegIdx[i]);
+    }
+    double const treeTime = timer.elapsed();
+
+    for (std::size_t i = 0; i < nQueries; ++i) {
+      nErrors += checkClosest("Point #" + std::to_string(i),
+                              treeDists[i],
+                              treeTrackIdx[i],
+                              treeSegIdx[i],
+                              bruteDists[i],
+                              bruteTrackIdx[i],
+                              bruteSegIdx[i]);
+      int trackIdx = -1, segIdx = -1;
+      geoalgo::Point3D_t const closest =
+        tree.ClosestPt(geoalgo::Point3D_t(points[i]), trackIdx, segIdx);
+      geoalgo::Point_t const expected = algo.ClosestPt(points[i], tracks[bruteTrackIdx[i]]);
+      if (!sameDistance(closest.Dist(geoalgo::Point3D_t(expected)), 0.0)) {
+        std::cerr << "Point #" << i << ": closest point " << closest << ", expected " << expected
+                  << std::endl;
+        ++nErrors;
+      }
+    }
+    printTimes("Point-closest segment distance", nQueries, bruteTime, treeTime);
+  }
+
+  //
+  // closest segment to a segment
+  //
+  {
+    std::vector<double> bruteDists(nQueries), treeDists(nQueries);
+    std::vector<int> bruteTrackIdx(nQueries, -1), bruteSegIdx(nQueries, -1);
+    std::vector<int> treeTrackIdx(nQueries, -1), treeSegIdx(nQueries, -1);
+    std::vector<geoalgo::Point_t> bruteC1(nQueries);
+    std::vector<geoalgo::Point3D_t> treeC1(nQueries);
+
+    timer.restart();
+    for (std::size_t i = 0; i < nQueries; ++i) {
+      geoalgo::Point_t c2;
+      bruteDists[i] = algo.SqDist(segments[i], tracks, bruteC1[i], c2, bruteTrackIdx[i]);
+    }
+    double const bruteTime = timer.elapsed();
+    timer.restart();
+    for (std::size_t i = 0; i < nQueries; ++i) {
+      geoalgo::Point3D_t c2;
+      treeDists[i] = tree.SqDist(
+        geoalgo::LineSegment3D(segments[i]), treeC1[i], c2, treeTrackIdx[i], treeSegIdx[i]);
+    }
+    double const treeTime = timer.elapsed();
+
+    for (std::size_t i = 0; i < nQueries; ++i) {
+      // the closest segment of the closest trajectory (not reported by GeoAlgo)
+      auto const& track = tracks[bruteTrackIdx[i]];
+      double minDist = geoalgo::kMAX_DOUBLE;
+      for (std::size_t l = 0; l + 1 < track.size(); ++l) {
+        geoalgo::LineSegment_t const seg{track[l], track[l + 1]};
+        double const dist = algo.SqDist(seg, segments[i]);
+        if (dist >= minDist) continue;
+        minDist = dist;
+        bruteSegIdx[i] = l;
+      }
+      nErrors += checkClosest("Segment #" + std::to_string(i),
+                              treeDists[i],
+                              treeTrackIdx[i],
+                              treeSegIdx[i],
+                              bruteDists[i],
+                              bruteTrackIdx[i],
+                              bruteSegIdx[i]);
+      if (!sameDistance(treeC1[i].Dist(geoalgo::Point3D_t(bruteC1[i])), 0.0)) {
+        std::cerr << "Segment #" << i << ": closest point " << treeC1[i] << ", expected "
+                  << bruteC1[i] << std::endl;
+        ++nErrors;
+      }
+    }
+    printTimes("Segment-closest segment distance", nQueries, bruteTime, treeTime);
+  }
+
+  //
+  // segments within a radius from a point
+  //
+  {
+    double const radius = 5.0;
+    std::vector<std::vector<geoalgo::TrajectoryTree::SegmentID_t>> bruteIDs(nQueries);
+    std::vector<std::vector<geoalgo::TrajectoryTree::SegmentID_t>> treeIDs(nQueries);
+
+    timer.restart();
+    for (std::size_t i = 0; i < nQueries; ++i) {
+      geoalgo::Point3D_t const pt{points[i]};
+      for (std::size_t t = 0; t < tracks3D.size(); ++t) {
+        for (std::size_t l = 0; l + 1 < tracks3D[t].size(); ++l) {
+          geoalgo::LineSegment3D const seg{tracks3D[t][l], tracks3D[t][l + 1]};
+          if (algo3D.SqDist(pt, seg) <= radius * radius) bruteIDs[i].emplace_back(t, l);
+        }
+      }
+    }
+    double const bruteTime = timer.elapsed();
+    timer.restart();
+    for (std::size_t i = 0; i < nQueries; ++i)
+      tree.WithinRadius(geoalgo::Point3D_t(points[i]), radius, treeIDs[i]);
+    double const treeTime = timer.elapsed();
+
+    std::size_t nFound = 0;
+    for (std::size_t i = 0; i < nQueries; ++i) {
+      nFound += bruteIDs[i].size();
+      if (treeIDs[i] == bruteIDs[i]) continue;
+      std::cerr << "Point #" << i << ": " << treeIDs[i].size() << " segments within " << radius
+                << ", expected " << bruteIDs[i].size() << std::endl;
+      ++nErrors;
+    }
+    std::cout << nFound << " segments found within " << radius << std::endl;
+    printTimes("Segments within radius", nQueries, bruteTime, treeTime);
+  }
+
+  // and finally we cross fingers
+  if (nErrors > 0) { std::cerr << nErrors << " errors detected!" << std::endl; }
+
+  return nErrors;
+} // main()
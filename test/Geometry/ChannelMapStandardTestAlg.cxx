@@ -10,6 +10,7 @@
 // LArSoft libraries
 #include "ChannelMapStandardTestAlg.h"
 #include "larcorealg/Geometry/GeometryCore.h"
+#include "larcorealg/TestUtils/StopWatch.h"
 #include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
 #include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
 
@@ -20,6 +21,7 @@
 #include <boost/test/unit_test.hpp>
 
 // C/C++ standard libraries
+#include <chrono>
 #include <string>
 #include <vector>
 
@@ -40,6 +42,55 @@ namespace {
     BOOST_TEST(planeID.Plane == ropID.ROP);
   } // CheckMatchingPlaneLevelIDs()
 
+  /**
+   * @brief Signal type algorithm used before the per-plane lookup table.
+   *
+   * This is a copy of the old `ChannelMapStandardAlg::SignalTypeForChannelImpl()`
+   * (including the assumption of a single cryostat and of TPCs with the same
+   * number of channels), kept only as a reference for timing.
+   */
+  class LegacySignalTypeAlg {
+  public:
+    explicit LegacySignalTypeAlg(geo::GeometryCore const& geom) : fNchannels(geom.Nchannels())
+    {
+      for (geo::TPCID const& tpcid : geom.Iterate<geo::TPCID>(geo::CryostatID{0})) {
+        std::vector<raw::ChannelID_t> thisPlane, nextPlane;
+        for (geo::PlaneID const& planeid : geom.Iterate<geo::PlaneID>(tpcid)) {
+          readout::ROPID const ropid = geom.WirePlaneToROP(planeid);
+          thisPlane.push_back(geom.FirstChannelInROP(ropid));
+          nextPlane.push_back(thisPlane.back() + geom.Nchannels(ropid));
+        }
+        fFirstChannelInThisPlane.push_back(std::move(thisPlane));
+        fFirstChannelInNextPlane.push_back(std::move(nextPlane));
+      } // for TPCs
+    }
+
+    geo::SigType_t operator()(raw::ChannelID_t const channel) const
+    {
+      unsigned int nChanPerTPC = fNchannels / fFirstChannelInThisPlane.size();
+      unsigned int tpc = channel / nChanPerTPC;
+      // the original would go out of range here with more than one cryostat
+      if (tpc >= fFirstChannelInThisPlane.size()) return geo::kMysteryType;
+      unsigned int PlanesThisTPC = fFirstChannelInThisPlane[tpc].size();
+
+      geo::SigType_t sigt = geo::kMysteryType;
+      if ((channel >= fFirstChannelInThisPlane[tpc][0]) &&
+          (channel < fFirstChannelInNextPlane[tpc][PlanesThisTPC - 2])) {
+        sigt = geo::kInduction;
+      }
+      else if ((channel >= fFirstChannelInThisPlane[tpc][PlanesThisTPC - 1]) &&
+               (channel < fFirstChannelInNextPlane[tpc][PlanesThisTPC - 1])) {
+        sigt = geo::kCollection;
+      }
+      return sigt;
+    }
+
+  private:
+    unsigned int fNchannels;
+    std::vector<std::vector<raw::ChannelID_t>> fFirstChannelInThisPlane;
+    std::vector<std::vector<raw::ChannelID_t>> fFirstChannelInNextPlane;
+  }; // class LegacySignalTypeAlg
+
 } // local namespace
 
 //-----------------------------------------------------------------------------
@@ -50,6 +101,7 @@ unsigned int geo::ChannelMapStandardTestAlg::Run()
   TPCsetMappingTest();
   ROPMappingTest();
   ChannelMappingTest();
+  SignalTypeTest();
 
   return 0;
 } // ChannelMapStandardTestAlg::Run()
@@ -189,6 +241,10 @@ void geo::ChannelMapStandardTestAlg::ROPMappingTest() const
    *
    *     raw::ChannelID_t FirstChannelInROP(readout::ROPID const& ropid) const
    *
+   *     std::size_t ChannelToWireIDs
+   *       (raw::ChannelID_t channel, geo::WireID* wires, std::size_t maxWires)
+   *       const
+   *
    *     geo::PlaneID FirstWirePlaneInROP(readout::ROPID const& ropid) const
    *       can't do (not exposed!)
    *
@@ -270,6 +326,12 @@ void geo::ChannelMapStandardTestAlg::ROPMappingTest() const
       BOOST_TEST(ChannelWires.size() == 1U);
       BOOST_TEST(ChannelWires.front() == planeID);
 
+      // does the non-allocating interface give the same answer?
+      geo::WireID ChannelWire;
+      BOOST_TEST(geom->ChannelToWireIDs(channelID, &ChannelWire, 1U) == 1U);
+      BOOST_TEST(ChannelWire == ChannelWires.front());
+      BOOST_TEST(geom->ChannelToWireIDs(channelID, nullptr, 0U) == 1U);
+
       // does the channel map back to the right ROP?
       readout::ROPID const ChannelROPID = geom->ChannelToROP(channelID);
       BOOST_TEST(ChannelROPID == ropID);
@@ -315,3 +377,71 @@ void geo::ChannelMapStandardTestAlg::ChannelMappingTest() const
 } // ChannelMapStandardTestAlg::ChannelMappingTest()
 
 //-----------------------------------------------------------------------------
+void geo::ChannelMapStandardTestAlg::SignalTypeTest() const
+{
+
+  /*
+   * ChannelMapStandardAlg interface being tested (via GeometryCore):
+   *
+   *     geo::SigType_t SignalTypeForChannel(raw::ChannelID_t) const
+   *
+   * In the standard mapping, the last plane of each TPC is collection, and all
+   * the others are induction.
+   */
+
+  // check for invalid input
+  BOOST_TEST(geom->SignalType(raw::InvalidChannelID) == geo::kMysteryType);
+  BOOST_TEST(geom->SignalType((raw::ChannelID_t)geom->Nchannels()) == geo::kMysteryType);
+
+  //
+  // plane-wide checks (all cryostats)
+  //
+  for (geo::PlaneID const& planeID : geom->Iterate<PlaneID>()) {
+    BOOST_TEST_CHECKPOINT("plane: " << std::string(planeID));
+
+    geo::SigType_t const expected =
+      (planeID.Plane + 1 == geom->Nplanes(planeID)) ? geo::kCollection : geo::kInduction;
+
+    readout::ROPID const ropID = geom->WirePlaneToROP(planeID);
+    raw::ChannelID_t const FirstChannelID = geom->FirstChannelInROP(ropID);
+    unsigned int const NChannels = geom->Nchannels(ropID);
+    for (unsigned int iChannelInROP = 0; iChannelInROP < NChannels; ++iChannelInROP) {
+      raw::ChannelID_t const channelID = FirstChannelID + iChannelInROP;
+      BOOST_TEST(geom->SignalType(channelID) == expected);
+    } // for channels
+
+  } // for planes
+
+  //
+  // timing, against the old algorithm
+  //
+  constexpr unsigned int NRepetitions = 20U;
+  raw::ChannelID_t const NChannels = geom->Nchannels();
+  LegacySignalTypeAlg const legacySignalType{*geom};
+
+  unsigned int nCollection = 0U;
+  testing::StopWatch<std::chrono::duration<double, std::nano>> timer;
+  for (unsigned int iRep = 0; iRep < NRepetitions; ++iRep) {
+    for (raw::ChannelID_t channel = 0; channel < NChannels; ++channel)
+      if (legacySignalType(channel) == geo::kCollection) ++nCollection;
+  }
+  timer.stop();
+  double const legacyTime = timer.elapsed();
+
+  timer.restart();
+  for (unsigned int iRep = 0; iRep < NRepetitions; ++iRep) {
+    for (raw::ChannelID_t channel = 0; channel < NChannels; ++channel)
+      if (geom->SignalType(channel) == geo::kCollection) ++nCollection;
+  }
+  timer.stop();
+  double const tableTime = timer.elapsed();
+
+  double const nQueries = double(NRepetitions) * NChannels;
+  BOOST_TEST_MESSAGE("Signal type of " << NChannels << " channels (" << (nCollection / 2)
+                                       << " collection queries):"
+                                       << "\n  old algorithm: " << (legacyTime / nQueries)
+                                       << " ns/channel"
+                                       << "\n  lookup table:  " << (tableTime / nQueries)
+                                       << " ns/channel");
+
+} // ChannelMapStandardTestAlg::SignalTypeTest()
@@ -23,6 +23,9 @@ namespace geo {
     void ROPMappingTest() const;
     void ChannelMappingTest() const;
 
+    /// Checks the signal type of all channels, and times the lookup.
+    void SignalTypeTest() const;
+
   private:
     GeometryCore const* geom = nullptr;
 
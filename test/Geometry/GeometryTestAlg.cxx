@@ -16,6 +16,7 @@
 #include "larcorealg/Geometry/AuxDetSensitiveGeo.h"
 #include "larcorealg/Geometry/CryostatGeo.h"
 #include "larcorealg/Geometry/Decomposer.h"
+#include "larcorealg/Geometry/DensityVoxelMap.h"
 #include "larcorealg/Geometry/Exceptions.h"
 #include "larcorealg/Geometry/GeometryCore.h"
 #include "larcorealg/Geometry/PlaneGeo.h"
@@ -59,6 +60,7 @@
 #include <iterator> // std::inserter()
 #include <limits>   // std::numeric_limits<>
 #include <memory>
+#include <random>
 #include <set>
 #include <sstream>
 #include <stdint.h>
@@ -187,6 +189,18 @@ namespace geo {
         MF_LOG_INFO("GeometryTest") << "complete.";
       }
 
+      if (shouldRunTests("TPCPositionIndex")) {
+        MF_LOG_INFO("GeometryTest") << "test TPC lookup by position ...";
+        testTPCPositionIndex();
+        MF_LOG_INFO("GeometryTest") << "complete.";
+      }
+
+      if (shouldRunTests("ClosestOpDet")) {
+        MF_LOG_INFO("GeometryTest") << "test closest optical detector lookup ...";
+        testClosestOpDet();
+        MF_LOG_INFO("GeometryTest") << "complete.";
+      }
+
       if (shouldRunTests("FindVolumes")) {
         MF_LOG_INFO("GeometryTest") << "test FindAllVolumes method ...";
         testFindVolumes();
@@ -272,6 +286,12 @@ namespace geo {
         MF_LOG_INFO("GeometryTest") << "complete.";
       }
 
+      if (shouldRunTests("NearestWireBatch")) {
+        MF_LOG_INFO("GeometryTest") << "testNearestWireBatch...";
+        testNearestWireBatch();
+        MF_LOG_INFO("GeometryTest") << "complete.";
+      }
+
       if (shouldRunTests("WireIntersection")) {
         MF_LOG_INFO("GeometryTest") << "testWireIntersection...";
         testWireIntersection();
@@ -314,6 +334,12 @@ namespace geo {
         MF_LOG_INFO("GeometryTest") << "complete.";
       }
 
+      if (shouldRunTests("DensityVoxelMap")) {
+        MF_LOG_INFO("GeometryTest") << "testDensityVoxelMap...";
+        testDensityVoxelMap();
+        MF_LOG_INFO("GeometryTest") << "complete.";
+      }
+
       if (shouldRunTests("FindAuxDet")) {
         MF_LOG_INFO("GeometryTest") << "testFindAuxDet...";
         testFindAuxDet();
@@ -641,6 +667,208 @@ namespace geo {
     return;
   }
 
+  //......................................................................
+  void GeometryTestAlg::testTPCPositionIndex() const
+  {
+    /*
+     * Compares the TPC lookup from GeometryCore, based on a spatial index,
+     * with a plain linear scan of all cryostats and TPCs, on a lattice of
+     * points covering all the cryostats (and some more), and on the corners
+     * of all the TPCs (where the position tolerance matters).
+     * The time spent by the two methods is also reported.
+     */
+    double const wiggle = 1.0 + geom->DefaultWiggle();
+    auto const linearScan = [this, wiggle](geo::Point_t const& point) -> geo::TPCGeo const* {
+      for (geo::CryostatGeo const& cryo : geom->Iterate<geo::CryostatGeo>()) {
+        if (cryo.ContainsPosition(point, wiggle)) return cryo.PositionToTPCptr(point, wiggle);
+      }
+      return nullptr;
+    };
+
+    // collect the test points
+    std::vector<geo::Point_t> points;
+    geo::BoxBoundedGeo box = geom->Cryostat(geo::CryostatID{0}).Boundaries();
+    for (geo::CryostatGeo const& cryo : geom->Iterate<geo::CryostatGeo>())
+      box.ExtendToInclude(cryo.Boundaries());
+    geo::Vector_t const margin = 0.1 * (box.Max() - box.Min());
+    geo::Point_t const start = box.Min() - margin;
+    geo::Vector_t const step = 1.2 * (box.Max() - box.Min()) / 39.0;
+    for (int i = 0; i < 40; ++i)
+      for (int j = 0; j < 40; ++j)
+        for (int k = 0; k < 40; ++k)
+          points.emplace_back(start.X() + i * step.X(),
+                              start.Y() + j * step.Y(),
+                              start.Z() + k * step.Z());
+    for (geo::TPCGeo const& tpc : geom->Iterate<geo::TPCGeo>()) {
+      for (double x : {tpc.MinX(), tpc.MaxX()})
+        for (double y : {tpc.MinY(), tpc.MaxY()})
+          for (double z : {tpc.MinZ(), tpc.MaxZ()})
+            points.emplace_back(x, y, z);
+    } // for TPCs
+
+    // correctness
+    unsigned int nErrors = 0;
+    for (geo::Point_t const& point : points) {
+      geo::TPCGeo const* expected = linearScan(point);
+      geo::TPCGeo const* tpc = geom->PositionToTPCptr(point);
+      if (tpc == expected) continue;
+      ++nErrors;
+      mf::LogProblem("GeometryTest")
+        << "Point " << point << " is in TPC "
+        << (expected ? std::string(expected->ID()) : std::string("<none>"))
+        << " but GeometryCore::PositionToTPCptr() reports "
+        << (tpc ? std::string(tpc->ID()) : std::string("<none>"));
+    } // for points
+
+    // timing
+    constexpr unsigned int NRepetitions = 10U;
+    std::size_t nFound = 0;
+    TStopwatch stopWatch;
+    stopWatch.Start();
+    for (unsigned int iRep = 0; iRep < NRepetitions; ++iRep)
+      for (geo::Point_t const& point : points)
+        if (linearScan(point)) ++nFound;
+    stopWatch.Stop();
+    double const linearTime = stopWatch.RealTime();
+    stopWatch.Start();
+    for (unsigned int iRep = 0; iRep < NRepetitions; ++iRep)
+      for (geo::Point_t const& point : points)
+        if (geom->PositionToTPCptr(point)) ++nFound;
+    stopWatch.Stop();
+    double const indexTime = stopWatch.RealTime();
+
+    std::size_t const nQueries = NRepetitions * points.size();
+    mf::LogVerbatim("GeometryTest")
+      << "TPC lookup on " << nQueries << " points (" << (nFound / 2) << " in TPCs):"
+      << "\n  linear scan:   " << (linearTime / nQueries * 1e9) << " ns/point"
+      << "\n  spatial index: " << (indexTime / nQueries * 1e9) << " ns/point";
+
+    if (nErrors > 0) {
+      throw cet::exception("TPCPositionIndex")
+        << "testTPCPositionIndex() found " << nErrors << " mismatches (see messages above)\n";
+    }
+
+  } // GeometryTestAlg::testTPCPositionIndex()
+
+  //......................................................................
+  void GeometryTestAlg::testClosestOpDet() const
+  {
+    /*
+     * Compares the lookup of the closest optical detectors, based on a spatial
+     * index, with a plain linear scan of all the detectors in the cryostat, on
+     * a lattice of points covering each cryostat and on the detector centers.
+     * The time spent by the two methods is also reported.
+     */
+    constexpr unsigned int K = 5U; // number of neighbours in k-nearest test
+    constexpr int NSteps = 20;
+
+    unsigned int nErrors = 0;
+    double linearTime = 0.0, indexTime = 0.0, batchTime = 0.0;
+    std::size_t nQueries = 0;
+    TStopwatch stopWatch;
+
+    for (geo::CryostatGeo const& cryo : geom->Iterate<geo::CryostatGeo>()) {
+      unsigned int const nOpDets = cryo.NOpDet();
+      if (nOpDets == 0) continue;
+
+      auto const linearScan = [&cryo, nOpDets](geo::Point_t const& point) {
+        unsigned int closest = std::numeric_limits<unsigned int>::max();
+        double closestDist = std::numeric_limits<double>::max();
+        for (unsigned int o = 0U; o < nOpDets; ++o) {
+          // squared distance, as the index does: `DistanceToPoint()` square
+          // root may merge different distances into a tie
+          double const dist = (point - cryo.OpDet(o).GetCenter()).Mag2();
+          if (dist < closestDist) {
+            closestDist = dist;
+            closest = o;
+          }
+        }
+        return closest;
+      };
+
+      // collect the test points
+      std::vector<geo::Point_t> points;
+      geo::Vector_t const step = (cryo.Max() - cryo.Min()) / (NSteps - 1);
+      for (int i = 0; i < NSteps; ++i)
+        for (int j = 0; j < NSteps; ++j)
+          for (int k = 0; k < NSteps; ++k)
+            points.push_back(cryo.Min() + geo::Vector_t{i * step.X(), j * step.Y(), k * step.Z()});
+      for (unsigned int o = 0U; o < nOpDets; ++o)
+        points.push_back(cryo.OpDet(o).GetCenter());
+
+      // correctness
+      std::vector<unsigned int> batch(points.size());
+      cryo.GetClosestOpDet(points.size(), points.data(), batch.data());
+      for (std::size_t iPoint = 0; iPoint < points.size(); ++iPoint) {
+        geo::Point_t const& point = points[iPoint];
+        unsigned int const expected = linearScan(point);
+        unsigned int const closest = cryo.GetClosestOpDet(point);
+        if ((closest != expected) || (batch[iPoint] != expected)) {
+          ++nErrors;
+          mf::LogProblem("GeometryTest")
+            << "Point " << point << " is closest to optical detector #" << expected << " in "
+            << std::string(cryo.ID()) << " but GetClosestOpDet() reports #" << closest
+            << " (batch: #" << batch[iPoint] << ")";
+        }
+
+        std::vector<std::pair<double, unsigned int>> distances;
+        for (unsigned int o = 0U; o < nOpDets; ++o)
+          distances.emplace_back((point - cryo.OpDet(o).GetCenter()).Mag2(), o);
+        std::sort(distances.begin(), distances.end());
+        std::vector<unsigned int> const neighbours = cryo.GetClosestOpDets(point, K);
+        std::size_t const nExpected = std::min<std::size_t>(K, nOpDets);
+        bool sameNeighbours = (neighbours.size() == nExpected);
+        for (std::size_t i = 0; sameNeighbours && (i < nExpected); ++i)
+          sameNeighbours = (neighbours[i] == distances[i].second);
+        if (!sameNeighbours) {
+          ++nErrors;
+          mf::LogProblem log("GeometryTest");
+          log << "Point " << point << " in " << std::string(cryo.ID())
+              << ": GetClosestOpDets() reports detectors";
+          for (unsigned int o : neighbours)
+            log << " #" << o;
+          log << ", expected";
+          for (std::size_t i = 0; i < nExpected; ++i)
+            log << " #" << distances[i].second;
+        }
+      } // for points
+
+      // timing
+      unsigned int sum = 0U;
+      stopWatch.Start();
+      for (geo::Point_t const& point : points)
+        sum += linearScan(point);
+      stopWatch.Stop();
+      linearTime += stopWatch.RealTime();
+      stopWatch.Start();
+      for (geo::Point_t const& point : points)
+        sum += cryo.GetClosestOpDet(point);
+      stopWatch.Stop();
+      indexTime += stopWatch.RealTime();
+      stopWatch.Start();
+      cryo.GetClosestOpDet(points.size(), points.data(), batch.data());
+      stopWatch.Stop();
+      batchTime += stopWatch.RealTime();
+      nQueries += points.size();
+      MF_LOG_TRACE("GeometryTest") << "Check sum on " << std::string(cryo.ID()) << ": " << sum;
+
+    } // for cryostats
+
+    if (nQueries > 0) {
+      mf::LogVerbatim("GeometryTest")
+        << "Closest optical detector to " << nQueries << " points:"
+        << "\n  linear scan:   " << (linearTime / nQueries * 1e9) << " ns/point"
+        << "\n  spatial index: " << (indexTime / nQueries * 1e9) << " ns/point"
+        << "\n  batch:         " << (batchTime / nQueries * 1e9) << " ns/point";
+    }
+
+    if (nErrors > 0) {
+      throw cet::exception("ClosestOpDet")
+        << "testClosestOpDet() found " << nErrors << " mismatches (see messages above)\n";
+    }
+
+  } // GeometryTestAlg::testClosestOpDet()
+
   //......................................................................
   unsigned int GeometryTestAlg::testFindWorldVolumes()
   {
@@ -2120,6 +2348,174 @@ namespace geo {
     }
   }
 
+  //......................................................................
+  void GeometryTestAlg::testNearestWireBatch() const
+  {
+    /*
+     * Compares the batch methods `PlaneGeo::WireCoordinates()` and
+     * `PlaneGeo::NearestWireNumbers()`, their `GeometryCore` counterparts
+     * (through the channel mapping), and the non-throwing
+     * `PlaneGeo::NearestWireID()` and `GeometryCore::NearestWireID()`, with
+     * the single-point throwing versions, on points sampled across each plane
+     * and beyond its first and last wires.
+     * The time spent by the batch and single-point methods is also reported.
+     */
+    constexpr unsigned int NRepetitions = 10U;
+    constexpr int NSteps = 7; // points per wire pitch
+
+    unsigned int nErrors = 0;
+    double singleTime = 0.0, batchTime = 0.0;
+    std::size_t nQueries = 0;
+    TStopwatch stopWatch;
+
+    for (geo::PlaneGeo const& plane : geom->Iterate<geo::PlaneGeo>()) {
+
+      // sample points from 3 wires before the first to 3 after the last
+      geo::Point_t const firstCenter = plane.FirstWire().GetCenter();
+      geo::Vector_t const step = plane.WirePitch() / NSteps * plane.GetIncreasingWireDirection();
+      int const nPoints = (plane.Nwires() + 6) * NSteps;
+      std::vector<double> x(nPoints), y(nPoints), z(nPoints);
+      for (int i = 0; i < nPoints; ++i) {
+        geo::Point_t const p = firstCenter + (i - 3 * NSteps) * step;
+        x[i] = p.X();
+        y[i] = p.Y();
+        z[i] = p.Z();
+      }
+
+      std::vector<double> wireCoords(nPoints);
+      std::vector<geo::WireID::WireID_t> wireNos(nPoints);
+      auto outOfRange = std::make_unique<bool[]>(nPoints);
+
+      // correctness
+      plane.WireCoordinates(nPoints, x.data(), y.data(), z.data(), wireCoords.data());
+      std::size_t const nBad = plane.NearestWireNumbers(
+        nPoints, x.data(), y.data(), z.data(), wireNos.data(), outOfRange.get());
+      std::vector<double> geoWireCoords;
+      std::vector<geo::WireID::WireID_t> geoWireNos;
+      std::vector<bool> geoOutOfRange;
+      geom->WireCoordinates(plane.ID(), y, z, geoWireCoords);
+      std::size_t const nGeoBad =
+        geom->NearestWireNumbers(plane.ID(), y, z, geoWireNos, geoOutOfRange);
+      std::size_t nExpectedBad = 0;
+      for (int i = 0; i < nPoints; ++i) {
+        geo::Point_t const p{x[i], y[i], z[i]};
+        double const expectedCoord = plane.WireCoordinate(p);
+        if (std::abs(wireCoords[i] - expectedCoord) > 1e-9) {
+          ++nErrors;
+          mf::LogProblem("GeometryTest")
+            << "Point " << p << " on " << std::string(plane.ID()) << " has wire coordinate "
+            << expectedCoord << " but WireCoordinates() reports " << wireCoords[i];
+        }
+        geo::WireID::WireID_t expectedWire = 0;
+        bool expectedOutOfRange = false;
+        try {
+          expectedWire = plane.NearestWireID(p).Wire;
+        }
+        catch (geo::InvalidWireError const& e) {
+          expectedWire = e.suggestedWire();
+          expectedOutOfRange = true;
+          ++nExpectedBad;
+        }
+        if ((wireNos[i] != expectedWire) || (outOfRange[i] != expectedOutOfRange)) {
+          ++nErrors;
+          mf::LogProblem("GeometryTest")
+            << "Point " << p << " on " << std::string(plane.ID()) << " is near wire "
+            << expectedWire << (expectedOutOfRange ? " (out of range)" : "")
+            << " but NearestWireNumbers() reports " << wireNos[i]
+            << (outOfRange[i] ? " (out of range)" : "");
+        }
+        if (std::abs(geoWireCoords[i] - expectedCoord) > 1e-6) {
+          ++nErrors;
+          mf::LogProblem("GeometryTest")
+            << "Point " << p << " on " << std::string(plane.ID()) << " has wire coordinate "
+            << expectedCoord << " but GeometryCore::WireCoordinates() reports "
+            << geoWireCoords[i];
+        }
+        if ((geoWireNos[i] != expectedWire) || (geoOutOfRange[i] != expectedOutOfRange)) {
+          ++nErrors;
+          mf::LogProblem("GeometryTest")
+            << "Point " << p << " on " << std::string(plane.ID()) << " is near wire "
+            << expectedWire << (expectedOutOfRange ? " (out of range)" : "")
+            << " but GeometryCore::NearestWireNumbers() reports " << geoWireNos[i]
+            << (geoOutOfRange[i] ? " (out of range)" : "");
+        }
+        bool singleOutOfRange = !expectedOutOfRange;
+        geo::WireID const wireID = plane.NearestWireID(p, singleOutOfRange);
+        if ((wireID.Wire != expectedWire) || (singleOutOfRange != expectedOutOfRange)) {
+          ++nErrors;
+          mf::LogProblem("GeometryTest")
+            << "Point " << p << " on " << std::string(plane.ID()) << " is near wire "
+            << expectedWire << (expectedOutOfRange ? " (out of range)" : "")
+            << " but non-throwing NearestWireID() reports " << wireID.Wire
+            << (singleOutOfRange ? " (out of range)" : "");
+        }
+        bool geoOutOfRangeFlag = !expectedOutOfRange;
+        geo::WireID const geoWireID = geom->NearestWireID(p, plane.ID(), geoOutOfRangeFlag);
+        if ((geoWireID != geo::WireID{plane.ID(), expectedWire}) ||
+            (geoOutOfRangeFlag != expectedOutOfRange)) {
+          ++nErrors;
+          mf::LogProblem("GeometryTest")
+            << "Point " << p << " on " << std::string(plane.ID()) << " is near wire "
+            << expectedWire << (expectedOutOfRange ? " (out of range)" : "")
+            << " but non-throwing GeometryCore::NearestWireID() reports "
+            << std::string(geoWireID) << (geoOutOfRangeFlag ? " (out of range)" : "");
+        }
+      } // for points
+      if (nBad != nExpectedBad) {
+        ++nErrors;
+        mf::LogProblem("GeometryTest")
+          << "NearestWireNumbers() on " << std::string(plane.ID()) << " reports " << nBad
+          << " points out of range, " << nExpectedBad << " expected";
+      }
+      if (nGeoBad != nExpectedBad) {
+        ++nErrors;
+        mf::LogProblem("GeometryTest")
+          << "GeometryCore::NearestWireNumbers() on " << std::string(plane.ID()) << " reports "
+          << nGeoBad << " points out of range, " << nExpectedBad << " expected";
+      }
+
+      // timing (single-point version includes the cost of the exceptions)
+      geo::WireID::WireID_t sum = 0;
+      stopWatch.Start();
+      for (unsigned int iRep = 0; iRep < NRepetitions; ++iRep) {
+        for (int i = 0; i < nPoints; ++i) {
+          try {
+            sum += plane.NearestWireID({x[i], y[i], z[i]}).Wire;
+          }
+          catch (geo::InvalidWireError const& e) {
+            sum += e.suggestedWire();
+          }
+        } // for points
+      }
+      stopWatch.Stop();
+      singleTime += stopWatch.RealTime();
+      stopWatch.Start();
+      for (unsigned int iRep = 0; iRep < NRepetitions; ++iRep) {
+        plane.NearestWireNumbers(
+          nPoints, x.data(), y.data(), z.data(), wireNos.data(), outOfRange.get());
+        sum += wireNos[iRep % nPoints];
+      }
+      stopWatch.Stop();
+      batchTime += stopWatch.RealTime();
+      nQueries += NRepetitions * nPoints;
+      MF_LOG_TRACE("GeometryTest") << "Check sum on " << std::string(plane.ID()) << ": " << sum;
+
+    } // for planes
+
+    if (nQueries > 0) {
+      mf::LogVerbatim("GeometryTest")
+        << "Nearest wire of " << nQueries << " points:"
+        << "\n  NearestWireID():      " << (singleTime / nQueries * 1e9) << " ns/point"
+        << "\n  NearestWireNumbers(): " << (batchTime / nQueries * 1e9) << " ns/point";
+    }
+
+    if (nErrors > 0) {
+      throw cet::exception("NearestWireBatch")
+        << "testNearestWireBatch() found " << nErrors << " mismatches (see messages above)\n";
+    }
+
+  } // GeometryTestAlg::testNearestWireBatch()
+
   //......................................................................
   bool GeometryTestAlg::isWireAlignedToPlaneDirections(geo::PlaneGeo const& plane,
                                                        geo::Vector_t const& wireDir) const
@@ -3204,6 +3600,18 @@ namespace geo {
         << " instead";
       return false;
     }
+
+    // non-throwing version
+    unsigned int ptrDet = std::numeric_limits<unsigned int>::max();
+    geo::AuxDetGeo const* auxDet = geom->PositionToAuxDetPtr(pos, ptrDet);
+    if ((ptrDet != expected) || (auxDet != &(geom->AuxDet(expected)))) {
+      mf::LogProblem("GeometryTestAlg")
+        << "Auxiliary detector at position " << lar::dump::array<3U>(pos)
+        << ", expected within aux det #" << expected
+        << ", was returned by PositionToAuxDetPtr() to be " << ptrDet
+        << (auxDet ? "" : " (null pointer)") << " instead";
+      return false;
+    }
     return true;
   } // GeometryTestAlg::CheckAuxDetAtPosition()
 
@@ -3233,9 +3641,137 @@ namespace geo {
         << " instead";
       return false;
     }
+
+    // non-throwing version
+    geo::AuxDetSensitiveGeo const* auxDetSens =
+      geom->PositionToAuxDetSensitivePtr(pos, foundDet, foundSensDet);
+    if ((foundDet != expectedDet) || (foundSensDet != expectedSens) ||
+        (auxDetSens != &(geom->AuxDet(expectedDet).SensitiveVolume(expectedSens)))) {
+      mf::LogProblem("GeometryTestAlg")
+        << "Auxiliary detector at position " << lar::dump::array<3U>(pos)
+        << ", expected within aux det #" << expectedDet << ", sensitive volume #" << expectedSens
+        << ", was returned by PositionToAuxDetSensitivePtr() to be in aux det #" << foundDet
+        << " sensitive volume #" << foundSensDet << (auxDetSens ? "" : " (null pointer)")
+        << " instead";
+      return false;
+    }
     return true;
   } // GeometryTestAlg::CheckAuxDetAtPosition()
 
+  //......................................................................
+  void GeometryTestAlg::testDensityVoxelMap() const
+  {
+    /*
+     * Builds a coarse density map of the detector enclosure (or of the world,
+     * if there is no enclosure) and verifies that:
+     * - the material of each voxel is the one of the geometry at its center;
+     * - the materials along a segment fully inside the map cover its length;
+     * and reports how the column density of random segments compares with
+     * the one from GeometryCore::MassBetweenPoints(), and the time spent by
+     * the two methods.
+     */
+    constexpr double NVoxelsPerSide = 40.0;
+    constexpr unsigned int NSegments = 500U;
+
+    geo::BoxBoundedGeo box = geom->WorldBox();
+    try {
+      box = geom->DetectorEnclosureBox();
+    }
+    catch (cet::exception const&) {
+      mf::LogVerbatim("GeometryTest") << "No detector enclosure found: mapping the world.";
+    }
+
+    TStopwatch stopWatch;
+    stopWatch.Start();
+    geo::DensityVoxelMap const densityMap{
+      *geom,
+      box,
+      {box.SizeX() / NVoxelsPerSide, box.SizeY() / NVoxelsPerSide, box.SizeZ() / NVoxelsPerSide}};
+    stopWatch.Stop();
+    auto const& nVoxels = densityMap.VoxelCounts();
+    auto const& voxelSizes = densityMap.VoxelSizes();
+    mf::LogVerbatim("GeometryTest")
+      << "Density map of " << box.Min() << " -- " << box.Max() << " with " << nVoxels[0] << "x"
+      << nVoxels[1] << "x" << nVoxels[2] << " voxels, " << densityMap.NMaterials()
+      << " materials, built in " << stopWatch.RealTime() << " s";
+
+    unsigned int nErrors = 0;
+
+    // material at voxel centers
+    for (std::size_t ix = 0; ix < nVoxels[0]; ix += 3) {
+      for (std::size_t iy = 0; iy < nVoxels[1]; iy += 3) {
+        for (std::size_t iz = 0; iz < nVoxels[2]; iz += 3) {
+          geo::Point_t const center{box.MinX() + (ix + 0.5) * voxelSizes[0],
+                                    box.MinY() + (iy + 0.5) * voxelSizes[1],
+                                    box.MinZ() + (iz + 0.5) * voxelSizes[2]};
+          if (densityMap.Material(center) == geom->Material(center)) continue;
+          ++nErrors;
+          mf::LogProblem("GeometryTest")
+            << "Density map has the wrong material at " << center << " (expected: '"
+            << geom->MaterialName(center) << "')";
+        } // for z
+      }   // for y
+    }     // for x
+
+    // random segments within the map
+    std::mt19937 engine{1234U};
+    std::uniform_real_distribution<double> fx{box.MinX(), box.MaxX()};
+    std::uniform_real_distribution<double> fy{box.MinY(), box.MaxY()};
+    std::uniform_real_distribution<double> fz{box.MinZ(), box.MaxZ()};
+    std::vector<std::pair<geo::Point_t, geo::Point_t>> segments;
+    for (unsigned int i = 0; i < NSegments; ++i) {
+      segments.emplace_back(geo::Point_t{fx(engine), fy(engine), fz(engine)},
+                            geo::Point_t{fx(engine), fy(engine), fz(engine)});
+    }
+
+    unsigned int nWithinBound = 0;
+    double maxRelDiff = 0.0;
+    for (auto const& [start, end] : segments) {
+      double const length = (end - start).R();
+      double totalLength = 0.0;
+      for (auto const& step : densityMap.MaterialSteps(start, end))
+        totalLength += step.length;
+      if (std::abs(totalLength - length) > 1e-6 * length) {
+        ++nErrors;
+        mf::LogProblem("GeometryTest")
+          << "Materials on the segment " << start << " -- " << end << " span " << totalLength
+          << " cm instead of " << length << " cm";
+      }
+
+      double const exact = geom->MassBetweenPoints(start, end);
+      auto const approx = densityMap.ColumnDensity(start, end);
+      double const diff = std::abs(approx.value - exact);
+      if (diff <= approx.error + 1e-9 * exact) ++nWithinBound;
+      if (exact > 0.0) maxRelDiff = std::max(maxRelDiff, diff / exact);
+    } // for segments
+
+    // timing
+    double sum = 0.0;
+    stopWatch.Start();
+    for (auto const& [start, end] : segments)
+      sum += geom->MassBetweenPoints(start, end);
+    stopWatch.Stop();
+    double const exactTime = stopWatch.RealTime();
+    stopWatch.Start();
+    for (auto const& [start, end] : segments)
+      sum += densityMap.ColumnDensity(start, end).value;
+    stopWatch.Stop();
+    double const mapTime = stopWatch.RealTime();
+    MF_LOG_TRACE("GeometryTest") << "Check sum: " << sum;
+
+    mf::LogVerbatim("GeometryTest")
+      << "Column density of " << NSegments << " segments: " << nWithinBound
+      << " within the error bound of the map, largest relative difference " << maxRelDiff
+      << "\n  MassBetweenPoints(): " << (exactTime / NSegments * 1e6) << " us/segment"
+      << "\n  density map:         " << (mapTime / NSegments * 1e6) << " us/segment";
+
+    if (nErrors > 0) {
+      throw cet::exception("DensityVoxelMap")
+        << "testDensityVoxelMap() found " << nErrors << " errors (see messages above)\n";
+    }
+
+  } // GeometryTestAlg::testDensityVoxelMap()
+
   //......................................................................
   void GeometryTestAlg::testFindAuxDet() const
   {
@@ -3277,6 +3813,20 @@ namespace geo {
 
     } // for all auxiliary detectors
 
+    // a point out of the world is in no auxiliary detector
+    geo::BoxBoundedGeo const world = geom->WorldBox();
+    geo::Point_t const outside = world.Max() + (world.Max() - world.Min());
+    unsigned int outsideDet = 0;
+    std::size_t outsideSensDet = 0, outsideSensVol = 0;
+    if (geom->PositionToAuxDetPtr(outside, outsideDet) ||
+        (outsideDet != std::numeric_limits<unsigned int>::max()) ||
+        geom->PositionToAuxDetSensitivePtr(outside, outsideSensDet, outsideSensVol)) {
+      mf::LogProblem("GeometryTestAlg")
+        << "Auxiliary detector #" << outsideDet << " found at " << outside
+        << ", outside of the world";
+      ++nErrors;
+    }
+
     if (nErrors != 0) {
       throw cet::exception("FindAuxDet")
         << "Collected " << nErrors << " errors during testFindAuxDet() test!\n";
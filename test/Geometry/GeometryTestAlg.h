@@ -61,6 +61,10 @@ namespace geo {
    *   + `CheckOverlaps` (not in default) perform overlap checks
    *   + `ThoroughCheck` (not in default) makes ROOT perform full geometry check
    *   + `DetectorIntro`: prints some information about the detector
+   *   + `TPCPositionIndex`: compares the TPC lookup by position with a linear
+   *     scan of all TPCs, and reports the time spent by both
+   *   + `ClosestOpDet`: compares the lookup of the closest optical detectors
+   *     with a linear scan of all of them, and reports the time spent by both
    *   + `FindVolumes`: checks it can find the volumes corresponding to world
    *     and all cryostats
    *   + `Cryostat`:
@@ -77,6 +81,10 @@ namespace geo {
    *     reference system of the frame of the plane
    *   + `WireCoordAngle`: tests geo::PlaneGeo::PhiZ()
    *   + `NearestWire`: tests `WireCoordinate()` and `NearestWire()`
+   *   + `NearestWireBatch`: tests `PlaneGeo::WireCoordinates()`,
+   *     `PlaneGeo::NearestWireNumbers()`, their `GeometryCore` counterparts
+   *     and non-throwing `PlaneGeo::NearestWireID()` and
+   *     `GeometryCore::NearestWireID()` against the single-point versions
    *   + `WireIntersection`: tests `WireIDsIntersect()`
    *   + `ThirdPlane`: tests `ThirdPlane()`
    *   + `ThirdPlaneSlope`: tests `ThirdPlaneSlope()`
@@ -84,7 +92,10 @@ namespace geo {
    *   + `PlanePitch`:
    *   + `InterWireProjectedDistance`: tests `geo::PlaneGeo::InterWireProjectedDistance()`
    *   + `Stepping`:
-   *   + `FindAuxDet`: test on location of nearest auxiliary detector
+   *   + `DensityVoxelMap`: compares the material and column density from
+   *     `geo::DensityVoxelMap` with the ones from the geometry navigation
+   *   + `FindAuxDet`: test on location of nearest auxiliary detector, also with
+   *     the non-throwing `PositionToAuxDetPtr()` and `PositionToAuxDetSensitivePtr()`
    *   + `PrintWires`: (not in default) prints *all* the wires in the geometry
    *   + `default`: represents the default set (optionally prepended by '@')
    *   + `!` (special): means to forget the tests configured so far; used as the
@@ -136,6 +147,8 @@ namespace geo {
     void testFindVolumes();
     void testCryostat();
     void testTPC(geo::CryostatID const& cid);
+    void testTPCPositionIndex() const;
+    void testClosestOpDet() const;
     void testPlaneDirections() const;
     void testWireOrientations() const;
     void testChannelToROP() const;
@@ -156,10 +169,12 @@ namespace geo {
     void testStandardWirePos();
     void testAPAWirePos();
     void testNearestWire();
+    void testNearestWireBatch() const;
     void testWireIntersection() const;
     void testThirdPlane() const;
     void testThirdPlane_dTdW() const;
     void testStepping();
+    void testDensityVoxelMap() const;
     void testFindAuxDet() const;
 
     bool shouldRunTests(std::string test_name) const;
@@ -0,0 +1,227 @@
+/**
+ * @file   auxdetpositionindex_test.cxx
+ * @brief  Test of the position index of the auxiliary detectors.
+ * @date   October 16, 2026
+ *
+ * Usage: just run the executable.
+ *
+ * Auxiliary detectors (boxes and trapezoids, randomly rotated and partially
+ * overlapping) are created by hand, and the detector found by
+ * `geo::AuxDetPositionIndex` is compared with the one from a scan of all the
+ * detectors, on random points, on points close to the detector surfaces and on
+ * points far from all detectors.
+ */
+
+// Boost test libraries; defining this symbol tells boost somehow to generate
+// a main() function; Boost is pulled in by boost_unit_test_base.h
+#define BOOST_TEST_MODULE auxdetpositionindex_test
+
+// LArSoft libraries
+#include "larcorealg/Geometry/AuxDetGeo.h"
+#include "larcorealg/Geometry/AuxDetPositionIndex.h"
+#include "larcorealg/Geometry/TransformationMatrix.h"
+#include "larcorealg/Geometry/details/trapezoidContains.h"
+
+// utility libraries
+#include <boost/test/unit_test.hpp>
+
+// ROOT libraries
+#include "Math/GenVector/Rotation3D.h"
+#include "Math/GenVector/RotationZYX.h"
+#include "Math/GenVector/Translation3D.h"
+#include "TGeoBBox.h"
+#include "TGeoManager.h"
+#include "TGeoMatrix.h"
+#include "TGeoNode.h"
+#include "TGeoTrd2.h"
+#include "TGeoVolume.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <memory>  // std::unique_ptr
+#include <random>
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------------
+namespace {
+
+  constexpr std::size_t NoAuxDet = geo::AuxDetPositionIndex::NoAuxDet;
+
+  /// Returns the first detector containing `point`, testing all of them.
+  std::size_t scanAuxDets(std::vector<geo::AuxDetGeo> const& auxDets,
+                          geo::Point_t const& point,
+                          double tolerance)
+  {
+    for (std::size_t iDet = 0; iDet < auxDets.size(); ++iDet) {
+      if (geo::details::trapezoidContains(auxDets[iDet], point, tolerance)) return iDet;
+    }
+    return NoAuxDet;
+  } // scanAuxDets()
+
+  /// Half width of `auxDet` at the local coordinate `z` along its length.
+  double halfWidthAt(geo::AuxDetGeo const& auxDet, double z)
+  {
+    double const halfCenterWidth = 0.5 * (auxDet.HalfWidth1() + auxDet.HalfWidth2());
+    return halfCenterWidth - z * (halfCenterWidth - auxDet.HalfWidth2()) / (0.5 * auxDet.Length());
+  } // halfWidthAt()
+
+  /// Hand-made auxiliary detectors.
+  struct AuxDetFixture {
+
+    static constexpr std::size_t NSide = 4; ///< Detectors on each side of the grid.
+    static constexpr double Spacing = 50.0; ///< Distance between grid nodes [cm].
+
+    std::vector<std::unique_ptr<TGeoNode>> nodes; ///< Keeps the ROOT nodes alive.
+    std::vector<geo::AuxDetGeo> auxDets;
+
+    AuxDetFixture()
+    {
+      if (!gGeoManager) new TGeoManager("AuxDetPositionIndexTest", "hand-made auxiliary detectors");
+
+      std::mt19937 engine{2026U}; // fixed seed: the test is reproducible
+      std::uniform_real_distribution<double> angle{-3.14159, 3.14159};
+      std::uniform_real_distribution<double> jitter{-0.3 * Spacing, 0.3 * Spacing};
+      std::uniform_real_distribution<double> halfWidth{5.0, 25.0};
+      std::uniform_real_distribution<double> halfHeight{0.5, 5.0};
+      std::uniform_real_distribution<double> halfLength{10.0, 40.0};
+
+      auxDets.reserve(NSide * NSide * NSide);
+      for (std::size_t i = 0; i < NSide * NSide * NSide; ++i) {
+        double const hw1 = halfWidth(engine);
+        double const hh = halfHeight(engine);
+        double const hl = halfLength(engine);
+
+        // even detectors are boxes, odd ones trapezoids ("Trap" in the name)
+        std::string const name = "volAuxDet" + std::string((i % 2) ? "Trap" : "Box") +
+                                 std::to_string(i);
+        TGeoShape* shape = nullptr;
+        if (i % 2)
+          shape = new TGeoTrd2((name + "Shape").c_str(), hw1, 0.4 * hw1, hh, hh, hl);
+        else
+          shape = new TGeoBBox((name + "Shape").c_str(), hw1, hh, hl);
+        auto* volume = new TGeoVolume(name.c_str(), shape);
+        nodes.push_back(std::make_unique<TGeoNodeMatrix>(volume, gGeoIdentity));
+
+        ROOT::Math::Rotation3D const rotation{
+          ROOT::Math::RotationZYX{angle(engine), angle(engine), angle(engine)}};
+        ROOT::Math::Translation3D const translation{
+          Spacing * (i % NSide) + jitter(engine),
+          Spacing * ((i / NSide) % NSide) + jitter(engine),
+          Spacing * (i / (NSide * NSide)) + jitter(engine)};
+        auxDets.emplace_back(*nodes.back(),
+                             geo::TransformationMatrix{rotation, translation},
+                             geo::AuxDetGeo::AuxDetSensitiveList_t{});
+      } // for
+    }   // AuxDetFixture()
+
+  }; // AuxDetFixture
+
+  /// Compares index and scan on all `points`; returns the number of hits.
+  std::size_t comparePoints(geo::AuxDetPositionIndex const& index,
+                            std::vector<geo::AuxDetGeo> const& auxDets,
+                            std::vector<geo::Point_t> const& points,
+                            double tolerance)
+  {
+    std::size_t nHits = 0;
+    for (geo::Point_t const& point : points) {
+      std::size_t const expected = scanAuxDets(auxDets, point, tolerance);
+      BOOST_TEST_CONTEXT("point " << point << ", tolerance " << tolerance)
+      {
+        BOOST_TEST(index.findAuxDet(point, tolerance) == expected);
+      }
+      if (expected != NoAuxDet) ++nHits;
+    }
+    return nHits;
+  } // comparePoints()
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(EmptyIndexTest)
+{
+  geo::AuxDetPositionIndex const index;
+  BOOST_TEST(index.empty());
+  BOOST_TEST(index.size() == 0U);
+  BOOST_TEST(index.findAuxDet(geo::Point_t{0.0, 0.0, 0.0}) == NoAuxDet);
+  BOOST_TEST(index.findAuxDet(geo::Point_t{0.0, 0.0, 0.0}, 1e6) == NoAuxDet);
+} // EmptyIndexTest
+
+//------------------------------------------------------------------------------
+BOOST_FIXTURE_TEST_CASE(RandomPointTest, AuxDetFixture)
+{
+  geo::AuxDetPositionIndex const index{auxDets};
+  BOOST_TEST(!index.empty());
+  BOOST_TEST(index.size() == auxDets.size());
+
+  // points all over the grid, and a bit beyond it
+  std::mt19937 engine{12345U};
+  std::uniform_real_distribution<double> coord{-Spacing, NSide * Spacing};
+  std::vector<geo::Point_t> points(20000);
+  for (geo::Point_t& point : points)
+    point = {coord(engine), coord(engine), coord(engine)};
+
+  for (double const tolerance : {0.0, 0.5, 5.0}) {
+    std::size_t const nHits = comparePoints(index, auxDets, points, tolerance);
+    BOOST_TEST(nHits > 0U);
+    BOOST_TEST(nHits < points.size());
+  }
+} // RandomPointTest
+
+//------------------------------------------------------------------------------
+BOOST_FIXTURE_TEST_CASE(BoundaryPointTest, AuxDetFixture)
+{
+  geo::AuxDetPositionIndex const index{auxDets};
+
+  // on each face of each detector, a point on the surface,
+  // and points just inside and just outside of it
+  std::mt19937 engine{54321U};
+  std::uniform_real_distribution<double> uniform{-1.0, 1.0};
+  std::vector<geo::Point_t> points;
+  for (geo::AuxDetGeo const& auxDet : auxDets) {
+    double const halfLength = 0.5 * auxDet.Length();
+    for (double const scale : {1.0 - 1e-6, 1.0, 1.0 + 1e-6}) {
+      for (double const side : {-1.0, +1.0}) {
+        double const x = uniform(engine);
+        double const y = uniform(engine) * auxDet.HalfHeight();
+        double const z = uniform(engine) * halfLength;
+        double const endZ = side * scale * halfLength;
+        using LocalPoint_t = geo::AuxDetGeo::LocalPoint_t;
+        // on the sides, on top or bottom, on the end and on a corner
+        LocalPoint_t const onSurface[] = {
+          {side * scale * halfWidthAt(auxDet, z), y, z},
+          {x * halfWidthAt(auxDet, z), side * scale * auxDet.HalfHeight(), z},
+          {x * halfWidthAt(auxDet, endZ), y, endZ},
+          {side * scale * halfWidthAt(auxDet, endZ), side * scale * auxDet.HalfHeight(), endZ}};
+        for (LocalPoint_t const& local : onSurface)
+          points.push_back(auxDet.toWorldCoords(local));
+      } // side
+    }   // scale
+  }     // auxDets
+
+  for (double const tolerance : {0.0, 1e-3, 0.5}) {
+    std::size_t const nHits = comparePoints(index, auxDets, points, tolerance);
+    BOOST_TEST(nHits > 0U);
+  }
+} // BoundaryPointTest
+
+//------------------------------------------------------------------------------
+BOOST_FIXTURE_TEST_CASE(MissTest, AuxDetFixture)
+{
+  geo::AuxDetPositionIndex const index{auxDets};
+
+  // points far away from all the detectors
+  double const far = 10.0 * NSide * Spacing;
+  std::vector<geo::Point_t> const points{
+    {-far, 0.0, 0.0},
+    {far, far, far},
+    {0.0, -far, 0.0},
+    {0.0, 0.0, far},
+    {0.5 * NSide * Spacing, 0.5 * NSide * Spacing, -far},
+  };
+  for (double const tolerance : {0.0, 5.0}) {
+    BOOST_TEST(comparePoints(index, auxDets, points, tolerance) == 0U);
+    for (geo::Point_t const& point : points)
+      BOOST_TEST(index.findAuxDet(point, tolerance) == NoAuxDet);
+  }
+} // MissTest
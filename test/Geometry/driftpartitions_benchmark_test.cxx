@@ -0,0 +1,174 @@
+/**
+ * @file   driftpartitions_benchmark_test.cxx
+ * @brief  Benchmark of the lookup of TPCs by position in the drift volumes.
+ * @date   October 16, 2026
+ *
+ * Usage:
+ *
+ *     driftpartitions_benchmark_test configuration.fcl [repetitions] [steps]
+ *
+ * The configuration file must contain a geometry service provider configuration
+ * under `services.Geometry`, for a geometry with the standard channel mapping.
+ *
+ * For each cryostat, the drift volumes are built by `geo::buildDriftVolumes()`
+ * and flattened into a `geo::FlatDriftPartitions`. A grid of points (by
+ * default, 50 steps on each side) covering the cryostat and some space around
+ * it is assigned to TPCs by the partition tree, by the flattened partition one
+ * point at a time and by the flattened partition in a single batch.
+ * The average time of each is reported, and all the answers must be the same.
+ */
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/DumpUtils.h" // lar::dump::vector3D()
+#include "larcorealg/Geometry/ChannelMapStandardAlg.h"
+#include "larcorealg/Geometry/DriftPartitions.h"
+#include "larcorealg/Geometry/FlatDriftPartitions.h"
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "larcorealg/Geometry/StandaloneBasicSetup.h"    // SetupMessageFacility()...
+#include "larcorealg/Geometry/StandaloneGeometrySetup.h" // SetupGeometry()
+#include "larcorealg/TestUtils/StopWatch.h"
+
+// utility libraries
+#include "fhiclcpp/ParameterSet.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------------
+//---  The tests
+//---
+
+namespace {
+
+  /// Returns a grid of points covering the box, extended by 10% on each side.
+  std::vector<geo::Point_t> gridPoints(geo::BoxBoundedGeo const& box, unsigned int nSteps)
+  {
+    geo::Vector_t const margin = 0.1 * (box.Max() - box.Min());
+    geo::Point_t const min = box.Min() - margin;
+    geo::Vector_t const step = (box.Max() + margin - min) / static_cast<double>(nSteps);
+
+    std::vector<geo::Point_t> points;
+    points.reserve((nSteps + 1U) * (nSteps + 1U) * (nSteps + 1U));
+    for (unsigned int i = 0; i <= nSteps; ++i)
+      for (unsigned int j = 0; j <= nSteps; ++j)
+        for (unsigned int k = 0; k <= nSteps; ++k)
+          points.emplace_back(
+            min.X() + i * step.X(), min.Y() + j * step.Y(), min.Z() + k * step.Z());
+    return points;
+  } // gridPoints()
+
+  /// Returns the time [s] of `lookup` on all `points`, averaged on `nRep`.
+  template <typename Lookup>
+  double timeLookup(Lookup lookup, unsigned int nRep)
+  {
+    testing::StopWatch<> timer;
+    for (unsigned int iRep = 0; iRep < nRep; ++iRep)
+      lookup();
+    return timer.elapsed() / nRep;
+  } // timeLookup()
+
+  /// Returns the number of TPC assignments differing between the two lists.
+  unsigned int compareTPCs(std::vector<geo::Point_t> const& points,
+                           std::vector<geo::TPCGeo const*> const& ref,
+                           std::vector<geo::TPCGeo const*> const& test,
+                           std::string const& what)
+  {
+    unsigned int nErrors = 0;
+    for (std::size_t i = 0; i < points.size(); ++i) {
+      if (ref[i] == test[i]) continue;
+      mf::LogProblem("driftpartitions_benchmark_test")
+        << "Point " << lar::dump::vector3D(points[i]) << " assigned to TPC "
+        << (test[i] ? std::string(test[i]->ID()) : "<none>") << " by " << what
+        << ", expected " << (ref[i] ? std::string(ref[i]->ID()) : "<none>");
+      ++nErrors;
+    }
+    return nErrors;
+  } // compareTPCs()
+
+} // local namespace
+
+/** ****************************************************************************
+ * @brief Runs the test
+ * @param argc number of arguments in argv
+ * @param argv arguments to the function
+ * @return number of detected errors (0 on success)
+ * @throw cet::exception most of error situations throw
+ *
+ * The arguments in argv are:
+ * 0. name of the executable ("driftpartitions_benchmark_test")
+ * 1. path to the FHiCL configuration file
+ * 2. number of repetitions of each lookup (default: 10)
+ * 3. number of steps of the grid of points on each side (default: 50)
+ *
+ */
+//------------------------------------------------------------------------------
+int main(int argc, char const** argv)
+{
+
+  //
+  // parameter parsing
+  //
+  if (argc < 2) throw std::runtime_error("No configuration file specified.");
+  std::string const configPath = argv[1];
+  unsigned int const nRep = (argc > 2) ? std::stoul(argv[2]) : 10U;
+  unsigned int const nSteps = (argc > 3) ? std::stoul(argv[3]) : 50U;
+
+  //
+  // testing environment setup
+  //
+  using namespace lar::standalone;
+
+  fhicl::ParameterSet const pset = ParseConfiguration(configPath);
+  SetupMessageFacility(pset, "driftpartitions_benchmark_test");
+
+  auto const geoConfig = pset.get<fhicl::ParameterSet>("services.Geometry");
+  auto const geom = SetupGeometry<geo::ChannelMapStandardAlg>(geoConfig);
+
+  //
+  // run the test
+  //
+  unsigned int nErrors = 0;
+  for (geo::CryostatGeo const& cryo : geom->Iterate<geo::CryostatGeo>()) {
+    geo::DriftPartitions const partition = geo::buildDriftVolumes(cryo);
+    geo::FlatDriftPartitions const flat{partition};
+
+    std::vector<geo::Point_t> const points = gridPoints(cryo.Boundaries(), nSteps);
+    std::size_t const nPoints = points.size();
+    std::vector<geo::TPCGeo const*> treeTPCs(nPoints), flatTPCs(nPoints), batchTPCs(nPoints);
+
+    double const treeTime = timeLookup(
+      [&]() {
+        for (std::size_t i = 0; i < nPoints; ++i)
+          treeTPCs[i] = partition.TPCat(points[i]);
+      },
+      nRep);
+    double const flatTime = timeLookup(
+      [&]() {
+        for (std::size_t i = 0; i < nPoints; ++i)
+          flatTPCs[i] = flat.TPCat(points[i]);
+      },
+      nRep);
+    double const batchTime =
+      timeLookup([&]() { flat.TPCat(nPoints, points.data(), batchTPCs.data()); }, nRep);
+
+    nErrors += compareTPCs(points, treeTPCs, flatTPCs, "the flattened partition");
+    nErrors += compareTPCs(points, treeTPCs, batchTPCs, "the flattened partition batch");
+
+    mf::LogVerbatim("driftpartitions_benchmark_test")
+      << cryo.ID() << ": lookup of " << nPoints << " points in " << flat.nVolumes()
+      << " drift volumes (average of " << nRep << "): " << (treeTime * 1000.0)
+      << " ms with the partition tree; " << (flatTime * 1000.0)
+      << " ms with the flattened partition; " << (batchTime * 1000.0) << " ms in batch";
+  } // cryostats
+
+  // and finally we cross fingers
+  if (nErrors > 0) {
+    mf::LogError("driftpartitions_benchmark_test") << nErrors << " errors detected!";
+  }
+
+  return nErrors;
+} // main()
@@ -17,12 +17,18 @@
 #include "larcorealg/CoreUtils/DumpUtils.h" // lar::dump::vector3D()
 #include "larcorealg/Geometry/ChannelMapStandardAlg.h"
 #include "larcorealg/Geometry/DriftPartitions.h" // BuildDriftVolumes()
+#include "larcorealg/Geometry/FlatDriftPartitions.h"
 #include "larcorealg/Geometry/GeometryCore.h"
 #include "larcorealg/TestUtils/geometry_unit_test_base.h"
 
 // utility libraries
 #include "messagefacility/MessageLogger/MessageLogger.h"
 
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <string>
+#include <vector>
+
 //------------------------------------------------------------------------------
 //---  The test environment
 //---
@@ -95,6 +101,11 @@ int main(int argc, char const** argv)
     mf::LogVerbatim("driftvolumes_test") << "Partition for cryostat " << cryo.ID() << ":";
     partition.print(mf::LogVerbatim("driftvolumes_test"));
 
+    // the flattened partition must give the same answers as the tree
+    geo::FlatDriftPartitions const flat{partition};
+    std::vector<geo::Point_t> points;
+    std::vector<geo::TPCGeo const*> expected;
+
     //
     // test that the partition topology is correct
     //
@@ -116,6 +127,8 @@ int main(int argc, char const** argv)
         where->PrintTPCInfo(log, "  ", /* verbosity */ 5);
         ++nErrors;
       }
+      points.push_back(center);
+      expected.push_back(where);
 
       //
       // test ownership of a uniform distribution of points inside the TPC
@@ -145,6 +158,14 @@ int main(int argc, char const** argv)
               where->PrintTPCInfo(log, "  ", /* verbosity */ 5);
               ++nErrors;
             }
+            points.push_back({x, y, z});
+            expected.push_back(where);
+
+            // also points on the border of the TPC, which may be shared
+            points.push_back({center.X() + xs * xstep,
+                              center.Y() + ys * ystep,
+                              center.Z() + ((zs < 0) ? -1.0 : 1.0) * TPC.HalfSizeZ()});
+            expected.push_back(partition.TPCat(points.back()));
 
           } // for zs
         }   // for ys
@@ -152,6 +173,17 @@ int main(int argc, char const** argv)
 
     } // for TPCs
 
+    std::vector<geo::TPCGeo const*> flatTPCs(points.size());
+    flat.TPCat(points.size(), points.data(), flatTPCs.data());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+      if ((flat.TPCat(points[i]) == expected[i]) && (flatTPCs[i] == expected[i])) continue;
+      mf::LogProblem("driftvolumes_test")
+        << "Point " << lar::dump::vector3D(points[i]) << " assigned to TPC "
+        << (expected[i] ? std::string(expected[i]->ID()) : "<none>")
+        << " by the partition, but not by its flattened version";
+      ++nErrors;
+    } // for points
+
   } // for
 
   // 4. And finally we cross fingers.
@@ -12,9 +12,14 @@
 
 // LArSoft libraries
 #include "larcorealg/CoreUtils/counter.h"
+#include "larcorealg/CoreUtils/enumerate.h"
 #include "larcorealg/Geometry/GeometryIDmapper.h"
 #include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
 
+// C/C++ standard libraries
+#include <string>
+#include <vector>
+
 //------------------------------------------------------------------------------
 void TPCIDmappingTest(geo::TPCIDmapper<> mapper, // copy here is intentional
                       std::size_t const NCryostats,
@@ -286,6 +291,38 @@ void PlaneIDmappingTest(geo::PlaneIDmapper<> mapper, // copy here is intentional
 
 } // PlaneIDmappingTest()
 
+//------------------------------------------------------------------------------
+void CompactPlaneIDmappingTest(geo::CompactPlaneIDmapper<> mapper, // copy here is intentional
+                               std::vector<geo::PlaneID> const& planes)
+{
+
+  using Mapper_t = geo::CompactPlaneIDmapper<>;
+
+  static_assert(mapper.dimensions() == 3U);
+  BOOST_TEST(!mapper.empty());
+  BOOST_TEST(mapper.size() == planes.size());
+
+  auto expected_index = Mapper_t::index_type{0};
+  for (geo::PlaneID const& expected_ID : planes) {
+    BOOST_TEST_CHECKPOINT("plane: " << std::string(expected_ID));
+    BOOST_TEST(mapper.hasElement(expected_ID));
+    BOOST_TEST(mapper.hasElement<geo::TPCID>(expected_ID));
+    BOOST_TEST(mapper.hasElement<geo::CryostatID>(expected_ID));
+    BOOST_TEST(mapper.index(expected_ID) == expected_index);
+    BOOST_TEST(mapper(expected_ID) == expected_index);
+    BOOST_TEST(mapper.ID(expected_index) == expected_ID);
+    BOOST_TEST(mapper.ID(expected_index).isValid);
+    BOOST_TEST(mapper(expected_index) == expected_ID);
+    ++expected_index;
+  } // for planes
+  BOOST_TEST(expected_index == mapper.size());
+
+  BOOST_TEST(!mapper.ID(mapper.size()).isValid);
+  BOOST_TEST(mapper.firstID() == planes.front());
+  BOOST_TEST(mapper.lastID() == planes.back());
+
+} // CompactPlaneIDmappingTest()
+
 BOOST_AUTO_TEST_SUITE(geoidmapper_test)
 
 //------------------------------------------------------------------------------
@@ -337,6 +374,76 @@ BOOST_AUTO_TEST_CASE(PlaneIDmappingTestCase)
 
 } // PlaneIDmappingTestCase
 
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(CompactPlaneIDmappingTestCase)
+{
+
+  //
+  // asymmetric detector: a different number of planes in each TPC;
+  // TPC C:0 T:2 does not exist at all, TPC C:1 T:0 exists with no planes
+  //
+  std::vector<geo::PlaneID> const planes{
+    {0, 0, 0},
+    {0, 0, 1},
+    {0, 0, 2},
+    {0, 1, 0},
+    {0, 1, 1},
+    {1, 1, 0},
+    {1, 2, 0},
+    {1, 2, 1},
+    {1, 2, 2},
+    {1, 2, 3},
+  };
+
+  //
+  // constructor from the existing IDs
+  //
+  geo::CompactPlaneIDmapper<> const mapper1{planes};
+  CompactPlaneIDmappingTest(mapper1, planes);
+
+  BOOST_TEST(mapper1.dimSize<0U>() == 2U);
+  BOOST_TEST(mapper1.dimSize<1U>() == 3U);
+  BOOST_TEST(mapper1.dimSize<2U>() == 4U);
+
+  BOOST_TEST(!mapper1.hasElement(geo::PlaneID{0, 0, 3}));
+  BOOST_TEST(!mapper1.hasElement(geo::PlaneID{0, 1, 2}));
+  BOOST_TEST(!mapper1.hasElement(geo::PlaneID{0, 2, 0}));
+  BOOST_TEST(!mapper1.hasElement(geo::PlaneID{1, 0, 0}));
+  BOOST_TEST(!mapper1.hasElement(geo::PlaneID{1, 1, 1}));
+  BOOST_TEST(!mapper1.hasElement(geo::PlaneID{1, 2, 4}));
+  BOOST_TEST(!mapper1.hasElement(geo::PlaneID{2, 0, 0}));
+  BOOST_TEST(!mapper1.hasElement<geo::TPCID>(geo::TPCID{0, 2}));
+  BOOST_TEST(mapper1.hasElement<geo::TPCID>(geo::TPCID{1, 0}));
+  BOOST_TEST(!mapper1.hasElement<geo::TPCID>(geo::TPCID{1, 3}));
+  BOOST_TEST(!mapper1.hasElement<geo::CryostatID>(geo::CryostatID{2}));
+
+  //
+  // default constructor + resize
+  //
+  geo::CompactPlaneIDmapper<> mapper2;
+  BOOST_TEST(mapper2.empty());
+
+  mapper2.resizeAs(mapper1);
+  CompactPlaneIDmappingTest(mapper2, planes);
+
+  mapper2.clear();
+  BOOST_TEST(mapper2.empty());
+
+  //
+  // TPC mapping from the same planes
+  //
+  std::vector<geo::TPCID> const TPCs{{0, 0}, {0, 1}, {1, 0}, {1, 1}, {1, 2}};
+  geo::CompactTPCIDmapper<> const TPCmapper{planes};
+  BOOST_TEST(TPCmapper.size() == TPCs.size());
+  for (auto const [index, TPCid] : util::enumerate(TPCs)) {
+    BOOST_TEST_CHECKPOINT("TPC: " << std::string(TPCid));
+    BOOST_TEST(TPCmapper.hasElement(TPCid));
+    BOOST_TEST(TPCmapper.index(TPCid) == index);
+    BOOST_TEST(TPCmapper.ID(index) == TPCid);
+  } // for TPCs
+
+} // CompactPlaneIDmappingTestCase
+
 //------------------------------------------------------------------------------
 
 BOOST_AUTO_TEST_SUITE_END()
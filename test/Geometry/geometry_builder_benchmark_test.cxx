@@ -0,0 +1,196 @@
+/**
+ * @file   geometry_builder_benchmark_test.cxx
+ * @brief  Benchmark of the construction of the geometry objects from ROOT.
+ * @date   October 16, 2026
+ *
+ * Usage:
+ *
+ *     geometry_builder_benchmark_test configuration.fcl [repetitions] [threads]
+ *
+ * The configuration file must contain a geometry service provider configuration
+ * under `services.Geometry`, for a geometry with the standard channel mapping.
+ *
+ * The geometry is set up once, to import the ROOT geometry; then all the
+ * cryostats are extracted from it repeatedly by `geo::GeometryBuilderStandard`,
+ * which composes the transformation of each object incrementally from the one
+ * of its container, and by a reference builder which composes the
+ * transformation of each wire from the root node as it used to be done.
+ * The cryostats are also extracted by a builder constructing the wires with
+ * multiple threads (by default, 4), to verify that it is deterministic.
+ * The average time of each is reported, and all the wires from all of them
+ * must be identical.
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/ChannelMapStandardAlg.h"
+#include "larcorealg/Geometry/GeometryBuilderStandard.h"
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "larcorealg/Geometry/StandaloneBasicSetup.h"    // SetupMessageFacility()...
+#include "larcorealg/Geometry/StandaloneGeometrySetup.h" // SetupGeometry()
+#include "larcorealg/TestUtils/StopWatch.h"
+
+// utility libraries
+#include "fhiclcpp/ParameterSet.h"
+#include "fhiclcpp/types/Table.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// ROOT libraries
+#include "TGeoManager.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------------
+//---  The tests
+//---
+
+namespace {
+
+  /// Standard builder, but with wire transformations composed from the root.
+  class FullPathGeometryBuilder : public geo::GeometryBuilderStandard {
+  public:
+    using geo::GeometryBuilderStandard::GeometryBuilderStandard;
+
+  protected:
+    virtual geo::WireGeo doMakeWire(Path_t& path) override
+    {
+      auto const& nodes = path.nodes();
+      return geo::WireGeo{
+        path.current(),
+        geo::transformationFromPath<geo::TransformationMatrix>(nodes.begin(), nodes.end())};
+    }
+  }; // FullPathGeometryBuilder
+
+  /// Returns the time [s] to extract all the cryostats, averaged on `nRep`.
+  double timeBuilder(geo::GeometryBuilder& builder,
+                     unsigned int nRep,
+                     geo::GeometryBuilder::Cryostats_t& cryostats)
+  {
+    geo::GeoNodePath const path{gGeoManager->GetTopNode()};
+    testing::StopWatch<> timer;
+    for (unsigned int iRep = 0; iRep < nRep; ++iRep)
+      cryostats = builder.extractCryostats(path);
+    return timer.elapsed() / nRep;
+  } // timeBuilder()
+
+  /// Returns the number of wires differing between the two cryostat lists.
+  unsigned int compareWires(geo::GeometryBuilder::Cryostats_t const& ref,
+                            geo::GeometryBuilder::Cryostats_t const& test,
+                            unsigned int& nWires)
+  {
+    unsigned int nErrors = 0;
+    nWires = 0;
+    if (ref.size() != test.size()) return 1U;
+    for (std::size_t c = 0; c < ref.size(); ++c) {
+      if (ref[c].NTPC() != test[c].NTPC()) return ++nErrors;
+      for (unsigned int t = 0; t < ref[c].NTPC(); ++t) {
+        geo::TPCGeo const& refTPC = ref[c].TPC(t);
+        geo::TPCGeo const& testTPC = test[c].TPC(t);
+        if (refTPC.Nplanes() != testTPC.Nplanes()) return ++nErrors;
+        for (unsigned int p = 0; p < refTPC.Nplanes(); ++p) {
+          geo::PlaneGeo const& refPlane = refTPC.Plane(p);
+          geo::PlaneGeo const& testPlane = testTPC.Plane(p);
+          if (refPlane.Nwires() != testPlane.Nwires()) return ++nErrors;
+          for (unsigned int w = 0; w < refPlane.Nwires(); ++w, ++nWires) {
+            geo::WireGeo const& refWire = refPlane.Wire(w);
+            geo::WireGeo const& testWire = testPlane.Wire(w);
+            if ((refWire.GetStart() == testWire.GetStart()) &&
+                (refWire.GetEnd() == testWire.GetEnd()))
+              continue;
+            mf::LogProblem("geometry_builder_benchmark_test")
+              << "Wire #" << w << " of plane #" << p << " of TPC #" << t << " of cryostat #" << c
+              << ": " << testWire.WireInfo() << ", expected " << refWire.WireInfo();
+            ++nErrors;
+          } // wires
+        }   // planes
+      }     // TPCs
+    }       // cryostats
+    return nErrors;
+  } // compareWires()
+
+} // local namespace
+
+/** ****************************************************************************
+ * @brief Runs the test
+ * @param argc number of arguments in argv
+ * @param argv arguments to the function
+ * @return number of detected errors (0 on success)
+ * @throw cet::exception most of error situations throw
+ *
+ * The arguments in argv are:
+ * 0. name of the executable ("geometry_builder_benchmark_test")
+ * 1. path to the FHiCL configuration file
+ * 2. number of repetitions of each build (default: 10)
+ * 3. number of threads of the multi-thread build (default: 4)
+ *
+ */
+//------------------------------------------------------------------------------
+int main(int argc, char const** argv)
+{
+
+  //
+  // parameter parsing
+  //
+  if (argc < 2) throw std::runtime_error("No configuration file specified.");
+  std::string const configPath = argv[1];
+  unsigned int const nRep = (argc > 2) ? std::stoul(argv[2]) : 10U;
+  unsigned int const nThreads = (argc > 3) ? std::stoul(argv[3]) : 4U;
+
+  //
+  // testing environment setup
+  //
+  using namespace lar::standalone;
+
+  fhicl::ParameterSet const pset = ParseConfiguration(configPath);
+  SetupMessageFacility(pset, "geometry_builder_benchmark_test");
+
+  auto const geoConfig = pset.get<fhicl::ParameterSet>("services.Geometry");
+  auto const geom = SetupGeometry<geo::ChannelMapStandardAlg>(geoConfig);
+
+  auto const builderPSet = geoConfig.get<fhicl::ParameterSet>("Builder", fhicl::ParameterSet());
+  fhicl::Table<geo::GeometryBuilderStandard::Config> const builderConfig(builderPSet,
+                                                                         {"tool_type"});
+
+  fhicl::ParameterSet parallelPSet = builderPSet;
+  parallelPSet.put_or_replace("threads", nThreads);
+  fhicl::Table<geo::GeometryBuilderStandard::Config> const parallelConfig(parallelPSet,
+                                                                          {"tool_type"});
+
+  //
+  // run the test
+  //
+  geo::GeometryBuilderStandard builder{builderConfig()};
+  geo::GeometryBuilder::Cryostats_t cryostats;
+  double const time = timeBuilder(builder, nRep, cryostats);
+
+  FullPathGeometryBuilder refBuilder{builderConfig()};
+  geo::GeometryBuilder::Cryostats_t refCryostats;
+  double const refTime = timeBuilder(refBuilder, nRep, refCryostats);
+
+  // each repetition is compared, since different runs may split work differently
+  geo::GeometryBuilderStandard parallelBuilder{parallelConfig()};
+  geo::GeometryBuilder::Cryostats_t parallelCryostats;
+  double parallelTime = 0.0;
+  unsigned int nWires = 0;
+  unsigned int nErrors = compareWires(refCryostats, cryostats, nWires);
+  for (unsigned int iRep = 0; iRep < nRep; ++iRep) {
+    parallelTime += timeBuilder(parallelBuilder, 1U, parallelCryostats) / nRep;
+    nErrors += compareWires(cryostats, parallelCryostats, nWires);
+  }
+
+  mf::LogVerbatim("geometry_builder_benchmark_test")
+    << "Extraction of " << cryostats.size() << " cryostats with " << nWires
+    << " wires (average of " << nRep << "): " << (time * 1000.0)
+    << " ms; with transformations from the root node: " << (refTime * 1000.0)
+    << " ms; with " << nThreads << " threads: " << (parallelTime * 1000.0) << " ms";
+
+  // and finally we cross fingers
+  if (nErrors > 0) {
+    mf::LogError("geometry_builder_benchmark_test") << nErrors << " errors detected!";
+  }
+
+  return nErrors;
+} // main()
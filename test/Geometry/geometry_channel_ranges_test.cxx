@@ -0,0 +1,199 @@
+/**
+ * @file   geometry_channel_ranges_test.cxx
+ * @brief  Test of the precomputed channel ranges against the channel mapping.
+ * @date   October 16, 2026
+ *
+ * Usage:
+ *
+ *     geometry_channel_ranges_test configuration.fcl
+ *
+ * The configuration file must contain a geometry service provider configuration
+ * under `services.Geometry`, for a geometry with the standard channel mapping.
+ *
+ * The range of each readout plane must match its first channel and number of
+ * channels; the ranges of each TPC set must cover exactly the channels of its
+ * readout planes. Each channel of the wires of a TPC must be in the ranges of
+ * that TPC. The list of the channels in TPCs (`ChannelsInTPCs()`) must be the
+ * same, element by element, as the one computed from the wires of the TPCs of
+ * each TPC set, as `geo::GeometryCore` used to compute it before the range
+ * table was introduced.
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/ChannelMapStandardAlg.h"
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "larcorealg/Geometry/StandaloneBasicSetup.h"    // SetupMessageFacility()...
+#include "larcorealg/Geometry/StandaloneGeometrySetup.h" // SetupGeometry()
+
+// utility libraries
+#include "fhiclcpp/ParameterSet.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::sort(), std::unique(), std::mismatch()
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------------
+//---  The tests
+//---
+
+namespace {
+
+  /// Counts a mismatch between `a` and `b` of the object described by `what`.
+  template <typename T>
+  unsigned int check(T const& a, T const& b, std::string const& what)
+  {
+    if (a == b) return 0U;
+    mf::LogProblem("geometry_channel_ranges_test")
+      << what << ": " << a << " expected, " << b << " from the range table";
+    return 1U;
+  } // check()
+
+  /// Returns whether `channel` is in any of the `ranges`.
+  template <typename Ranges>
+  bool inRanges(Ranges const& ranges, raw::ChannelID_t channel)
+  {
+    for (geo::ChannelRange const& range : ranges)
+      if (range.contains(channel)) return true;
+    return false;
+  } // inRanges()
+
+  /// Returns the number of channels in all the `ranges`.
+  template <typename Ranges>
+  unsigned int countChannels(Ranges const& ranges)
+  {
+    unsigned int n = 0;
+    for (geo::ChannelRange const& range : ranges)
+      n += range.size();
+    return n;
+  } // countChannels()
+
+  /// Compares the ranges of readout planes and TPC sets with the channel map.
+  unsigned int checkReadoutRanges(geo::GeometryCore const& geom)
+  {
+    unsigned int nErrors = 0;
+    for (readout::TPCsetID const& tpcsetid : geom.Iterate<readout::TPCsetID>()) {
+      auto const tpcsetRanges = geom.ChannelRangesInTPCset(tpcsetid);
+      unsigned int nTPCsetChannels = 0;
+      for (readout::ROPID const& ropid : geom.Iterate<readout::ROPID>(tpcsetid)) {
+        std::string const id = std::string(ropid);
+        auto const ropRanges = geom.ChannelRangesInROP(ropid);
+        unsigned int const nChannels = geom.Nchannels(ropid);
+        nErrors += check<std::size_t>((nChannels > 0U) ? 1U : 0U, ropRanges.size(), id + " ranges");
+        if (ropRanges.empty()) continue;
+        geo::ChannelRange const& range = *ropRanges.begin();
+        nErrors += check(geom.FirstChannelInROP(ropid), range.first, id + " first channel");
+        nErrors += check(nChannels, range.size(), id + " channels");
+        nErrors += check(true, inRanges(tpcsetRanges, range.first), id + " in TPC set");
+        nErrors += check(true, inRanges(tpcsetRanges, range.end - 1U), id + " in TPC set");
+        nTPCsetChannels += nChannels;
+      } // ROPs
+      nErrors += check(nTPCsetChannels,
+                       countChannels(tpcsetRanges),
+                       std::string(tpcsetid) + " channels");
+    } // TPC sets
+    return nErrors;
+  } // checkReadoutRanges()
+
+  /// Checks that all the channels of the wires of each TPC are in its ranges.
+  unsigned int checkTPCranges(geo::GeometryCore const& geom)
+  {
+    unsigned int nErrors = 0;
+    for (geo::TPCGeo const& tpc : geom.Iterate<geo::TPCGeo>()) {
+      auto const tpcRanges = geom.ChannelRangesInTPC(tpc.ID());
+      for (geo::WireID const& wireID : geom.Iterate<geo::WireID>(tpc.ID())) {
+        raw::ChannelID_t const channel = geom.PlaneWireToChannel(wireID);
+        nErrors += check(true, inRanges(tpcRanges, channel), std::string(wireID) + " in TPC");
+      }
+    } // TPCs
+    return nErrors;
+  } // checkTPCranges()
+
+  /// Returns the channels in TPCs as `geo::GeometryCore::ChannelsInTPCs()` did
+  /// before the range table was introduced.
+  std::vector<raw::ChannelID_t> channelsInTPCsFromWires(geo::GeometryCore const& geom)
+  {
+    std::vector<raw::ChannelID_t> channels;
+    channels.reserve(geom.Nchannels());
+
+    for (auto const& ts : geom.Iterate<readout::TPCsetID>()) {
+      for (auto const t : geom.TPCsetToTPCs(ts)) {
+        for (auto const& wire : geom.Iterate<geo::WireID>(t)) {
+          channels.push_back(geom.PlaneWireToChannel(wire));
+        }
+      }
+    }
+    std::sort(channels.begin(), channels.end());
+    auto last = std::unique(channels.begin(), channels.end());
+    channels.erase(last, channels.end());
+    return channels;
+  } // channelsInTPCsFromWires()
+
+  /// Compares `ChannelsInTPCs()` with the list computed from the wires.
+  unsigned int checkChannelsInTPCs(geo::GeometryCore const& geom)
+  {
+    std::vector<raw::ChannelID_t> const expected = channelsInTPCsFromWires(geom);
+    std::vector<raw::ChannelID_t> const& channels = geom.ChannelsInTPCs();
+
+    unsigned int nErrors = check(expected.size(), channels.size(), "number of channels in TPCs");
+    auto const [iExpected, iChannel] =
+      std::mismatch(expected.begin(), expected.end(), channels.begin(), channels.end());
+    if ((iExpected != expected.end()) && (iChannel != channels.end())) {
+      nErrors += check(*iExpected,
+                       *iChannel,
+                       "channel in TPCs #" + std::to_string(iExpected - expected.begin()));
+    }
+    return nErrors;
+  } // checkChannelsInTPCs()
+
+} // local namespace
+
+/** ****************************************************************************
+ * @brief Runs the test
+ * @param argc number of arguments in argv
+ * @param argv arguments to the function
+ * @return number of detected errors (0 on success)
+ * @throw cet::exception most of error situations throw
+ *
+ * The arguments in argv are:
+ * 0. name of the executable ("geometry_channel_ranges_test")
+ * 1. path to the FHiCL configuration file
+ *
+ */
+//------------------------------------------------------------------------------
+int main(int argc, char const** argv)
+{
+
+  //
+  // parameter parsing
+  //
+  if (argc < 2) throw std::runtime_error("No configuration file specified.");
+  std::string const configPath = argv[1];
+
+  //
+  // testing environment setup
+  //
+  using namespace lar::standalone;
+
+  fhicl::ParameterSet const pset = ParseConfiguration(configPath);
+  SetupMessageFacility(pset, "geometry_channel_ranges_test");
+
+  auto const geoConfig = pset.get<fhicl::ParameterSet>("services.Geometry");
+  auto const geom = SetupGeometry<geo::ChannelMapStandardAlg>(geoConfig);
+
+  //
+  // run the test
+  //
+  unsigned int nErrors = checkReadoutRanges(*geom);
+  nErrors += checkTPCranges(*geom);
+  nErrors += checkChannelsInTPCs(*geom);
+
+  // and finally we cross fingers
+  if (nErrors > 0) {
+    mf::LogError("geometry_channel_ranges_test") << nErrors << " errors detected!";
+  }
+
+  return nErrors;
+} // main()
@@ -0,0 +1,193 @@
+/**
+ * @file   geometry_drift_partition_lookup_test.cxx
+ * @brief  Test of the TPC lookup via drift partitions against the linear scan.
+ * @date   October 16, 2026
+ *
+ * Usage:
+ *
+ *     geometry_drift_partition_lookup_test configuration.fcl [threads]
+ *
+ * The configuration file must contain a geometry service provider configuration
+ * under `services.Geometry`, for a geometry with the standard channel mapping
+ * and with `DriftPartitionLookup` enabled.
+ *
+ * The drift partitions are first requested from many threads (by default, 4)
+ * at the same time, which must all get the same object. Then the TPC found
+ * by the geometry is compared with the one from a linear scan of cryostats and
+ * TPCs, on a grid of points covering each cryostat and some space around it,
+ * and on points on the faces of each TPC and just beyond them.
+ */
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/DumpUtils.h" // lar::dump::vector3D()
+#include "larcorealg/Geometry/ChannelMapStandardAlg.h"
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "larcorealg/Geometry/StandaloneBasicSetup.h"    // SetupMessageFacility()...
+#include "larcorealg/Geometry/StandaloneGeometrySetup.h" // SetupGeometry()
+
+// utility libraries
+#include "fhiclcpp/ParameterSet.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+//------------------------------------------------------------------------------
+//---  The tests
+//---
+
+namespace {
+
+  /// Returns the TPC containing `point` by scanning all cryostats and TPCs.
+  geo::TPCGeo const* linearScan(geo::GeometryCore const& geom, geo::Point_t const& point)
+  {
+    double const wiggle = 1.0 + geom.DefaultWiggle();
+    for (geo::CryostatGeo const& cryo : geom.Iterate<geo::CryostatGeo>()) {
+      if (cryo.ContainsPosition(point, wiggle)) return cryo.PositionToTPCptr(point, wiggle);
+    }
+    return nullptr;
+  } // linearScan()
+
+  /// Compares the lookup at `point` with the linear scan.
+  unsigned int checkPoint(geo::GeometryCore const& geom, geo::Point_t const& point)
+  {
+    geo::TPCGeo const* expected = linearScan(geom, point);
+    geo::TPCGeo const* tpc = geom.PositionToTPCptr(point);
+    geo::TPCID const tpcid = geom.FindTPCAtPosition(point);
+    if ((tpc == expected) && (tpcid.isValid == (expected != nullptr)) &&
+        (!expected || (tpcid == expected->ID())))
+      return 0U;
+
+    mf::LogProblem("geometry_drift_partition_lookup_test")
+      << "Point " << lar::dump::vector3D(point) << " assigned to "
+      << (tpc ? std::string(tpc->ID()) : "no TPC") << " (" << std::string(tpcid)
+      << " by FindTPCAtPosition()), expected "
+      << (expected ? std::string(expected->ID()) : "no TPC");
+    return 1U;
+  } // checkPoint()
+
+  /// Compares the lookup with the linear scan on a grid around each cryostat.
+  unsigned int checkGrid(geo::GeometryCore const& geom, unsigned int nSteps)
+  {
+    unsigned int nErrors = 0;
+    for (geo::CryostatGeo const& cryo : geom.Iterate<geo::CryostatGeo>()) {
+      geo::BoxBoundedGeo const& box = cryo.Boundaries();
+      geo::Vector_t const margin = 0.1 * (box.Max() - box.Min());
+      geo::Point_t const min = box.Min() - margin;
+      geo::Vector_t const step = (box.Max() + margin - min) / static_cast<double>(nSteps);
+      for (unsigned int i = 0; i <= nSteps; ++i)
+        for (unsigned int j = 0; j <= nSteps; ++j)
+          for (unsigned int k = 0; k <= nSteps; ++k)
+            nErrors += checkPoint(
+              geom, {min.X() + i * step.X(), min.Y() + j * step.Y(), min.Z() + k * step.Z()});
+    } // for cryostats
+    return nErrors;
+  } // checkGrid()
+
+  /// Compares the lookup with the linear scan on and around the TPC faces.
+  unsigned int checkTPCfaces(geo::GeometryCore const& geom)
+  {
+    // just inside the tolerance, and just beyond it
+    double const shifts[] = {0.0, 0.5 * geom.DefaultWiggle(), 2.0 * geom.DefaultWiggle()};
+
+    unsigned int nErrors = 0;
+    for (geo::TPCGeo const& tpc : geom.Iterate<geo::TPCGeo>()) {
+      geo::Point_t const center = tpc.GetCenter();
+      geo::Vector_t const half{tpc.HalfSizeX(), tpc.HalfSizeY(), tpc.HalfSizeZ()};
+      for (double const shift : shifts) {
+        for (int side : {-1, +1}) {
+          double const f = side * (1.0 + shift);
+          nErrors += checkPoint(geom, {center.X() + f * half.X(), center.Y(), center.Z()});
+          nErrors += checkPoint(geom, {center.X(), center.Y() + f * half.Y(), center.Z()});
+          nErrors += checkPoint(geom, {center.X(), center.Y(), center.Z() + f * half.Z()});
+          nErrors += checkPoint(geom,
+                                {center.X() + f * half.X(),
+                                 center.Y() + f * half.Y(),
+                                 center.Z() + f * half.Z()});
+        } // for sides
+      }   // for shifts
+    }     // for TPCs
+    return nErrors;
+  } // checkTPCfaces()
+
+  /// Requests the drift partitions from `nThreads` threads at the same time.
+  unsigned int checkConcurrentBuild(geo::GeometryCore const& geom, unsigned int nThreads)
+  {
+    std::vector<geo::DetectorDriftPartitions const*> partitions(nThreads, nullptr);
+    std::vector<std::thread> threads;
+    for (unsigned int iThread = 0; iThread < nThreads; ++iThread)
+      threads.emplace_back(
+        [&geom, &partitions, iThread]() { partitions[iThread] = &geom.GetDriftPartitions(); });
+    for (std::thread& thread : threads)
+      thread.join();
+
+    unsigned int nErrors = 0;
+    for (unsigned int iThread = 1; iThread < nThreads; ++iThread) {
+      if (partitions[iThread] == partitions[0]) continue;
+      mf::LogProblem("geometry_drift_partition_lookup_test")
+        << "Thread #" << iThread << " got different drift partitions than thread #0";
+      ++nErrors;
+    }
+    if (geom.GetDriftPartitions().nCryostats() != geom.Ncryostats()) {
+      mf::LogProblem("geometry_drift_partition_lookup_test")
+        << "Drift partitions cover " << geom.GetDriftPartitions().nCryostats() << " cryostats, "
+        << geom.Ncryostats() << " expected";
+      ++nErrors;
+    }
+    return nErrors;
+  } // checkConcurrentBuild()
+
+} // local namespace
+
+/** ****************************************************************************
+ * @brief Runs the test
+ * @param argc number of arguments in argv
+ * @param argv arguments to the function
+ * @return number of detected errors (0 on success)
+ * @throw cet::exception most of error situations throw
+ *
+ * The arguments in argv are:
+ * 0. name of the executable ("geometry_drift_partition_lookup_test")
+ * 1. path to the FHiCL configuration file
+ * 2. number of threads requesting the partitions (default: 4)
+ *
+ */
+//------------------------------------------------------------------------------
+int main(int argc, char const** argv)
+{
+
+  //
+  // parameter parsing
+  //
+  if (argc < 2) throw std::runtime_error("No configuration file specified.");
+  std::string const configPath = argv[1];
+  unsigned int const nThreads = (argc > 2) ? std::stoul(argv[2]) : 4U;
+
+  //
+  // testing environment setup
+  //
+  using namespace lar::standalone;
+
+  fhicl::ParameterSet const pset = ParseConfiguration(configPath);
+  SetupMessageFacility(pset, "geometry_drift_partition_lookup_test");
+
+  auto const geoConfig = pset.get<fhicl::ParameterSet>("services.Geometry");
+  auto const geom = SetupGeometry<geo::ChannelMapStandardAlg>(geoConfig);
+
+  //
+  // run the test
+  //
+  unsigned int nErrors = checkConcurrentBuild(*geom, nThreads);
+  nErrors += checkGrid(*geom, 40U);
+  nErrors += checkTPCfaces(*geom);
+
+  // and finally we cross fingers
+  if (nErrors > 0) {
+    mf::LogError("geometry_drift_partition_lookup_test") << nErrors << " errors detected!";
+  }
+
+  return nErrors;
+} // main()
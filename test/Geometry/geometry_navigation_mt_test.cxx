@@ -0,0 +1,302 @@
+/**
+ * @file   geometry_navigation_mt_test.cxx
+ * @brief  Stress test for concurrent geometry navigation queries.
+ * @date   October 16, 2026
+ *
+ * Usage:
+ *
+ *     geometry_navigation_mt_test configuration.fcl [GeometryParameterSetPath]
+ *
+ * The configuration file must contain a geometry service provider configuration
+ * under `services.Geometry`, That geometry configuration must use the standard
+ * channel mapping and enable multi-thread navigation via `NavigationThreads`.
+ *
+ * The test runs the same set of navigation queries (`MassBetweenPoints()`,
+ * `Material()` and `VolumeName()`) first in a single thread, and then
+ * concurrently in an increasing number of threads, up to the configured one.
+ * All concurrent results must match the single-thread ones.
+ * Each thread must be served by its own navigator, the same one for all its
+ * queries, and all the threads must be running their queries at the same time
+ * (they wait for each other after their first query).
+ * The time spent at each level of concurrency is reported, together with the
+ * speed-up with respect to the single thread: since the amount of work per
+ * thread is fixed, the time should stay about constant.
+ * When the hardware can run all the threads at once, concurrent navigation
+ * must be faster than running the same queries in a single thread.
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/BoxBoundedGeo.h"
+#include "larcorealg/Geometry/ChannelMapStandardAlg.h"
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "larcorealg/TestUtils/StopWatch.h"
+#include "larcorealg/TestUtils/geometry_unit_test_base.h"
+
+// utility libraries
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// ROOT libraries
+#include "TGeoManager.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::max(), std::sort(), std::unique()
+#include <atomic>
+#include <chrono>
+#include <cmath>    // std::abs()
+#include <cstddef>  // std::size_t
+#include <iterator> // std::distance()
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+//------------------------------------------------------------------------------
+//---  The test environment
+//---
+
+// we define here all the configuration that is needed;
+// we use an existing class provided for this purpose, since our test
+// environment allows us to tailor it at run time.
+using StandardGeometryConfiguration =
+  testing::BasicGeometryEnvironmentConfiguration<geo::ChannelMapStandardAlg>;
+
+/*
+ * GeometryTesterFixture, configured with the object above, is used in a
+ * non-Boost-unit-test context.
+ * It provides:
+ * - `geo::GeometryCore const* Geometry()`
+ * - `geo::GeometryCore const* GlobalGeometry()` (static member)
+ */
+using StandardGeometryTestEnvironment =
+  testing::GeometryTesterEnvironment<StandardGeometryConfiguration>;
+
+//------------------------------------------------------------------------------
+//---  The tests
+//---
+
+namespace {
+
+  /// A query and its results.
+  struct NavigationQuery {
+    geo::Point_t start;             ///< Start of the segment, and point queried.
+    geo::Point_t end;               ///< End of the segment.
+    double mass = 0.0;              ///< Result of `MassBetweenPoints()`.
+    TGeoMaterial const* material{}; ///< Result of `Material()`.
+    std::string volume;             ///< Result of `VolumeName()`.
+  }; // NavigationQuery
+
+  /// Creates `nQueries` random segments within the central part of `box`.
+  std::vector<NavigationQuery> makeQueries(geo::BoxBoundedGeo const& box, std::size_t nQueries)
+  {
+    std::mt19937 engine{12345U}; // fixed seed: the test is reproducible
+    auto const center = box.Center();
+    std::uniform_real_distribution<double> dx{-0.45 * box.SizeX(), 0.45 * box.SizeX()};
+    std::uniform_real_distribution<double> dy{-0.45 * box.SizeY(), 0.45 * box.SizeY()};
+    std::uniform_real_distribution<double> dz{-0.45 * box.SizeZ(), 0.45 * box.SizeZ()};
+    auto randomPoint = [&]() {
+      return geo::Point_t{
+        center.X() + dx(engine), center.Y() + dy(engine), center.Z() + dz(engine)};
+    };
+
+    std::vector<NavigationQuery> queries(nQueries);
+    for (NavigationQuery& query : queries) {
+      query.start = randomPoint();
+      do {
+        query.end = randomPoint();
+      } while (query.end == query.start);
+    }
+    return queries;
+  } // makeQueries()
+
+  /// Runs all the queries from `first` with stride `step`, storing results.
+  void runQueries(geo::GeometryCore const& geom,
+                  std::vector<NavigationQuery>& queries,
+                  std::size_t first,
+                  std::size_t step)
+  {
+    for (std::size_t i = first; i < queries.size(); i += step) {
+      NavigationQuery& query = queries[i];
+      query.mass = geom.MassBetweenPoints(query.start, query.end);
+      query.material = geom.Material(query.start);
+      query.volume = geom.VolumeName(query.start);
+    }
+  } // runQueries()
+
+  /// Returns the number of results in `test` different from `ref`.
+  unsigned int compareResults(std::vector<NavigationQuery> const& ref,
+                              std::vector<NavigationQuery> const& test,
+                              unsigned int nThreads)
+  {
+    unsigned int nErrors = 0;
+    for (std::size_t i = 0; i < ref.size(); ++i) {
+      NavigationQuery const& expected = ref[i];
+      NavigationQuery const& actual = test[i];
+      double const tolerance = 1e-9 * std::max(1.0, std::abs(expected.mass));
+      if ((std::abs(actual.mass - expected.mass) <= tolerance) &&
+          (actual.material == expected.material) && (actual.volume == expected.volume))
+        continue;
+      mf::LogProblem("geometry_navigation_mt_test")
+        << "Query #" << i << " from " << expected.start << " to " << expected.end << " with "
+        << nThreads << " threads: mass " << actual.mass << " (expected: " << expected.mass
+        << "), volume '" << actual.volume << "' (expected: '" << expected.volume << "'), "
+        << (actual.material == expected.material ? "same" : "different") << " material";
+      ++nErrors;
+    } // for
+    return nErrors;
+  } // compareResults()
+
+  /// Returns the number of threads sharing a navigator, or lacking one.
+  unsigned int checkNavigators(std::vector<TGeoNavigator const*> navigators)
+  {
+    unsigned int nErrors = std::count(navigators.begin(), navigators.end(), nullptr);
+    std::sort(navigators.begin(), navigators.end());
+    auto const iUnique = std::unique(navigators.begin(), navigators.end());
+    nErrors += std::distance(iUnique, navigators.end());
+    return nErrors;
+  } // checkNavigators()
+
+} // local namespace
+
+/** ****************************************************************************
+ * @brief Runs the test
+ * @param argc number of arguments in argv
+ * @param argv arguments to the function
+ * @return number of detected errors (0 on success)
+ * @throw cet::exception most of error situations throw
+ *
+ * The arguments in argv are:
+ * 0. name of the executable ("geometry_navigation_mt_test")
+ * 1. path to the FHiCL configuration file
+ * 2. FHiCL path to the configuration of the geometry
+ *    (default: services.Geometry)
+ *
+ */
+//------------------------------------------------------------------------------
+int main(int argc, char const** argv)
+{
+
+  StandardGeometryConfiguration config("geometry_navigation_mt_test");
+
+  //
+  // parameter parsing
+  //
+  int iParam = 0;
+
+  // first argument: configuration file (mandatory)
+  if (++iParam < argc) config.SetConfigurationPath(argv[iParam]);
+
+  // second argument: path of the parameter set for geometry configuration
+  // (optional; default: "services.Geometry" from the inherited object)
+  if (++iParam < argc) config.SetGeometryParameterSetPath(argv[iParam]);
+
+  //
+  // testing environment setup
+  //
+  StandardGeometryTestEnvironment TestEnvironment(config);
+  auto const& geom = *(TestEnvironment.Provider<geo::GeometryCore>());
+
+  TGeoManager const* manager = geom.ROOTGeoManager();
+  if (!manager->IsMultiThread()) {
+    mf::LogError("geometry_navigation_mt_test")
+      << "ROOT geometry is not in multi-thread mode: set `NavigationThreads`.";
+    return 1;
+  }
+  unsigned int const maxThreads = std::max(manager->GetMaxThreads(), 1);
+
+  //
+  // run the test
+  //
+  constexpr std::size_t QueriesPerThread = 2000;
+  constexpr double MinSpeedUp = 1.1; // loose, to survive busy machines
+  std::vector<NavigationQuery> const refQueries =
+    makeQueries(geom.WorldBox(), QueriesPerThread * maxThreads);
+
+  unsigned int nErrors = 0;
+
+  // single thread reference; the work of one thread is timed separately
+  std::vector<NavigationQuery> reference = refQueries;
+  testing::StopWatch<> timer;
+  runQueries(geom, reference, 0, maxThreads);
+  double const singleThreadTime = timer.elapsed();
+  runQueries(geom, reference, 0, 1);
+
+  mf::LogVerbatim log("geometry_navigation_mt_test");
+  log << "Navigation queries (" << QueriesPerThread << " per thread):"
+      << "\n  1 thread: " << (singleThreadTime * 1000.0) << " ms";
+
+  for (unsigned int nThreads = 2; nThreads <= maxThreads; nThreads *= 2) {
+    std::vector<NavigationQuery> results = refQueries;
+    results.resize(QueriesPerThread * nThreads);
+
+    // all threads start together, to maximise contention;
+    // after the first query each thread waits for all the others to be
+    // running too, which proves the queries are actually concurrent
+    std::atomic<bool> go{false};
+    std::atomic<unsigned int> nRunning{0U};
+    std::atomic<unsigned int> nMissedRendezvous{0U};
+    std::atomic<unsigned int> nUnstableNavigators{0U};
+    std::vector<TGeoNavigator const*> navigators(nThreads, nullptr);
+    std::vector<std::thread> threads;
+    for (unsigned int iThread = 0; iThread < nThreads; ++iThread) {
+      threads.emplace_back([&, iThread]() {
+        while (!go.load()) {}
+        navigators[iThread] = geom.ROOTGeoNavigator();
+        runQueries(geom, results, iThread, results.size()); // just the first one
+        ++nRunning;
+        auto const timeout = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+        while (nRunning.load() < nThreads) {
+          if (std::chrono::steady_clock::now() > timeout) {
+            ++nMissedRendezvous;
+            break;
+          }
+          std::this_thread::yield();
+        }
+        runQueries(geom, results, iThread + nThreads, nThreads);
+        if (geom.ROOTGeoNavigator() != navigators[iThread]) ++nUnstableNavigators;
+      });
+    }
+    timer.restart();
+    go.store(true);
+    for (std::thread& thread : threads)
+      thread.join();
+    double const time = timer.elapsed();
+
+    if (nMissedRendezvous > 0U) {
+      mf::LogProblem("geometry_navigation_mt_test")
+        << nMissedRendezvous << "/" << nThreads << " threads did not run concurrently";
+      nErrors += nMissedRendezvous;
+    }
+    if (nUnstableNavigators > 0U) {
+      mf::LogProblem("geometry_navigation_mt_test")
+        << nUnstableNavigators << "/" << nThreads << " threads changed navigator";
+      nErrors += nUnstableNavigators;
+    }
+    if (unsigned int const nShared = checkNavigators(navigators); nShared > 0U) {
+      mf::LogProblem("geometry_navigation_mt_test")
+        << nShared << "/" << nThreads << " threads have no navigator of their own";
+      nErrors += nShared;
+    }
+
+    std::vector<NavigationQuery> expected{reference.begin(), reference.begin() + results.size()};
+    nErrors += compareResults(expected, results, nThreads);
+
+    double const speedUp = singleThreadTime * nThreads / time;
+    log << "\n  " << nThreads << " threads: " << (time * 1000.0) << " ms (speed-up: " << speedUp
+        << " over " << nThreads << " ideal)";
+
+    // navigation serialized among threads would give no speed-up at all
+    if ((nThreads <= std::thread::hardware_concurrency()) && (speedUp < MinSpeedUp)) {
+      mf::LogProblem("geometry_navigation_mt_test")
+        << nThreads << " threads are only " << speedUp << " times faster than one (expected: "
+        << MinSpeedUp << " or more)";
+      ++nErrors;
+    }
+  } // for threads
+
+  // and finally we cross fingers
+  if (nErrors > 0) {
+    mf::LogError("geometry_navigation_mt_test") << nErrors << " errors detected!";
+  }
+
+  return nErrors;
+} // main()
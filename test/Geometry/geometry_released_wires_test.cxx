@@ -0,0 +1,194 @@
+/**
+ * @file   geometry_released_wires_test.cxx
+ * @brief  Test of the geometry with wires released and rebuilt on first access.
+ * @date   October 16, 2026
+ *
+ * Usage:
+ *
+ *     geometry_released_wires_test configuration.fcl
+ *
+ * The configuration file must contain a geometry service provider configuration
+ * under `services.Geometry`, for a geometry with the standard channel mapping
+ * and with `ReleaseWires` set.
+ *
+ * The geometry is set up twice, with and without `ReleaseWires`.
+ * The plane information must be the same in the two geometries before any of
+ * the released wires is rebuilt; then, the wires are accessed from several
+ * threads at the same time, which must all get the same wire objects; and
+ * finally all the wires of the two geometries must be identical.
+ * The time spent in each setup is reported: releasing the wires saves memory,
+ * not setup time.
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/ChannelMapStandardAlg.h"
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "larcorealg/Geometry/StandaloneBasicSetup.h"    // SetupMessageFacility()...
+#include "larcorealg/Geometry/StandaloneGeometrySetup.h" // SetupGeometry()
+#include "larcorealg/TestUtils/StopWatch.h"
+
+// utility libraries
+#include "fhiclcpp/ParameterSet.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+//------------------------------------------------------------------------------
+//---  The tests
+//---
+
+namespace {
+
+  /// Counts a mismatch between `a` and `b` of the object described by `what`.
+  template <typename T>
+  unsigned int check(T const& a, T const& b, std::string const& what)
+  {
+    if (a == b) return 0U;
+    mf::LogProblem("geometry_released_wires_test")
+      << what << ": " << a << " with all wires, " << b << " with released wires";
+    return 1U;
+  } // check()
+
+  /// Compares the plane information, which must not need the wires.
+  unsigned int comparePlanes(geo::GeometryCore const& ref, geo::GeometryCore const& test)
+  {
+    unsigned int nErrors = 0;
+    auto refPlane = ref.Iterate<geo::PlaneGeo>().begin();
+    for (geo::PlaneGeo const& plane : test.Iterate<geo::PlaneGeo>()) {
+      std::string const id = std::string(plane.ID());
+      nErrors += check(refPlane->Nwires(), plane.Nwires(), id + " wires");
+      nErrors += check(refPlane->ThetaZ(), plane.ThetaZ(), id + " theta z");
+      nErrors += check(refPlane->WirePitch(), plane.WirePitch(), id + " wire pitch");
+      nErrors += check(refPlane->FirstWire().GetCenter(),
+                       plane.FirstWireCenter(),
+                       id + " first wire center");
+      nErrors += check(refPlane->GetWireDirection(), plane.GetWireDirection(), id + " wire dir");
+      ++refPlane;
+    }
+    return nErrors;
+  } // comparePlanes()
+
+  /// Returns the address of all wires in `geom`, in order.
+  std::vector<geo::WireGeo const*> wireAddresses(geo::GeometryCore const& geom)
+  {
+    std::vector<geo::WireGeo const*> wires;
+    for (geo::PlaneGeo const& plane : geom.Iterate<geo::PlaneGeo>()) {
+      for (unsigned int w = 0; w < plane.Nwires(); ++w)
+        wires.push_back(&plane.Wire(w));
+    }
+    return wires;
+  } // wireAddresses()
+
+  /// Accesses all wires from `nThreads` threads at the same time.
+  unsigned int concurrentAccess(geo::GeometryCore const& geom, unsigned int nThreads)
+  {
+    std::vector<std::vector<geo::WireGeo const*>> wires(nThreads);
+    std::vector<std::thread> threads;
+    for (unsigned int iThread = 0; iThread < nThreads; ++iThread)
+      threads.emplace_back([&geom, &wires, iThread]() { wires[iThread] = wireAddresses(geom); });
+    for (std::thread& thread : threads)
+      thread.join();
+
+    unsigned int nErrors = 0;
+    for (unsigned int iThread = 1; iThread < nThreads; ++iThread) {
+      if (wires[iThread] == wires[0]) continue;
+      mf::LogProblem("geometry_released_wires_test")
+        << "Thread #" << iThread << " got different wires than thread #0";
+      ++nErrors;
+    }
+    return nErrors;
+  } // concurrentAccess()
+
+  /// Returns the number of differences between the wires of two geometries.
+  unsigned int compareWires(geo::GeometryCore const& ref, geo::GeometryCore const& test)
+  {
+    unsigned int nErrors = 0;
+    auto refWireID = ref.Iterate<geo::WireID>().begin();
+    for (geo::WireID const& wireID : test.Iterate<geo::WireID>()) {
+      std::string const id = std::string(wireID);
+      nErrors += check(*refWireID, wireID, id + " ID");
+      geo::WireGeo const& refWire = ref.Wire(*refWireID);
+      geo::WireGeo const& wire = test.Wire(wireID);
+      nErrors += check(refWire.GetStart(), wire.GetStart(), id + " start");
+      nErrors += check(refWire.GetEnd(), wire.GetEnd(), id + " end");
+      nErrors += check(refWire.ThetaZ(), wire.ThetaZ(), id + " theta z");
+      nErrors += check(ref.PlaneWireToChannel(*refWireID), test.PlaneWireToChannel(wireID), id);
+      nErrors += check(ref.NearestWireID(refWire.GetCenter(), (*refWireID).asPlaneID()),
+                       test.NearestWireID(wire.GetCenter(), wireID.asPlaneID()),
+                       id + " nearest wire");
+      ++refWireID;
+    }
+    return nErrors;
+  } // compareWires()
+
+} // local namespace
+
+/** ****************************************************************************
+ * @brief Runs the test
+ * @param argc number of arguments in argv
+ * @param argv arguments to the function
+ * @return number of detected errors (0 on success)
+ * @throw cet::exception most of error situations throw
+ *
+ * The arguments in argv are:
+ * 0. name of the executable ("geometry_released_wires_test")
+ * 1. path to the FHiCL configuration file
+ *
+ */
+//------------------------------------------------------------------------------
+int main(int argc, char const** argv)
+{
+
+  //
+  // parameter parsing
+  //
+  if (argc < 2) throw std::runtime_error("No configuration file specified.");
+  std::string const configPath = argv[1];
+
+  //
+  // testing environment setup
+  //
+  using namespace lar::standalone;
+
+  fhicl::ParameterSet const pset = ParseConfiguration(configPath);
+  SetupMessageFacility(pset, "geometry_released_wires_test");
+
+  auto const geoConfig = pset.get<fhicl::ParameterSet>("services.Geometry");
+  if (!geoConfig.get<bool>("ReleaseWires", false)) {
+    mf::LogError("geometry_released_wires_test")
+      << "Wire release not configured: set `ReleaseWires`.";
+    return 1;
+  }
+  fhicl::ParameterSet refGeoConfig = geoConfig;
+  refGeoConfig.put_or_replace("ReleaseWires", false);
+
+  //
+  // run the test
+  //
+  testing::StopWatch<> timer;
+  auto const refGeom = SetupGeometry<geo::ChannelMapStandardAlg>(refGeoConfig);
+  double const refTime = timer.elapsed();
+
+  timer.restart();
+  auto const geom = SetupGeometry<geo::ChannelMapStandardAlg>(geoConfig);
+  double const releasedTime = timer.elapsed();
+
+  mf::LogVerbatim("geometry_released_wires_test")
+    << "Geometry setup: " << (refTime * 1000.0) << " ms with all wires, " << (releasedTime * 1000.0)
+    << " ms with released wires";
+
+  unsigned int nErrors = comparePlanes(*refGeom, *geom);
+  nErrors += concurrentAccess(*geom, 4U);
+  nErrors += compareWires(*refGeom, *geom);
+
+  // and finally we cross fingers
+  if (nErrors > 0) {
+    mf::LogError("geometry_released_wires_test") << nErrors << " errors detected!";
+  }
+
+  return nErrors;
+} // main()
@@ -0,0 +1,206 @@
+/**
+ * @file   geometry_snapshot_test.cxx
+ * @brief  Test of the geometry built from a binary snapshot.
+ * @date   October 16, 2026
+ *
+ * Usage:
+ *
+ *     geometry_snapshot_test configuration.fcl
+ *
+ * The configuration file must contain a geometry service provider configuration
+ * under `services.Geometry`, for a geometry with the standard channel mapping
+ * and with a `SnapshotFile` set.
+ *
+ * The geometry is set up twice: the first time, after removing the snapshot
+ * file, the geometry is built from the ROOT geometry and the snapshot is
+ * written; the second time, the geometry is built from the snapshot.
+ * All the geometry objects of the two geometries must be identical.
+ * The time spent in each setup is reported.
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/AuxDetGeo.h"
+#include "larcorealg/Geometry/BoxBoundedGeo.h"
+#include "larcorealg/Geometry/ChannelMapStandardAlg.h"
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "larcorealg/Geometry/OpDetGeo.h"
+#include "larcorealg/Geometry/StandaloneBasicSetup.h"    // SetupMessageFacility()...
+#include "larcorealg/Geometry/StandaloneGeometrySetup.h" // SetupGeometry()
+#include "larcorealg/TestUtils/StopWatch.h"
+
+// utility libraries
+#include "fhiclcpp/ParameterSet.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <cstdio> // std::remove()
+#include <fstream>
+#include <memory> // std::unique_ptr
+#include <stdexcept>
+#include <string>
+
+//------------------------------------------------------------------------------
+//---  The tests
+//---
+
+namespace {
+
+  /// Counts a mismatch between `a` and `b` of the object described by `what`.
+  template <typename T>
+  unsigned int check(T const& a, T const& b, std::string const& what)
+  {
+    if (a == b) return 0U;
+    mf::LogProblem("geometry_snapshot_test")
+      << what << ": " << a << " from ROOT geometry, " << b << " from snapshot";
+    return 1U;
+  } // check()
+
+  /// Counts a mismatch between the boxes `a` and `b`.
+  unsigned int checkBox(geo::BoxBoundedGeo const& a,
+                        geo::BoxBoundedGeo const& b,
+                        std::string const& what)
+  {
+    return check(a.Min(), b.Min(), what + " lower corner") +
+           check(a.Max(), b.Max(), what + " upper corner");
+  } // checkBox()
+
+  /// Returns the number of differences between the two geometries.
+  unsigned int compareGeometries(geo::GeometryCore const& ref, geo::GeometryCore const& test)
+  {
+    unsigned int nErrors = 0;
+
+    nErrors += check(ref.Ncryostats(), test.Ncryostats(), "number of cryostats");
+    nErrors += check(ref.NTPC(), test.NTPC(), "number of TPC in C:0");
+    nErrors += check(ref.Nchannels(), test.Nchannels(), "number of channels");
+    nErrors += check(ref.NOpDets(), test.NOpDets(), "number of optical detectors");
+    nErrors += check(ref.NAuxDets(), test.NAuxDets(), "number of auxiliary detectors");
+    if (nErrors > 0) return nErrors; // no point in going on
+
+    auto refCryo = ref.Iterate<geo::CryostatGeo>().begin();
+    for (geo::CryostatGeo const& cryo : test.Iterate<geo::CryostatGeo>()) {
+      std::string const id = std::string(cryo.ID());
+      nErrors += check(refCryo->ID(), cryo.ID(), id + " ID");
+      nErrors += checkBox(refCryo->Boundaries(), cryo.Boundaries(), id);
+      ++refCryo;
+    }
+
+    auto refTPC = ref.Iterate<geo::TPCGeo>().begin();
+    for (geo::TPCGeo const& tpc : test.Iterate<geo::TPCGeo>()) {
+      std::string const id = std::string(tpc.ID());
+      nErrors += check(refTPC->ID(), tpc.ID(), id + " ID");
+      nErrors += checkBox(*refTPC, tpc, id);
+      nErrors += checkBox(refTPC->ActiveBoundingBox(), tpc.ActiveBoundingBox(), id + " active");
+      ++refTPC;
+    }
+
+    auto refPlane = ref.Iterate<geo::PlaneGeo>().begin();
+    for (geo::PlaneGeo const& plane : test.Iterate<geo::PlaneGeo>()) {
+      std::string const id = std::string(plane.ID());
+      nErrors += check(refPlane->ID(), plane.ID(), id + " ID");
+      nErrors += check(refPlane->Nwires(), plane.Nwires(), id + " wires");
+      nErrors += check(refPlane->GetCenter(), plane.GetCenter(), id + " center");
+      nErrors += check(refPlane->GetNormalDirection(), plane.GetNormalDirection(), id + " normal");
+      nErrors += check(refPlane->WidthDir(), plane.WidthDir(), id + " width direction");
+      nErrors += check(refPlane->DepthDir(), plane.DepthDir(), id + " depth direction");
+      ++refPlane;
+    }
+
+    auto refWireID = ref.Iterate<geo::WireID>().begin();
+    for (geo::WireID const& wireID : test.Iterate<geo::WireID>()) {
+      std::string const id = std::string(wireID);
+      nErrors += check(*refWireID, wireID, id + " ID");
+      geo::WireGeo const& refWire = ref.Wire(*refWireID);
+      geo::WireGeo const& wire = test.Wire(wireID);
+      nErrors += check(refWire.GetStart(), wire.GetStart(), id + " start");
+      nErrors += check(refWire.GetEnd(), wire.GetEnd(), id + " end");
+      nErrors += check(ref.PlaneWireToChannel(*refWireID), test.PlaneWireToChannel(wireID), id);
+      ++refWireID;
+    }
+
+    for (unsigned int iOpDet = 0; iOpDet < ref.NOpDets(); ++iOpDet) {
+      nErrors += check(ref.OpDetGeoFromOpDet(iOpDet).GetCenter(),
+                       test.OpDetGeoFromOpDet(iOpDet).GetCenter(),
+                       "optical detector #" + std::to_string(iOpDet) + " center");
+    }
+
+    for (unsigned int iAuxDet = 0; iAuxDet < ref.NAuxDets(); ++iAuxDet) {
+      nErrors += check(ref.AuxDet(iAuxDet).GetCenter(),
+                       test.AuxDet(iAuxDet).GetCenter(),
+                       "auxiliary detector #" + std::to_string(iAuxDet) + " center");
+    }
+
+    return nErrors;
+  } // compareGeometries()
+
+} // local namespace
+
+/** ****************************************************************************
+ * @brief Runs the test
+ * @param argc number of arguments in argv
+ * @param argv arguments to the function
+ * @return number of detected errors (0 on success)
+ * @throw cet::exception most of error situations throw
+ *
+ * The arguments in argv are:
+ * 0. name of the executable ("geometry_snapshot_test")
+ * 1. path to the FHiCL configuration file
+ *
+ */
+//------------------------------------------------------------------------------
+int main(int argc, char const** argv)
+{
+
+  //
+  // parameter parsing
+  //
+  if (argc < 2) throw std::runtime_error("No configuration file specified.");
+  std::string const configPath = argv[1];
+
+  //
+  // testing environment setup
+  //
+  using namespace lar::standalone;
+
+  fhicl::ParameterSet const pset = ParseConfiguration(configPath);
+  SetupMessageFacility(pset, "geometry_snapshot_test");
+
+  auto const geoConfig = pset.get<fhicl::ParameterSet>("services.Geometry");
+  std::string const snapshotFile = geoConfig.get<std::string>("SnapshotFile", "");
+  if (snapshotFile.empty()) {
+    mf::LogError("geometry_snapshot_test")
+      << "No geometry snapshot configured: set `SnapshotFile`.";
+    return 1;
+  }
+  std::remove(snapshotFile.c_str());
+
+  //
+  // run the test
+  //
+  testing::StopWatch<> timer;
+  auto const refGeom = SetupGeometry<geo::ChannelMapStandardAlg>(geoConfig);
+  double const buildTime = timer.elapsed();
+
+  if (!std::ifstream{snapshotFile}) {
+    mf::LogError("geometry_snapshot_test")
+      << "Geometry snapshot '" << snapshotFile << "' not written.";
+    return 1;
+  }
+
+  timer.restart();
+  auto const geom = SetupGeometry<geo::ChannelMapStandardAlg>(geoConfig);
+  double const snapshotTime = timer.elapsed();
+
+  mf::LogVerbatim("geometry_snapshot_test")
+    << "Geometry setup: " << (buildTime * 1000.0) << " ms from ROOT geometry, "
+    << (snapshotTime * 1000.0) << " ms from snapshot";
+
+  unsigned int const nErrors = compareGeometries(*refGeom, *geom);
+
+  // and finally we cross fingers
+  if (nErrors > 0) {
+    mf::LogError("geometry_snapshot_test") << nErrors << " errors detected!";
+  }
+
+  std::remove(snapshotFile.c_str());
+  return nErrors;
+} // main()
@@ -117,4 +117,9 @@ BOOST_AUTO_TEST_CASE(ChannelMappingTestCase)
   GeometryStandardChannelMappingTestFixture::GlobalTester().ChannelMappingTest();
 }
 
+BOOST_AUTO_TEST_CASE(SignalTypeTestCase)
+{
+  GeometryStandardChannelMappingTestFixture::GlobalTester().SignalTypeTest();
+}
+
 // BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,234 @@
+/**
+ * @file   geometry_wire_table_test.cxx
+ * @brief  Test of the detector-wide wire table against the wire objects.
+ * @date   October 16, 2026
+ *
+ * Usage:
+ *
+ *     geometry_wire_table_test configuration.fcl
+ *
+ * The configuration file must contain a geometry service provider configuration
+ * under `services.Geometry`, for a geometry with the standard channel mapping.
+ *
+ * Each wire in the table must have the same center, end points, direction and
+ * half length as its `geo::WireGeo` object, and so must the end points from
+ * `geo::GeometryCore::WireEndPoints()`.
+ * The dense wire index must follow the wire ID order with no gap, and convert
+ * back to the same wire ID; a wire data container must follow the same order.
+ * The intersections of the wires from `geo::GeometryCore::WireIDsIntersect()`,
+ * which reads the table or the intersection kernels, must be the same as the
+ * ones of `geo::WiresIntersectionAndOffsets()` on the wire objects within
+ * rounding, and so must the ones from its batch version.
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/ChannelMapStandardAlg.h"
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "larcorealg/Geometry/StandaloneBasicSetup.h"    // SetupMessageFacility()...
+#include "larcorealg/Geometry/StandaloneGeometrySetup.h" // SetupGeometry()
+#include "larcorealg/Geometry/WireTable.h"
+
+// utility libraries
+#include "fhiclcpp/ParameterSet.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::max()
+#include <cmath>     // std::abs()
+#include <stdexcept>
+#include <string>
+#include <utility> // std::pair
+#include <vector>
+
+//------------------------------------------------------------------------------
+//---  The tests
+//---
+
+namespace {
+
+  /// Counts a mismatch between `a` and `b` of the object described by `what`.
+  template <typename T>
+  unsigned int check(T const& a, T const& b, std::string const& what)
+  {
+    if (a == b) return 0U;
+    mf::LogProblem("geometry_wire_table_test")
+      << what << ": " << a << " from wire object, " << b << " from wire table";
+    return 1U;
+  } // check()
+
+  /// Counts a mismatch of the points `a` and `b` beyond rounding
+  /// (or beyond `tolerance` [cm], if larger).
+  unsigned int checkClose(geo::Point_t const& a,
+                          geo::Point_t const& b,
+                          std::string const& what,
+                          double tolerance = 0.0)
+  {
+    if ((b - a).R() <= std::max(tolerance, 1e-9 * (1.0 + a.R()))) return 0U;
+    return check(a, b, what);
+  } // checkClose()
+
+  /// Compares all the wires in the table with the wire objects.
+  unsigned int compareWires(geo::GeometryCore const& geom)
+  {
+    geo::WireTable const& table = geom.GetWireTable();
+    unsigned int nErrors = 0;
+    std::size_t expectedIndex = 0;
+    for (geo::WireID const& wireID : geom.Iterate<geo::WireID>()) {
+      std::string const id = std::string(wireID);
+      if (!table.hasWire(wireID)) {
+        mf::LogProblem("geometry_wire_table_test") << id << " not in the wire table";
+        ++nErrors;
+        continue;
+      }
+      std::size_t const i = table.index(wireID);
+      nErrors += check(expectedIndex++, i, id + " index");
+      nErrors += check(i, geom.WireIndex(wireID), id + " dense index");
+      nErrors += check(wireID, geom.WireIDfromIndex(i), id + " from dense index");
+      geo::WireGeo const& wire = geom.Wire(wireID);
+      nErrors += check(wire.GetCenter(), table.center(i), id + " center");
+      nErrors += check(wire.Direction(), table.direction(i), id + " direction");
+      nErrors += check(wire.HalfL(), table.halfLength(i), id + " half length");
+      nErrors += check(wire.GetStart(), table.start(i), id + " start");
+      nErrors += check(wire.GetEnd(), table.end(i), id + " end");
+      auto const ends = geom.WireEndPoints(wireID);
+      nErrors += check(wire.GetStart(), ends.start(), id + " segment start");
+      nErrors += check(wire.GetEnd(), ends.end(), id + " segment end");
+    }
+    nErrors += check(expectedIndex, table.size(), "number of wires");
+    nErrors += check(false, geom.WireIDfromIndex(table.size()).isValid, "wire past the last");
+    return nErrors;
+  } // compareWires()
+
+  /// Checks that a wire data container covers all and only the wires.
+  unsigned int checkWireData(geo::GeometryCore const& geom)
+  {
+    unsigned int nErrors = 0;
+    auto wireData = geom.makeWireData<std::size_t>();
+    nErrors += check(geom.GetWireTable().size(), wireData.size(), "wire data size");
+    for (geo::WireID const& wireID : geom.Iterate<geo::WireID>())
+      wireData.at(wireID) = geom.WireIndex(wireID);
+
+    std::size_t expected = 0;
+    for (auto&& [wireID, index] : wireData.items()) {
+      nErrors += check(expected++, index, std::string(wireID) + " wire data");
+      nErrors += check(geom.WireIndex(wireID), index, std::string(wireID) + " wire data ID");
+    }
+
+    for (geo::PlaneGeo const& plane : geom.Iterate<geo::PlaneGeo>()) {
+      auto const planeData = wireData.planeData(plane.ID());
+      std::string const id = std::string(plane.ID());
+      nErrors += check<std::size_t>(plane.Nwires(), planeData.size(), id + " wire data");
+      if (!planeData.empty()) {
+        nErrors += check(geom.WireIndex({plane.ID(), 0U}), *planeData.begin(), id + " wire data");
+      }
+    }
+    return nErrors;
+  } // checkWireData()
+
+  /// Returns whether `offset` is within `halfL`, and if it is too close to tell.
+  std::pair<bool, bool> withinWire(double offset, double halfL)
+  {
+    return {std::abs(offset) <= halfL, std::abs(std::abs(offset) - halfL) <= 1e-5};
+  } // withinWire()
+
+  /// Compares the intersection of the first wire of each plane with all the
+  /// wires of the other planes of the same TPC.
+  unsigned int compareIntersections(geo::GeometryCore const& geom)
+  {
+    unsigned int nErrors = 0;
+    std::vector<geo::WireID> wires1, wires2;
+    std::vector<geo::Point_t> points;
+    std::vector<char> withinFlags;
+    for (geo::TPCGeo const& tpc : geom.Iterate<geo::TPCGeo>()) {
+      for (geo::PlaneGeo const& plane1 : tpc.IteratePlanes()) {
+        geo::WireID const wid1{plane1.ID(), 0U};
+        geo::WireGeo const& wire1 = plane1.Wire(0U);
+        nErrors +=
+          check(false, geom.WireIDsCanIntersect(wid1, wid1), std::string(wid1) + " x itself");
+        for (geo::PlaneGeo const& plane2 : tpc.IteratePlanes()) {
+          if (plane2.ID() == plane1.ID()) continue;
+          for (geo::WireID const& wid2 : geom.Iterate<geo::WireID>(plane2.ID())) {
+            geo::WireGeo const& wire2 = geom.Wire(wid2);
+            auto const expected = geo::WiresIntersectionAndOffsets(wire1, wire2);
+            auto const [within1, edge1] = withinWire(expected.offset1, wire1.HalfL());
+            auto const [within2, edge2] = withinWire(expected.offset2, wire2.HalfL());
+            geo::Point_t point;
+            bool const within = geom.WireIDsIntersect(wid1, wid2, point);
+            std::string const id = std::string(wid1) + " x " + std::string(wid2);
+            nErrors += checkClose(expected.point, point, id + " intersection", 1e-5);
+            if (!edge1 && !edge2) // too close to the end to tell
+              nErrors += check(within1 && within2, within, id + " within wires");
+            wires1.push_back(wid1);
+            wires2.push_back(wid2);
+            points.push_back(point);
+            withinFlags.push_back(within);
+          } // wires on plane 2
+        }   // plane 2
+      }     // plane 1
+    }       // TPCs
+
+    // the batch version must give the same answers as the single one
+    std::vector<geo::Point_t> batchPoints;
+    std::vector<bool> batchWithin;
+    geom.WireIDsIntersect(wires1, wires2, batchPoints, batchWithin);
+    std::size_t const n = wires1.size();
+    nErrors += check(n, batchPoints.size(), "batch intersections");
+    nErrors += check(n, batchWithin.size(), "batch within flags");
+    if ((batchPoints.size() != n) || (batchWithin.size() != n)) return nErrors;
+    for (std::size_t i = 0; i < n; ++i) {
+      std::string const id = std::string(wires1[i]) + " x " + std::string(wires2[i]) + " (batch)";
+      nErrors += check(points[i], batchPoints[i], id + " intersection");
+      nErrors += check(withinFlags[i] != 0, bool(batchWithin[i]), id + " within wires");
+    }
+    return nErrors;
+  } // compareIntersections()
+
+} // local namespace
+
+/** ****************************************************************************
+ * @brief Runs the test
+ * @param argc number of arguments in argv
+ * @param argv arguments to the function
+ * @return number of detected errors (0 on success)
+ * @throw cet::exception most of error situations throw
+ *
+ * The arguments in argv are:
+ * 0. name of the executable ("geometry_wire_table_test")
+ * 1. path to the FHiCL configuration file
+ *
+ */
+//------------------------------------------------------------------------------
+int main(int argc, char const** argv)
+{
+
+  //
+  // parameter parsing
+  //
+  if (argc < 2) throw std::runtime_error("No configuration file specified.");
+  std::string const configPath = argv[1];
+
+  //
+  // testing environment setup
+  //
+  using namespace lar::standalone;
+
+  fhicl::ParameterSet const pset = ParseConfiguration(configPath);
+  SetupMessageFacility(pset, "geometry_wire_table_test");
+
+  auto const geoConfig = pset.get<fhicl::ParameterSet>("services.Geometry");
+  auto const geom = SetupGeometry<geo::ChannelMapStandardAlg>(geoConfig);
+
+  //
+  // run the test
+  //
+  unsigned int nErrors = compareWires(*geom);
+  nErrors += compareIntersections(*geom);
+  nErrors += checkWireData(*geom);
+
+  // and finally we cross fingers
+  if (nErrors > 0) {
+    mf::LogError("geometry_wire_table_test") << nErrors << " errors detected!";
+  }
+
+  return nErrors;
+} // main()
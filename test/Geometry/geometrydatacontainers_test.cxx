@@ -15,6 +15,10 @@
 #include "larcorealg/Geometry/GeometryDataContainers.h"
 #include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
 
+// C/C++ standard libraries
+#include <string>
+#include <vector>
+
 //------------------------------------------------------------------------------
 template <typename T>
 struct Summer {
@@ -810,6 +814,17 @@ BOOST_AUTO_TEST_CASE(TPCDataContainerTestCase)
   data2.resizeAs(data1);
   TPCDataContainerTest(data2, NCryostats, NTPCs);
 
+  //
+  // size constructor with default value
+  //
+  geo::TPCDataContainer<int> data3(NCryostats, NTPCs, 5);
+  BOOST_TEST(data3.size() == NCryostats * NTPCs);
+  for (int const value : data3)
+    BOOST_TEST(value == 5);
+
+  data3.reset();
+  TPCDataContainerTest(data3, NCryostats, NTPCs);
+
 } // TPCDataContainerTestCase
 
 //------------------------------------------------------------------------------
@@ -835,8 +850,58 @@ BOOST_AUTO_TEST_CASE(PlaneDataContainerTestCase)
   data2.resizeAs(data1);
   PlaneDataContainerTest(data2, NCryostats, NTPCs, NPlanes);
 
+  //
+  // size constructor with default value
+  //
+  geo::PlaneDataContainer<int> data3(NCryostats, NTPCs, NPlanes, 5);
+  BOOST_TEST(data3.size() == NCryostats * NTPCs * NPlanes);
+  for (int const value : data3)
+    BOOST_TEST(value == 5);
+
+  data3.reset();
+  PlaneDataContainerTest(data3, NCryostats, NTPCs, NPlanes);
+
 } // PlaneDataContainerTestCase
 
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(CompactTPCDataContainerTestCase)
+{
+
+  // the first cryostat has three TPCs, the second only one
+  std::vector<geo::TPCID> const TPCs{
+    geo::TPCID{0U, 0U},
+    geo::TPCID{0U, 1U},
+    geo::TPCID{0U, 2U},
+    geo::TPCID{1U, 0U},
+  };
+
+  geo::CompactTPCDataContainer<int> data{geo::CompactTPCIDmapper<>{TPCs}, -1};
+  BOOST_TEST(data.size() == TPCs.size());
+  BOOST_TEST(!data.hasTPC(geo::TPCID{1U, 1U}));
+
+  int value = 0;
+  for (geo::TPCID const& tpcid : TPCs) {
+    BOOST_TEST(data.hasTPC(tpcid));
+    BOOST_TEST(data[tpcid] == -1);
+    data[tpcid] = value++;
+  }
+
+  // iteration visits only the existing TPCs, in order
+  std::size_t iTPC = 0U;
+  for (auto&& [tpcid, tpcData] : data.items()) {
+    BOOST_TEST_CHECKPOINT("TPC: " << std::string(tpcid));
+    BOOST_TEST(iTPC < TPCs.size());
+    BOOST_TEST(tpcid == TPCs[iTPC]);
+    BOOST_TEST(tpcData == static_cast<int>(iTPC));
+    ++iTPC;
+  }
+  BOOST_TEST(iTPC == TPCs.size());
+
+  BOOST_TEST(data.firstID() == TPCs.front());
+  BOOST_TEST(data.lastID() == TPCs.back());
+
+} // CompactTPCDataContainerTestCase
+
 //------------------------------------------------------------------------------
 
 BOOST_AUTO_TEST_SUITE_END()
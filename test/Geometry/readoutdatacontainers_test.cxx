@@ -810,6 +810,45 @@ BOOST_AUTO_TEST_CASE(ROPDataContainerTestCase)
 
 } // ROPDataContainerTestCase
 
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ChannelDataContainerTestCase)
+{
+
+  constexpr std::size_t NChannels = 7U;
+
+  readout::ChannelDataContainer<int> data(NChannels, -1);
+
+  BOOST_TEST(!data.empty());
+  BOOST_TEST(data.size() == NChannels);
+  BOOST_TEST(data.hasChannel(0U));
+  BOOST_TEST(data.hasChannel(NChannels - 1U));
+  BOOST_TEST(!data.hasChannel(NChannels));
+  BOOST_TEST(!data.hasChannel(raw::InvalidChannelID));
+
+  for (raw::ChannelID_t channel : util::counter<raw::ChannelID_t>(NChannels)) {
+    BOOST_TEST(data[channel] == -1);
+    data[channel] = static_cast<int>(channel);
+  }
+  BOOST_CHECK_THROW(data.at(NChannels), std::out_of_range);
+
+  int expected = 0;
+  for (int value : data)
+    BOOST_TEST(value == expected++);
+  BOOST_TEST(data.data()[3] == 3);
+
+  BOOST_TEST(data.apply(Summer<int>{}).get() == 21);
+
+  data.fill(4);
+  BOOST_TEST(data.at(NChannels - 1U) == 4);
+  data.reset();
+  BOOST_TEST(data[0U] == 0);
+
+  readout::ChannelDataContainer<int> empty;
+  BOOST_TEST(empty.empty());
+  BOOST_TEST(!empty.hasChannel(0U));
+
+} // ChannelDataContainerTestCase
+
 //------------------------------------------------------------------------------
 
 BOOST_AUTO_TEST_SUITE_END()